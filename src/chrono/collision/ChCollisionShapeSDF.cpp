@@ -0,0 +1,56 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include "chrono/collision/ChCollisionShapeSDF.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChCollisionShapeSDF)
+CH_UPCASTING(ChCollisionShapeSDF, ChCollisionShape)
+
+ChCollisionShapeSDF::ChCollisionShapeSDF() : ChCollisionShape(Type::SDF), field(nullptr) {}
+
+ChCollisionShapeSDF::ChCollisionShapeSDF(std::shared_ptr<ChContactMaterial> material,
+                                         std::shared_ptr<ChSignedDistanceField> field)
+    : ChCollisionShape(Type::SDF, material), field(field) {}
+
+ChCollisionShapeSDF::ChCollisionShapeSDF(std::shared_ptr<ChContactMaterial> material,
+                                         const ChTriangleMeshConnected& mesh,
+                                         double cell_size,
+                                         int band,
+                                         const std::string& cache_file)
+    : ChCollisionShape(Type::SDF, material) {
+    field = ChSignedDistanceField::CreateFromMesh(mesh, cell_size, band, cache_file);
+}
+
+void ChCollisionShapeSDF::ArchiveOut(ChArchiveOut& archive_out) {
+    // version number
+    archive_out.VersionWrite<ChCollisionShapeSDF>();
+    // serialize parent class
+    ChCollisionShape::ArchiveOut(archive_out);
+    // serialize all member data:
+    archive_out << CHNVP(field);
+}
+
+void ChCollisionShapeSDF::ArchiveIn(ChArchiveIn& archive_in) {
+    // version number
+    /*int version =*/archive_in.VersionRead<ChCollisionShapeSDF>();
+    // deserialize parent class
+    ChCollisionShape::ArchiveIn(archive_in);
+    // stream in all member data:
+    archive_in >> CHNVP(field);
+}
+
+}  // end namespace chrono
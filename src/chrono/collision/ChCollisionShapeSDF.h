@@ -0,0 +1,62 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_COLLISION_SHAPE_SDF_H
+#define CH_COLLISION_SHAPE_SDF_H
+
+#include "chrono/collision/ChCollisionShape.h"
+#include "chrono/collision/ChSignedDistanceField.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_collision
+/// @{
+
+/// Collision shape defined by the signed distance field of a closed triangle mesh.\n
+/// Contacts with spheres, capsules, and boxes are obtained by sampling the distance field (and its gradient) at
+/// points on the other shape. Contacts with another distance field shape are obtained by sampling each field at the
+/// surface points of the other mesh. Other shape pairs are not supported.
+class ChApi ChCollisionShapeSDF : public ChCollisionShape {
+  public:
+    ChCollisionShapeSDF();
+    ChCollisionShapeSDF(std::shared_ptr<ChContactMaterial> material,   ///< surface contact material
+                        std::shared_ptr<ChSignedDistanceField> field  ///< signed distance field
+    );
+    ChCollisionShapeSDF(std::shared_ptr<ChContactMaterial> material,  ///< surface contact material
+                        const ChTriangleMeshConnected& mesh,          ///< closed triangle mesh
+                        double cell_size,                             ///< distance field grid cell size
+                        int band = 3,                                 ///< narrow band half-width (number of cells)
+                        const std::string& cache_file = ""            ///< distance field cache file
+    );
+
+    ~ChCollisionShapeSDF() {}
+
+    /// Access the signed distance field.
+    std::shared_ptr<ChSignedDistanceField> GetField() const { return field; }
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& archive_out) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& archive_in) override;
+
+  private:
+    std::shared_ptr<ChSignedDistanceField> field;
+};
+
+/// @} chrono_collision
+
+}  // end namespace chrono
+
+#endif
@@ -28,6 +28,7 @@
 #include "chrono/collision/ChCollisionShapePoint.h"
 #include "chrono/collision/ChCollisionShapeRoundedBox.h"
 #include "chrono/collision/ChCollisionShapeRoundedCylinder.h"
+#include "chrono/collision/ChCollisionShapeSDF.h"
 #include "chrono/collision/ChCollisionShapeSegment2D.h"
 #include "chrono/collision/ChCollisionShapeSphere.h"
 #include "chrono/collision/ChCollisionShapeTriangle.h"
@@ -12,17 +12,28 @@
 // Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
 #include "chrono/collision/ChCollisionSystem.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/physics/ChAssembly.h"
 #include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChParticleCloud.h"
 #include "chrono/physics/ChConveyor.h"
 #include "chrono/fea/ChMesh.h"
 
 namespace chrono {
 
-ChCollisionSystem::ChCollisionSystem() : m_system(nullptr), m_initialized(false) {}
+ChCollisionSystem::ChCollisionSystem()
+    : m_system(nullptr),
+      m_initialized(false),
+      m_deterministic(false),
+      m_stats_enabled(false),
+      m_trace_enabled(false),
+      m_num_speculative(0) {}
 
 ChCollisionSystem::~ChCollisionSystem() {}
 
@@ -51,6 +62,221 @@ void ChCollisionSystem::UnbindItem(std::shared_ptr<ChPhysicsItem> item) {
     item->RemoveCollisionModelsFromSystem(this);
 }
 
+size_t ChCollisionSystem::RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const {
+    results.resize(rays.size());
+    size_t num_hits = 0;
+    for (size_t i = 0; i < rays.size(); i++) {
+        if (RayHit(rays[i].from, rays[i].to, results[i]))
+            num_hits++;
+    }
+    return num_hits;
+}
+
+// -----------------------------------------------------------------------------
+
+// Number of rays cast for each swept CCD sphere: one from the front point and a ring on the front half of the sphere.
+static const int ccd_ring_size = 6;
+static const int ccd_num_rays = 1 + ccd_ring_size;
+
+// Polar angle (from the sweep direction) of the ring of ray start points on a CCD sphere.
+static const double ccd_ring_angle = CH_PI / 3;
+
+void ChCollisionSystem::ReportSpeculativeContacts(ChContactContainer* container) {
+    m_num_speculative = 0;
+    if (!m_system || m_system->GetStep() <= 0)
+        return;
+
+    double step = m_system->GetStep();
+
+    double start = GetTraceTime();
+
+    // Collect the CCD bodies which would travel more than their collision envelope during the step and generate the
+    // rays sweeping their CCD spheres. Rays start outside the sphere inflated by the envelope, so that they do not hit
+    // the body's own collision shapes.
+    m_ccd_bodies.clear();
+    m_ccd_rays.clear();
+    for (const auto& body : m_system->GetBodies()) {
+        if (!body->IsCCDEnabled() || !body->IsCollisionEnabled() || !body->IsActive())
+            continue;
+        const auto& model = body->GetCollisionModel();
+        if (!model || model->GetNumShapes() == 0)
+            continue;
+
+        double speed = body->GetPosDt().Length();
+        double envelope = model->GetEnvelope();
+        if (speed * step <= envelope)
+            continue;
+
+        ChVector3d dir = body->GetPosDt() / speed;
+        ChVector3d u = dir.GetOrthogonalVector();
+        ChVector3d w = Vcross(dir, u);
+        ChVector3d sweep = (speed * step + envelope) * dir;
+        double radius = body->GetCCDRadius() + envelope;
+
+        m_ccd_bodies.push_back(body.get());
+        ChVector3d from = body->GetPos() + radius * dir;
+        m_ccd_rays.push_back({from, from + sweep});
+        for (int k = 0; k < ccd_ring_size; k++) {
+            double angle = k * CH_2PI / ccd_ring_size;
+            ChVector3d radial = std::cos(angle) * u + std::sin(angle) * w;
+            from = body->GetPos() + radius * (std::cos(ccd_ring_angle) * dir + std::sin(ccd_ring_angle) * radial);
+            m_ccd_rays.push_back({from, from + sweep});
+        }
+    }
+
+    if (m_ccd_bodies.empty())
+        return;
+
+    RayHitBatch(m_ccd_rays, m_ccd_hits);
+
+    // For each swept body, add a contact with each collision model hit by its rays, using the closest hit.
+    // The contact is between the CCD sphere and the tangent plane at the hit point (normal pointing towards the body).
+    ChCollisionInfo cinfo[ccd_num_rays];
+    std::shared_ptr<ChContactMaterial> materials[ccd_num_rays];
+    for (size_t ib = 0; ib < m_ccd_bodies.size(); ib++) {
+        ChBody* body = m_ccd_bodies[ib];
+        ChCollisionModel* model = body->GetCollisionModel().get();
+        const auto& shape = model->GetShapeInstance(0).first;
+        const ChVector3d& center = body->GetPos();
+        double radius = body->GetCCDRadius();
+        double envelope = model->GetEnvelope();
+        ChVector3d dir = m_ccd_rays[ib * ccd_num_rays].to - m_ccd_rays[ib * ccd_num_rays].from;
+
+        int num_models = 0;
+        for (int i = 0; i < ccd_num_rays; i++) {
+            const auto& hit = m_ccd_hits[ib * ccd_num_rays + i];
+            if (!hit.hit || !hit.hitModel || hit.hitModel->GetContactable() == model->GetContactable())
+                continue;
+
+            // Skip models excluded by the collision family filters
+            if ((model->GetFamilyGroup() & hit.hitModel->GetFamilyMask()) == 0 ||
+                (hit.hitModel->GetFamilyGroup() & model->GetFamilyMask()) == 0)
+                continue;
+
+            // Skip surfaces not facing the body and obstacles within the envelope (reported by the narrowphase)
+            if (Vdot(hit.abs_hitNormal, dir) >= 0)
+                continue;
+            double distance = Vdot(center - hit.abs_hitPoint, hit.abs_hitNormal) - radius;
+            if (distance <= envelope)
+                continue;
+
+            // Keep the closest hit for each collision model
+            int j = 0;
+            while (j < num_models && cinfo[j].modelA != hit.hitModel)
+                j++;
+            if (j < num_models && cinfo[j].distance <= distance)
+                continue;
+            if (j == num_models)
+                num_models++;
+
+            ChCollisionShape* hit_shape = hit.hitShape ? hit.hitShape : hit.hitModel->GetShapeInstance(0).first.get();
+
+            cinfo[j].modelA = hit.hitModel;
+            cinfo[j].modelB = model;
+            cinfo[j].shapeA = hit_shape;
+            cinfo[j].shapeB = shape.get();
+            cinfo[j].vN = hit.abs_hitNormal;
+            cinfo[j].vpA = hit.abs_hitPoint;
+            cinfo[j].vpB = center - radius * hit.abs_hitNormal;
+            cinfo[j].distance = distance;
+            cinfo[j].eff_radius = radius;
+            materials[j] = hit_shape->GetMaterial();
+        }
+
+        for (int j = 0; j < num_models; j++)
+            container->AddContact(cinfo[j], materials[j], shape->GetMaterial());
+        m_num_speculative += num_models;
+    }
+
+    AddTraceEvent("CCD", start, GetTraceTime() - start);
+}
+
+// -----------------------------------------------------------------------------
+
+ChCollisionSystem::Stats::Stats() {
+    Reset();
+}
+
+void ChCollisionSystem::Stats::Reset() {
+    num_models = 0;
+    num_broadphase_pairs = 0;
+    num_filtered_pairs = 0;
+    num_narrowphase_pairs = 0;
+    num_contacts = 0;
+    std::fill(&narrowphase_calls[0][0], &narrowphase_calls[0][0] + num_shape_types * num_shape_types, 0);
+    bin_histogram.clear();
+}
+
+unsigned int ChCollisionSystem::Stats::GetNarrowphaseCalls(ChCollisionShape::Type typeA,
+                                                          ChCollisionShape::Type typeB) const {
+    return narrowphase_calls[std::min(typeA, typeB)][std::max(typeA, typeB)];
+}
+
+void ChCollisionSystem::Stats::AddNarrowphaseCall(ChCollisionShape::Type typeA, ChCollisionShape::Type typeB) {
+    narrowphase_calls[std::min(typeA, typeB)][std::max(typeA, typeB)]++;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChCollisionSystem::EnableTrace(bool val) {
+    if (val && !m_trace_enabled)
+        m_trace_t0 = std::chrono::high_resolution_clock::now();
+    m_trace_enabled = val;
+}
+
+void ChCollisionSystem::ClearTrace() {
+    m_trace.clear();
+    m_trace_t0 = std::chrono::high_resolution_clock::now();
+}
+
+double ChCollisionSystem::GetTraceTime() const {
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - m_trace_t0).count();
+}
+
+void ChCollisionSystem::AddTraceEvent(const char* name, double start, double duration) {
+    if (m_trace_enabled)
+        m_trace.push_back({name, start, duration, {0, 0, 0, 0}});
+}
+
+void ChCollisionSystem::AddTraceCounters() {
+    if (!m_trace_enabled || !m_stats_enabled)
+        return;
+    m_trace.push_back({nullptr,
+                       GetTraceTime(),
+                       0,
+                       {m_stats.num_broadphase_pairs, m_stats.num_filtered_pairs, m_stats.num_narrowphase_pairs,
+                        m_stats.num_contacts}});
+}
+
+bool ChCollisionSystem::WriteTrace(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open())
+        return false;
+
+    // Chrome trace event format: complete events ("X") for phases and counter events ("C") for statistics.
+    // Timestamps and durations are in microseconds.
+    file << std::fixed << std::setprecision(3);
+    file << "{\"traceEvents\":[\n";
+    for (size_t i = 0; i < m_trace.size(); i++) {
+        const auto& e = m_trace[i];
+        if (e.name) {
+            file << "{\"name\":\"" << e.name << "\",\"cat\":\"collision\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":"
+                 << e.start * 1e6 << ",\"dur\":" << e.duration * 1e6 << "}";
+        } else {
+            file << "{\"name\":\"collision counts\",\"cat\":\"collision\",\"ph\":\"C\",\"pid\":1,\"ts\":"
+                 << e.start * 1e6 << ",\"args\":{\"broadphase pairs\":" << e.count[0]
+                 << ",\"filtered pairs\":" << e.count[1] << ",\"narrowphase pairs\":" << e.count[2]
+                 << ",\"contacts\":" << e.count[3] << "}}";
+        }
+        file << (i + 1 < m_trace.size() ? ",\n" : "\n");
+    }
+    file << "],\"displayTimeUnit\":\"ms\"}\n";
+
+    return file.good();
+}
+
+// -----------------------------------------------------------------------------
+
 void ChCollisionSystem::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChCollisionSystem>();
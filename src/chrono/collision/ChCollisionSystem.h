@@ -15,6 +15,10 @@
 #ifndef CH_COLLISIONSYSTEM_H
 #define CH_COLLISIONSYSTEM_H
 
+#include <chrono>
+#include <string>
+#include <vector>
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/ChCollisionInfo.h"
 #include "chrono/core/ChApiCE.h"
@@ -103,6 +107,17 @@ class ChApi ChCollisionSystem {
     /// The default implementation does nothing. Derived classes implement this function as applicable.
     virtual void SetNumThreads(int nthreads) {}
 
+    /// Enable deterministic contact reporting (default: false).
+    /// With multithreaded collision detection, the order in which contacts are generated may vary from run to run.
+    /// Since iterative solvers (e.g., PSOR) are sensitive to the order of the constraints, this leads to results which
+    /// are not reproducible. If enabled, contacts are sorted by a stable key (identifiers of the two collision models
+    /// and indices of the two collision shapes) before being passed to the contact container. The sort is a parallel
+    /// radix sort, with a cost that is small compared to that of the narrowphase.
+    void SetDeterministic(bool val) { m_deterministic = val; }
+
+    /// Return true if deterministic contact reporting is enabled.
+    bool IsDeterministic() const { return m_deterministic; }
+
     /// After the Run() has completed, you can call this function to
     /// fill a 'contact container', that is an object inherited from class
     /// ChContactContainer. For instance ChSystem, after each Run()
@@ -175,6 +190,7 @@ class ChApi ChCollisionSystem {
         ChVector3d abs_hitNormal;    ///< normal to surface in absolute space coordinates
         double dist_factor;          ///< from 0 .. 1 means the distance of hit point along the segment
         ChCollisionModel* hitModel;  ///< pointer to intersected model
+        ChCollisionShape* hitShape;  ///< pointer to intersected shape (null if not identified)
     };
 
     /// Perform a ray-hit test with the collision models.
@@ -186,6 +202,24 @@ class ChApi ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const = 0;
 
+    /// Ray segment for batched ray-hit tests (see RayHitBatch).
+    struct ChRay {
+        ChVector3d from;  ///< ray start point
+        ChVector3d to;    ///< ray end point
+    };
+
+    /// Perform ray-hit tests with the collision models for a batch of rays.
+    /// On return, `results` has the same size as `rays`, with the i-th result corresponding to the i-th ray. The return
+    /// value is the number of rays which hit a collision model. The default implementation calls RayHit() for each ray
+    /// in turn; derived classes provide multithreaded implementations which process consecutive rays in packets (with a
+    /// faster path for rays sharing the same start point, as in lidar emulation). For best performance, order the rays
+    /// so that consecutive rays are spatially coherent.
+    virtual size_t RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const;
+
+    /// Return the number of speculative contacts generated at the last collision detection pass.
+    /// See ReportSpeculativeContacts and ChBody::EnableCCD.
+    unsigned int GetNumSpeculativeContacts() const { return m_num_speculative; }
+
     /// Class to be used as a callback interface for user-defined visualization of collision shapes.
     class ChApi VisualizationCallback {
       public:
@@ -218,6 +252,63 @@ class ChApi ChCollisionSystem {
     /// should implement a no-op if a visualization callback was not specified.
     virtual void Visualize(int flags) {}
 
+    /// Number of collision shape types (size of the narrowphase call table in Stats).
+    static const int num_shape_types = ChCollisionShape::Type::UNKNOWN_SHAPE + 1;
+
+    /// Collision detection statistics (see GetStats).
+    struct ChApi Stats {
+        Stats();
+
+        /// Reset all counters.
+        void Reset();
+
+        /// Return the number of narrowphase tests for the given pair of shape types (in any order).
+        unsigned int GetNarrowphaseCalls(ChCollisionShape::Type typeA, ChCollisionShape::Type typeB) const;
+
+        /// Increment the number of narrowphase tests for the given pair of shape types.
+        void AddNarrowphaseCall(ChCollisionShape::Type typeA, ChCollisionShape::Type typeB);
+
+        unsigned int num_models;             ///< number of collision models (bodies) processed
+        unsigned int num_broadphase_pairs;   ///< pairs with overlapping AABBs not culled by the collision families
+        unsigned int num_filtered_pairs;     ///< pairs with overlapping AABBs culled by the collision family masks
+        unsigned int num_narrowphase_pairs;  ///< pairs processed by the narrowphase
+        unsigned int num_contacts;           ///< contacts generated by the narrowphase
+
+        /// Number of narrowphase tests for each pair of shape types.
+        /// Entry (i,j), with i <= j, counts the tests between shapes of types i and j.
+        unsigned int narrowphase_calls[num_shape_types][num_shape_types];
+
+        /// Occupancy histogram of the broadphase grid (empty if the broadphase does not use a grid).
+        /// Entry i is the number of active bins containing i+1 shapes; the last entry counts all bins with at least as
+        /// many shapes.
+        std::vector<unsigned int> bin_histogram;
+    };
+
+    /// Enable collection of collision detection statistics (default: false).
+    /// If enabled, the statistics are updated at each collision detection pass and can be obtained with GetStats.
+    /// Some of these quantities (e.g., the number of pairs culled by collision families) require additional work and
+    /// therefore statistics collection should be disabled for production runs.
+    void EnableStats(bool val) { m_stats_enabled = val; }
+
+    /// Return the statistics from the last collision detection pass.
+    /// Only available if statistics collection is enabled (see EnableStats).
+    const Stats& GetStats() const { return m_stats; }
+
+    /// Enable recording of the collision detection phase timings (default: false).
+    /// If enabled, the start time and duration of the collision detection phases (e.g., AABB update, broadphase,
+    /// narrowphase, contact reporting) are recorded at each collision detection pass, together with the pair and
+    /// contact counts if statistics collection is also enabled. Recorded events accumulate until ClearTrace is called;
+    /// use WriteTrace to export them.
+    void EnableTrace(bool val);
+
+    /// Write the recorded collision detection events to a JSON file in the Chrome trace event format.
+    /// The resulting file can be loaded in chrome://tracing or in the Perfetto UI (https://ui.perfetto.dev).
+    /// Return false if the file could not be written.
+    bool WriteTrace(const std::string& filename) const;
+
+    /// Discard all recorded trace events.
+    void ClearTrace();
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive_out);
 
@@ -230,7 +321,31 @@ class ChApi ChCollisionSystem {
   protected:
     ChCollisionSystem();
 
+    /// Return the current time (in seconds) relative to the start of the trace.
+    double GetTraceTime() const;
+
+    /// Record the timing of a collision detection phase (no-op if tracing is not enabled).
+    void AddTraceEvent(const char* name, double start, double duration);
+
+    /// Record the current statistics counters (no-op if tracing or statistics collection is not enabled).
+    void AddTraceCounters();
+
+    /// Generate speculative contacts for bodies with continuous collision detection enabled (see ChBody::EnableCCD).
+    /// Derived classes call this function from ReportContacts, before EndAddContact, so that the speculative contacts
+    /// are stored with the regular ones. The step size is that of the associated system. Only bodies which would
+    /// travel more than their collision envelope during the step are processed. The CCD sphere of each such body is
+    /// swept along its velocity over the step (plus the envelope), by casting a ray from the front point of the sphere
+    /// and from a ring of points on its front half, all in a single call to RayHitBatch. For each collision model hit
+    /// by these rays (subject to the collision family filters), a single contact is added for the closest hit, between
+    /// the sphere and the tangent plane at the hit point. The contact distance is positive, so the contact is active
+    /// only if the body would otherwise reach the obstacle during the step. Hits closer than the envelope are
+    /// discarded, as the corresponding contacts are already generated by the narrowphase. The composite contact
+    /// material is obtained from the material of the shape hit by the ray and that of the first shape of the CCD body
+    /// (the first shape of the hit model is used if the collision system cannot identify the hit shape).
+    void ReportSpeculativeContacts(ChContactContainer* container);
+
     bool m_initialized;
+    bool m_deterministic;  ///< sort contacts by a stable key before reporting
 
     ChSystem* m_system;  ///< associated Chrono system
 
@@ -239,6 +354,27 @@ class ChApi ChCollisionSystem {
 
     std::shared_ptr<VisualizationCallback> vis_callback;  ///< user callback for debug visualization
     int m_vis_flags;
+
+    bool m_stats_enabled;  ///< collect collision detection statistics
+    Stats m_stats;         ///< statistics from the last collision detection pass
+
+  private:
+    /// Trace record: timing of a collision detection phase or snapshot of the statistics counters.
+    struct TraceEvent {
+        const char* name;       ///< phase name (nullptr for counters)
+        double start;           ///< start time (seconds since trace start)
+        double duration;        ///< phase duration (seconds)
+        unsigned int count[4];  ///< broadphase pairs, filtered pairs, narrowphase pairs, contacts
+    };
+
+    bool m_trace_enabled;                                       ///< record collision detection phase timings
+    std::chrono::high_resolution_clock::time_point m_trace_t0;  ///< trace start time
+    std::vector<TraceEvent> m_trace;                            ///< recorded trace events
+
+    unsigned int m_num_speculative;          ///< number of speculative contacts from the last CCD pass
+    std::vector<ChBody*> m_ccd_bodies;       ///< bodies swept in the current CCD pass
+    std::vector<ChRay> m_ccd_rays;           ///< rays cast in the current CCD pass
+    std::vector<ChRayhitResult> m_ccd_hits;  ///< ray-hit results in the current CCD pass
 };
 
 /// @} chrono_collision
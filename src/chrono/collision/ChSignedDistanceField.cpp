@@ -0,0 +1,641 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+
+#include "chrono/collision/ChSignedDistanceField.h"
+#include "chrono/core/ChTypes.h"
+#include "chrono/utils/ChUtils.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSignedDistanceField)
+
+// Identifier and format version of distance field files
+static const char sdf_file_magic[8] = {'C', 'H', 'S', 'D', 'F', 0, 0, 0};
+static const unsigned int sdf_file_version = 1;
+
+// -----------------------------------------------------------------------------
+
+// Closest point to p on the triangle (a, b, c) (C. Ericson, Real-Time Collision Detection, Section 5.1.5).
+// Also return the triangle feature containing the closest point: 0 for the face, 1-3 for the vertices a, b, c, and 4-6
+// for the edges ab, bc, ca.
+static ChVector3d ClosestPointTriangle(const ChVector3d& p,
+                                       const ChVector3d& a,
+                                       const ChVector3d& b,
+                                       const ChVector3d& c,
+                                       int& feature) {
+    ChVector3d ab = b - a;
+    ChVector3d ac = c - a;
+    ChVector3d ap = p - a;
+    double d1 = ab ^ ap;
+    double d2 = ac ^ ap;
+    if (d1 <= 0 && d2 <= 0) {
+        feature = 1;
+        return a;
+    }
+
+    ChVector3d bp = p - b;
+    double d3 = ab ^ bp;
+    double d4 = ac ^ bp;
+    if (d3 >= 0 && d4 <= d3) {
+        feature = 2;
+        return b;
+    }
+
+    double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        feature = 4;
+        return a + ab * (d1 / (d1 - d3));
+    }
+
+    ChVector3d cp = p - c;
+    double d5 = ab ^ cp;
+    double d6 = ac ^ cp;
+    if (d6 >= 0 && d5 <= d6) {
+        feature = 3;
+        return c;
+    }
+
+    double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        feature = 6;
+        return a + ac * (d2 / (d2 - d6));
+    }
+
+    double va = d3 * d6 - d5 * d4;
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+        feature = 5;
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    double denom = 1 / (va + vb + vc);
+    feature = 0;
+    return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+// -----------------------------------------------------------------------------
+
+ChSignedDistanceField::ChSignedDistanceField()
+    : m_origin(VNULL), m_cell_size(0), m_band(0), m_cells(0, 0, 0), m_bricks(0, 0, 0), m_key(0) {}
+
+std::shared_ptr<ChSignedDistanceField> ChSignedDistanceField::CreateFromMesh(const ChTriangleMeshConnected& mesh,
+                                                                             double cell_size,
+                                                                             int band,
+                                                                             const std::string& cache_file) {
+    auto sdf = chrono_types::make_shared<ChSignedDistanceField>();
+
+    if (!cache_file.empty() && sdf->Load(cache_file) && sdf->m_key == ComputeKey(mesh, cell_size, band))
+        return sdf;
+
+    sdf->Build(mesh, cell_size, band);
+    if (!cache_file.empty())
+        sdf->Save(cache_file);
+
+    return sdf;
+}
+
+unsigned long long ChSignedDistanceField::ComputeKey(const ChTriangleMeshConnected& mesh, double cell_size, int band) {
+    // FNV-1a hash of the mesh vertices and faces and of the field parameters
+    unsigned long long key = 14695981039346656037ULL;
+    auto hash = [&key](const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            key ^= bytes[i];
+            key *= 1099511628211ULL;
+        }
+    };
+
+    for (const auto& v : mesh.GetCoordsVertices())
+        hash(v.data(), 3 * sizeof(double));
+    for (const auto& f : mesh.GetIndicesVertexes())
+        hash(f.data(), 3 * sizeof(int));
+    hash(&cell_size, sizeof(cell_size));
+    hash(&band, sizeof(band));
+
+    return key;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSignedDistanceField::Build(const ChTriangleMeshConnected& mesh, double cell_size, int band) {
+    const auto& vertices = mesh.GetCoordsVertices();
+    const auto& faces = mesh.GetIndicesVertexes();
+    const int num_faces = (int)faces.size();
+
+    m_cell_size = cell_size;
+    m_band = std::max(band, 2);
+    m_key = ComputeKey(mesh, cell_size, band);
+    m_brick_index.clear();
+    m_brick_value.clear();
+    m_values.clear();
+    m_points.clear();
+
+    if (num_faces == 0)
+        return;
+
+    const double h = m_cell_size;
+    const double band_width = m_band * h;
+
+    // Grid covering the mesh, padded by the narrow band (plus one cell) on all sides
+    ChVector3d mesh_min(+std::numeric_limits<double>::max());
+    ChVector3d mesh_max(-std::numeric_limits<double>::max());
+    for (const auto& v : vertices) {
+        mesh_min = Vmin(mesh_min, v);
+        mesh_max = Vmax(mesh_max, v);
+    }
+    double pad = band_width + h;
+    m_origin = mesh_min - pad;
+    for (int i = 0; i < 3; i++) {
+        m_bricks[i] = (int)std::ceil((mesh_max[i] - mesh_min[i] + 2 * pad) / (brick_cells * h));
+        m_cells[i] = m_bricks[i] * brick_cells;
+    }
+    const int num_bricks = m_bricks.x() * m_bricks.y() * m_bricks.z();
+
+    // Pseudo-normals used to decide the sign of the distance to the closest feature (J.A. Baerentzen and H. Aanaes,
+    // "Signed distance computation using the angle weighted pseudonormal", 2005): face normals, angle-weighted vertex
+    // normals, and edge normals (sum of the normals of the two adjacent faces).
+    std::vector<ChVector3d> vertex_normals(vertices.size(), VNULL);
+    std::map<std::pair<int, int>, ChVector3d> edge_normals;
+    std::vector<ChVector3d> face_normals(num_faces);
+    for (int f = 0; f < num_faces; f++) {
+        const auto& face = faces[f];
+        ChVector3d n = Vcross(vertices[face[1]] - vertices[face[0]], vertices[face[2]] - vertices[face[0]]);
+        n.Normalize();
+        face_normals[f] = n;
+        for (int k = 0; k < 3; k++) {
+            int v0 = face[k];
+            int v1 = face[(k + 1) % 3];
+            int v2 = face[(k + 2) % 3];
+            ChVector3d e1 = (vertices[v1] - vertices[v0]).GetNormalized();
+            ChVector3d e2 = (vertices[v2] - vertices[v0]).GetNormalized();
+            vertex_normals[v0] += n * std::acos(ChClamp(e1 ^ e2, -1.0, 1.0));
+            edge_normals[std::make_pair(std::min(v0, v1), std::max(v0, v1))] += n;
+        }
+    }
+
+    // Pseudo-normals of the features of each face (face, vertices, edges), in the order returned by
+    // ClosestPointTriangle
+    std::vector<std::array<ChVector3d, 7>> feature_normals(num_faces);
+    for (int f = 0; f < num_faces; f++) {
+        const auto& face = faces[f];
+        feature_normals[f][0] = face_normals[f];
+        for (int k = 0; k < 3; k++) {
+            int v0 = face[k];
+            int v1 = face[(k + 1) % 3];
+            feature_normals[f][1 + k] = vertex_normals[v0];
+            feature_normals[f][4 + k] = edge_normals[std::make_pair(std::min(v0, v1), std::max(v0, v1))];
+        }
+    }
+
+    // Find the bricks with nodes within the narrow band of each face. The nodes of brick b are those with indices
+    // b*brick_cells ... (b+1)*brick_cells (along each direction), so that neighboring bricks share boundary nodes.
+    std::vector<std::vector<int>> brick_faces(num_bricks);
+    for (int f = 0; f < num_faces; f++) {
+        const auto& face = faces[f];
+        ChVector3d fmin = Vmin(vertices[face[0]], Vmin(vertices[face[1]], vertices[face[2]]));
+        ChVector3d fmax = Vmax(vertices[face[0]], Vmax(vertices[face[1]], vertices[face[2]]));
+        int blo[3];
+        int bhi[3];
+        for (int i = 0; i < 3; i++) {
+            int lo = ChClamp((int)std::floor((fmin[i] - band_width - m_origin[i]) / h), 0, m_cells[i]);
+            int hi = ChClamp((int)std::ceil((fmax[i] + band_width - m_origin[i]) / h), 0, m_cells[i]);
+            blo[i] = std::max(0, (lo - 1) / brick_cells);
+            bhi[i] = std::min(m_bricks[i] - 1, hi / brick_cells);
+        }
+        for (int bk = blo[2]; bk <= bhi[2]; bk++)
+            for (int bj = blo[1]; bj <= bhi[1]; bj++)
+                for (int bi = blo[0]; bi <= bhi[0]; bi++)
+                    brick_faces[(bk * m_bricks.y() + bj) * m_bricks.x() + bi].push_back(f);
+    }
+
+    std::vector<int> band_bricks;
+    for (int b = 0; b < num_bricks; b++) {
+        if (!brick_faces[b].empty())
+            band_bricks.push_back(b);
+    }
+    const int num_band_bricks = (int)band_bricks.size();
+
+    // Nodal values of the candidate band bricks.
+    // A nodal distance within the band is exact, as all faces within the band of that node were tested. The sign of
+    // any other node is propagated from its nearest (in the grid graph) node within the band, and its value is
+    // clamped to the band width. Bricks without any node within the band are discarded.
+    std::vector<float> values((size_t)num_band_bricks * brick_num_nodes);
+    std::vector<char> in_band(num_band_bricks, 0);
+
+#pragma omp parallel for schedule(dynamic)
+    for (int k = 0; k < num_band_bricks; k++) {
+        int b = band_bricks[k];
+        int bi = b % m_bricks.x();
+        int bj = (b / m_bricks.x()) % m_bricks.y();
+        int bk = b / (m_bricks.x() * m_bricks.y());
+        float* v = &values[(size_t)k * brick_num_nodes];
+
+        std::vector<char> known(brick_num_nodes, 0);
+        std::vector<int> queue;
+        queue.reserve(brick_num_nodes);
+
+        for (int n = 0; n < brick_num_nodes; n++) {
+            int ni = n % brick_nodes;
+            int nj = (n / brick_nodes) % brick_nodes;
+            int nk = n / (brick_nodes * brick_nodes);
+            ChVector3d node(bi * brick_cells + ni, bj * brick_cells + nj, bk * brick_cells + nk);
+            ChVector3d p = m_origin + node * h;
+
+            double dist2 = std::numeric_limits<double>::max();
+            ChVector3d closest;
+            int closest_face = -1;
+            int closest_feature = 0;
+            for (auto f : brick_faces[b]) {
+                const auto& face = faces[f];
+                int feature;
+                ChVector3d c =
+                    ClosestPointTriangle(p, vertices[face[0]], vertices[face[1]], vertices[face[2]], feature);
+                double d2 = (p - c).Length2();
+                if (d2 < dist2) {
+                    dist2 = d2;
+                    closest = c;
+                    closest_face = f;
+                    closest_feature = feature;
+                }
+            }
+
+            double dist = std::sqrt(dist2);
+            if (dist <= band_width) {
+                bool outside = ((p - closest) ^ feature_normals[closest_face][closest_feature]) >= 0;
+                v[n] = (float)(outside ? dist : -dist);
+                known[n] = 1;
+                queue.push_back(n);
+            }
+        }
+
+        if (queue.empty())
+            continue;
+        in_band[k] = 1;
+
+        // Breadth-first propagation of the sign from the nodes within the band
+        static const int offsets[3] = {1, brick_nodes, brick_nodes * brick_nodes};
+        for (size_t q = 0; q < queue.size(); q++) {
+            int n = queue[q];
+            int idx[3] = {n % brick_nodes, (n / brick_nodes) % brick_nodes, n / (brick_nodes * brick_nodes)};
+            for (int i = 0; i < 3; i++) {
+                for (int s = -1; s <= 1; s += 2) {
+                    if (idx[i] + s < 0 || idx[i] + s >= brick_nodes)
+                        continue;
+                    int m = n + s * offsets[i];
+                    if (known[m])
+                        continue;
+                    v[m] = (float)(v[n] < 0 ? -band_width : band_width);
+                    known[m] = 1;
+                    queue.push_back(m);
+                }
+            }
+        }
+    }
+
+    // Compact storage of the band bricks
+    m_brick_index.assign(num_bricks, -1);
+    m_brick_value.assign(num_bricks, 0);
+    int num_active = 0;
+    for (int k = 0; k < num_band_bricks; k++) {
+        if (in_band[k])
+            m_brick_index[band_bricks[k]] = num_active++;
+    }
+    m_values.resize((size_t)num_active * brick_num_nodes);
+    for (int k = 0; k < num_band_bricks; k++) {
+        if (in_band[k])
+            std::memcpy(&m_values[(size_t)m_brick_index[band_bricks[k]] * brick_num_nodes],
+                        &values[(size_t)k * brick_num_nodes], brick_num_nodes * sizeof(float));
+    }
+
+    // Constant value of the bricks outside the band. Each connected set of such bricks is either inside or outside
+    // the mesh; decide using the sign at the center of a face shared with an adjacent band brick.
+    std::vector<char> visited(num_bricks, 0);
+    std::vector<int> component;
+    for (int b0 = 0; b0 < num_bricks; b0++) {
+        if (m_brick_index[b0] >= 0 || visited[b0])
+            continue;
+
+        float sign = 0;
+        component.clear();
+        component.push_back(b0);
+        visited[b0] = 1;
+        for (size_t c = 0; c < component.size(); c++) {
+            int b = component[c];
+            int idx[3] = {b % m_bricks.x(), (b / m_bricks.x()) % m_bricks.y(), b / (m_bricks.x() * m_bricks.y())};
+            for (int i = 0; i < 3; i++) {
+                for (int s = -1; s <= 1; s += 2) {
+                    int nidx[3] = {idx[0], idx[1], idx[2]};
+                    nidx[i] += s;
+                    if (nidx[i] < 0 || nidx[i] >= m_bricks[i])
+                        continue;
+                    int nb = (nidx[2] * m_bricks.y() + nidx[1]) * m_bricks.x() + nidx[0];
+                    if (m_brick_index[nb] >= 0) {
+                        if (sign == 0) {
+                            int node[3] = {brick_cells / 2, brick_cells / 2, brick_cells / 2};
+                            node[i] = (s > 0) ? 0 : brick_cells;
+                            int n = (node[2] * brick_nodes + node[1]) * brick_nodes + node[0];
+                            sign = m_values[(size_t)m_brick_index[nb] * brick_num_nodes + n] < 0 ? -1.0f : 1.0f;
+                        }
+                    } else if (!visited[nb]) {
+                        visited[nb] = 1;
+                        component.push_back(nb);
+                    }
+                }
+            }
+        }
+
+        float value = (float)(sign < 0 ? -band_width : band_width);
+        for (auto b : component)
+            m_brick_value[b] = value;
+    }
+
+    // Points on the mesh surface: vertices, plus points sampled on edges and faces with a spacing of about 2 cells
+    double spacing = 2 * h;
+    m_points = vertices;
+    for (const auto& edge : edge_normals) {
+        const ChVector3d& a = vertices[edge.first.first];
+        const ChVector3d& b = vertices[edge.first.second];
+        int n = (int)std::ceil((b - a).Length() / spacing);
+        for (int s = 1; s < n; s++)
+            m_points.push_back(a + (b - a) * ((double)s / n));
+    }
+    for (int f = 0; f < num_faces; f++) {
+        const ChVector3d& a = vertices[faces[f][0]];
+        const ChVector3d& b = vertices[faces[f][1]];
+        const ChVector3d& c = vertices[faces[f][2]];
+        double len = std::max((b - a).Length(), std::max((c - b).Length(), (a - c).Length()));
+        int n = (int)std::ceil(len / spacing);
+        for (int i = 1; i < n; i++)
+            for (int j = 1; i + j < n; j++)
+                m_points.push_back((a * i + b * j + c * (n - i - j)) / n);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+bool ChSignedDistanceField::Evaluate(const ChVector3d& point, double& dist, ChVector3d& grad) const {
+    grad = VNULL;
+    dist = GetBandWidth();
+    if (IsEmpty())
+        return false;
+
+    // Enclosing cell and local coordinates in that cell
+    ChVector3d q = (point - m_origin) / m_cell_size;
+    int cell[3];
+    double f[3];
+    for (int i = 0; i < 3; i++) {
+        if (q[i] < 0 || q[i] > m_cells[i])
+            return false;
+        cell[i] = std::min((int)q[i], m_cells[i] - 1);
+        f[i] = q[i] - cell[i];
+    }
+
+    // Enclosing brick and cell index in that brick
+    int brick[3];
+    int local[3];
+    for (int i = 0; i < 3; i++) {
+        brick[i] = cell[i] / brick_cells;
+        local[i] = cell[i] - brick[i] * brick_cells;
+    }
+    int b = (brick[2] * m_bricks.y() + brick[1]) * m_bricks.x() + brick[0];
+    int slot = m_brick_index[b];
+    if (slot < 0) {
+        dist = m_brick_value[b];
+        return false;
+    }
+
+    // Values at the cell nodes
+    const float* v = &m_values[(size_t)slot * brick_num_nodes];
+    int n000 = (local[2] * brick_nodes + local[1]) * brick_nodes + local[0];
+    const int dx = 1;
+    const int dy = brick_nodes;
+    const int dz = brick_nodes * brick_nodes;
+    double v000 = v[n000];
+    double v100 = v[n000 + dx];
+    double v010 = v[n000 + dy];
+    double v110 = v[n000 + dx + dy];
+    double v001 = v[n000 + dz];
+    double v101 = v[n000 + dx + dz];
+    double v011 = v[n000 + dy + dz];
+    double v111 = v[n000 + dx + dy + dz];
+
+    // Trilinear interpolation
+    double v00 = v000 + (v100 - v000) * f[0];
+    double v10 = v010 + (v110 - v010) * f[0];
+    double v01 = v001 + (v101 - v001) * f[0];
+    double v11 = v011 + (v111 - v011) * f[0];
+    double v0 = v00 + (v10 - v00) * f[1];
+    double v1 = v01 + (v11 - v01) * f[1];
+    dist = v0 + (v1 - v0) * f[2];
+
+    // Gradient of the trilinear interpolant
+    double gx = (v100 - v000) * (1 - f[1]) * (1 - f[2]) + (v110 - v010) * f[1] * (1 - f[2]) +
+                (v101 - v001) * (1 - f[1]) * f[2] + (v111 - v011) * f[1] * f[2];
+    double gy = (v10 - v00) * (1 - f[2]) + (v11 - v01) * f[2];
+    double gz = v1 - v0;
+    grad = ChVector3d(gx, gy, gz) / m_cell_size;
+
+    return true;
+}
+
+bool ChSignedDistanceField::EvaluateSphere(const ChVector3d& center,
+                                           double radius,
+                                           double separation,
+                                           double& dist,
+                                           ChVector3d& normal) const {
+    ChVector3d grad;
+    bool in_band = Evaluate(center, dist, grad);
+    double grad_len = grad.Length();
+    if (in_band && grad_len >= 1e-8) {
+        normal = grad / grad_len;
+        return dist - radius < separation;
+    }
+
+    // The center is outside the narrow band, where the field is clamped to plus or minus the band width.
+    // A sphere centered outside the mesh can only reach the separation distance if it is larger than the band.
+    if (m_points.empty() || (dist > 0 && GetBandWidth() - radius >= separation))
+        return false;
+
+    // Closest surface point
+    double min_dist2 = std::numeric_limits<double>::max();
+    ChVector3d closest;
+    for (const auto& p : m_points) {
+        double dist2 = (p - center).Length2();
+        if (dist2 < min_dist2) {
+            min_dist2 = dist2;
+            closest = p;
+        }
+    }
+    double len = std::sqrt(min_dist2);
+    if (len < 1e-12)
+        return false;
+
+    // Center deep inside the mesh: use the closest surface point
+    if (dist < 0) {
+        dist = -len;
+        normal = (closest - center) / len;
+        return true;
+    }
+
+    // Center outside the mesh: sample the field at the sphere point closest to the surface, refining the direction
+    // with the field gradient at that point
+    normal = (center - closest) / len;
+    bool found = false;
+    for (int iter = 0; iter < 3; iter++) {
+        double d;
+        if (!Evaluate(center - normal * radius, d, grad))
+            break;
+        double glen = grad.Length();
+        if (glen < 1e-8)
+            break;
+        dist = d + radius;
+        normal = grad / glen;
+        found = true;
+    }
+
+    return found && dist - radius < separation;
+}
+
+double ChSignedDistanceField::GetDistance(const ChVector3d& point) const {
+    double dist;
+    ChVector3d grad;
+    Evaluate(point, dist, grad);
+    return dist;
+}
+
+ChAABB ChSignedDistanceField::GetBoundingBox() const {
+    return ChAABB(m_origin, m_origin + ChVector3d(m_cells.x(), m_cells.y(), m_cells.z()) * m_cell_size);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+static void WriteArray(std::ofstream& stream, const std::vector<T>& v) {
+    unsigned long long size = v.size();
+    stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    if (size > 0)
+        stream.write(reinterpret_cast<const char*>(v.data()), size * sizeof(T));
+}
+
+template <typename T>
+static bool ReadArray(std::ifstream& stream, std::vector<T>& v) {
+    unsigned long long size = 0;
+    stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (!stream)
+        return false;
+    v.resize(size);
+    if (size > 0)
+        stream.read(reinterpret_cast<char*>(v.data()), size * sizeof(T));
+    return (bool)stream;
+}
+
+bool ChSignedDistanceField::Save(const std::string& filename) const {
+    std::ofstream stream(filename, std::ios::binary);
+    if (!stream)
+        return false;
+
+    stream.write(sdf_file_magic, sizeof(sdf_file_magic));
+    stream.write(reinterpret_cast<const char*>(&sdf_file_version), sizeof(sdf_file_version));
+    stream.write(reinterpret_cast<const char*>(&m_key), sizeof(m_key));
+    stream.write(reinterpret_cast<const char*>(m_origin.data()), 3 * sizeof(double));
+    stream.write(reinterpret_cast<const char*>(&m_cell_size), sizeof(m_cell_size));
+    stream.write(reinterpret_cast<const char*>(&m_band), sizeof(m_band));
+    stream.write(reinterpret_cast<const char*>(m_cells.data()), 3 * sizeof(int));
+    stream.write(reinterpret_cast<const char*>(m_bricks.data()), 3 * sizeof(int));
+    WriteArray(stream, m_brick_index);
+    WriteArray(stream, m_brick_value);
+    WriteArray(stream, m_values);
+    WriteArray(stream, m_points);
+
+    return (bool)stream;
+}
+
+bool ChSignedDistanceField::Load(const std::string& filename) {
+    std::ifstream stream(filename, std::ios::binary);
+    if (!stream)
+        return false;
+
+    char magic[sizeof(sdf_file_magic)];
+    unsigned int version = 0;
+    stream.read(magic, sizeof(magic));
+    stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!stream || std::memcmp(magic, sdf_file_magic, sizeof(magic)) != 0 || version != sdf_file_version)
+        return false;
+
+    stream.read(reinterpret_cast<char*>(&m_key), sizeof(m_key));
+    stream.read(reinterpret_cast<char*>(m_origin.data()), 3 * sizeof(double));
+    stream.read(reinterpret_cast<char*>(&m_cell_size), sizeof(m_cell_size));
+    stream.read(reinterpret_cast<char*>(&m_band), sizeof(m_band));
+    stream.read(reinterpret_cast<char*>(m_cells.data()), 3 * sizeof(int));
+    stream.read(reinterpret_cast<char*>(m_bricks.data()), 3 * sizeof(int));
+    bool ok = (bool)stream;
+    ok = ok && ReadArray(stream, m_brick_index);
+    ok = ok && ReadArray(stream, m_brick_value);
+    ok = ok && ReadArray(stream, m_values);
+    ok = ok && ReadArray(stream, m_points);
+
+    if (!ok || m_brick_index.size() != (size_t)m_bricks.x() * m_bricks.y() * m_bricks.z()) {
+        m_brick_index.clear();
+        m_brick_value.clear();
+        m_values.clear();
+        m_points.clear();
+        return false;
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSignedDistanceField::ArchiveOut(ChArchiveOut& archive_out) {
+    // version number
+    archive_out.VersionWrite<ChSignedDistanceField>();
+    // serialize all member data:
+    archive_out << CHNVP(m_origin);
+    archive_out << CHNVP(m_cell_size);
+    archive_out << CHNVP(m_band);
+    archive_out << CHNVP(m_cells);
+    archive_out << CHNVP(m_bricks);
+    archive_out << CHNVP(m_key);
+    archive_out << CHNVP(m_brick_index);
+    archive_out << CHNVP(m_brick_value);
+    archive_out << CHNVP(m_values);
+    archive_out << CHNVP(m_points);
+}
+
+void ChSignedDistanceField::ArchiveIn(ChArchiveIn& archive_in) {
+    // version number
+    /*int version =*/archive_in.VersionRead<ChSignedDistanceField>();
+    // stream in all member data:
+    archive_in >> CHNVP(m_origin);
+    archive_in >> CHNVP(m_cell_size);
+    archive_in >> CHNVP(m_band);
+    archive_in >> CHNVP(m_cells);
+    archive_in >> CHNVP(m_bricks);
+    archive_in >> CHNVP(m_key);
+    archive_in >> CHNVP(m_brick_index);
+    archive_in >> CHNVP(m_brick_value);
+    archive_in >> CHNVP(m_values);
+    archive_in >> CHNVP(m_points);
+}
+
+}  // end namespace chrono
@@ -0,0 +1,142 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_SIGNED_DISTANCE_FIELD_H
+#define CH_SIGNED_DISTANCE_FIELD_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChVector3.h"
+#include "chrono/geometry/ChGeometry.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/serialization/ChArchive.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_collision
+/// @{
+
+/// Sparse signed distance field of a closed triangle mesh.\n
+/// The field is sampled at the nodes of a regular grid covering the mesh, in the mesh frame. The grid is partitioned
+/// in bricks of 8x8x8 cells and nodal values are stored only for the bricks within a narrow band around the mesh
+/// surface; every other brick stores a single value (plus or minus the band width, for bricks outside or inside the
+/// mesh, respectively). Distances are positive outside the mesh.\n
+/// Inside the narrow band, the distance and its gradient at any point are obtained with a trilinear interpolation of
+/// the values at the nodes of the enclosing cell. The field also stores a set of points on the mesh surface (vertices
+/// and points sampled on edges and faces) used when testing the mesh against another distance field.\n
+/// A distance field is expensive to build and is typically constructed once, offline, and then cached on disk (see
+/// CreateFromMesh).
+class ChApi ChSignedDistanceField {
+  public:
+    ChSignedDistanceField();
+    ~ChSignedDistanceField() {}
+
+    /// Create the distance field of the given mesh, using a cache file if provided.
+    /// If the cache file exists and was created for the same mesh and with the same parameters, the field is loaded
+    /// from it. Otherwise, the field is built and, if a file name was provided, saved to the cache file.
+    static std::shared_ptr<ChSignedDistanceField> CreateFromMesh(const ChTriangleMeshConnected& mesh,
+                                                                 double cell_size,
+                                                                 int band = 3,
+                                                                 const std::string& cache_file = "");
+
+    /// Build the distance field of the given mesh.
+    /// The mesh must be closed, with consistently oriented faces (outward normals). The narrow band in which exact
+    /// distances are stored is specified in number of grid cells (at least 2).
+    void Build(const ChTriangleMeshConnected& mesh,  ///< closed triangle mesh
+               double cell_size,                     ///< grid cell size
+               int band = 3                          ///< half-width of narrow band (number of cells)
+    );
+
+    /// Save the distance field to a binary file.
+    bool Save(const std::string& filename) const;
+
+    /// Load the distance field from a binary file created with Save.
+    bool Load(const std::string& filename);
+
+    /// Return true if the distance field was not built or loaded.
+    bool IsEmpty() const { return m_brick_index.empty(); }
+
+    /// Evaluate the distance field and its gradient at the given point (expressed in the mesh frame).
+    /// Return false if the point is outside the grid or outside the narrow band. In the latter case, 'dist' is set to
+    /// plus or minus the band width and the gradient is zero.
+    bool Evaluate(const ChVector3d& point, double& dist, ChVector3d& grad) const;
+
+    /// Evaluate the distance field and its normalized gradient at the center of a sphere (expressed in the mesh frame).
+    /// For a sphere centered outside the narrow band but large enough to reach the mesh surface, the field is instead
+    /// sampled at the sphere point closest to the surface (found from the closest surface point) and 'dist' is the
+    /// corresponding estimate of the distance at the sphere center. Return false if the sphere surface is farther than
+    /// 'separation' from the mesh surface or if the field cannot be evaluated.
+    bool EvaluateSphere(const ChVector3d& center, double radius, double separation, double& dist, ChVector3d& normal)
+        const;
+
+    /// Evaluate the distance field at the given point (expressed in the mesh frame).
+    /// The returned value is clamped to the band width.
+    double GetDistance(const ChVector3d& point) const;
+
+    /// Get the grid bounding box (in the mesh frame).
+    ChAABB GetBoundingBox() const;
+
+    /// Get the grid cell size.
+    double GetCellSize() const { return m_cell_size; }
+
+    /// Get the half-width of the narrow band.
+    double GetBandWidth() const { return m_band * m_cell_size; }
+
+    /// Get the points sampled on the mesh surface (in the mesh frame).
+    const std::vector<ChVector3d>& GetSurfacePoints() const { return m_points; }
+
+    /// Get the total number of grid bricks.
+    size_t GetNumBricks() const { return m_brick_index.size(); }
+
+    /// Get the number of bricks with stored nodal values.
+    size_t GetNumActiveBricks() const { return m_values.size() / brick_num_nodes; }
+
+    /// Method to allow serialization of transient data to archives.
+    void ArchiveOut(ChArchiveOut& archive_out);
+
+    /// Method to allow de-serialization of transient data from archives.
+    void ArchiveIn(ChArchiveIn& archive_in);
+
+    static constexpr int brick_cells = 8;                ///< number of cells per brick side
+    static constexpr int brick_nodes = brick_cells + 1;  ///< number of nodes per brick side
+    static constexpr int brick_num_nodes = brick_nodes * brick_nodes * brick_nodes;  ///< number of nodes per brick
+
+  private:
+    /// Calculate a key identifying the given mesh and the field parameters (used to validate cache files).
+    static unsigned long long ComputeKey(const ChTriangleMeshConnected& mesh, double cell_size, int band);
+
+    ChVector3d m_origin;       ///< lower corner of the grid
+    double m_cell_size;        ///< grid cell size
+    int m_band;                ///< half-width of the narrow band (number of cells)
+    ChVector3i m_cells;        ///< number of grid cells in each direction (multiple of brick_cells)
+    ChVector3i m_bricks;       ///< number of bricks in each direction
+    unsigned long long m_key;  ///< key of the mesh and parameters used to build the field
+
+    std::vector<int> m_brick_index;    ///< index of the nodal values of each brick (-1 for bricks outside the band)
+    std::vector<float> m_brick_value;  ///< constant value for bricks outside the band
+    std::vector<float> m_values;       ///< nodal values of bricks in the band (brick_num_nodes per brick)
+
+    std::vector<ChVector3d> m_points;  ///< points sampled on the mesh surface
+};
+
+CH_CLASS_VERSION(ChSignedDistanceField, 0)
+
+/// @} chrono_collision
+
+}  // end namespace chrono
+
+#endif
@@ -69,6 +69,9 @@ enum BroadphaseNativeTypes
 	// for 2d collision between polylines
     ARC_SHAPE_PROXYTYPE,          /* ***CHRONO*** */
     SEGMENT_SHAPE_PROXYTYPE,      /* ***CHRONO*** */
+
+    // signed distance field shapes
+    CE_SDF_SHAPE_PROXYTYPE,       /* ***CHRONO*** */
     
     // Used for GIMPACT Trimesh integration
 	GIMPACT_SHAPE_PROXYTYPE,
@@ -33,6 +33,7 @@ subject to the following restrictions:
 #include "BulletCollision/CollisionShapes/cbtCEtriangleShape.h" //***CHRONO***
 #include "LinearMath/cbtAabbUtil2.h"
 #include "LinearMath/cbtQuickprof.h"
+#include "LinearMath/cbtThreads.h"  //***CHRONO***
 #include "LinearMath/cbtSerializer.h"
 #include "BulletCollision/CollisionShapes/cbtConvexPolyhedron.h"
 #include "BulletCollision/CollisionDispatch/cbtCollisionObjectWrapper.h"
@@ -154,6 +155,12 @@ void cbtCollisionWorld::addCollisionObject(cbtCollisionObject* collisionObject,
 void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 {
 	cbtVector3 minAabb, maxAabb;
+	computeSingleAabb(colObj, minAabb, maxAabb);
+	setSingleAabb(colObj, minAabb, maxAabb);
+}
+
+void cbtCollisionWorld::computeSingleAabb(cbtCollisionObject* colObj, cbtVector3& minAabb, cbtVector3& maxAabb)
+{
 	colObj->getCollisionShape()->getAabb(colObj->getWorldTransform(), minAabb, maxAabb);
 	//need to increase the aabb for contact thresholds
 	cbtVector3 contactThreshold(gContactBreakingThreshold, gContactBreakingThreshold, gContactBreakingThreshold);
@@ -170,7 +177,10 @@ void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 		minAabb.setMin(minAabb2);
 		maxAabb.setMax(maxAabb2);
 	}
+}
 
+void cbtCollisionWorld::setSingleAabb(cbtCollisionObject* colObj, const cbtVector3& minAabb, const cbtVector3& maxAabb)
+{
 	cbtBroadphaseInterface* bp = (cbtBroadphaseInterface*)m_broadphasePairCache;
 
 	//moving objects should be moderately sized, probably something wrong if not
@@ -196,12 +206,47 @@ void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 	}
 }
 
+/* ***CHRONO*** Concurrent computation of collision object AABBs */
+struct UpdateAabbsLoop : public cbtIParallelForBody
+{
+	cbtCollisionWorld* mWorld;
+	cbtCollisionObject** mObjects;
+	cbtVector3* mMin;
+	cbtVector3* mMax;
+	bool mForceUpdateAll;
+
+	void forLoop(int iBegin, int iEnd) const BT_OVERRIDE
+	{
+		for (int i = iBegin; i < iEnd; i++)
+		{
+			cbtCollisionObject* colObj = mObjects[i];
+			if (mForceUpdateAll || colObj->isActive())
+				mWorld->computeSingleAabb(colObj, mMin[i], mMax[i]);
+		}
+	}
+};
+
 void cbtCollisionWorld::updateAabbs()
 {
 	BT_PROFILE("updateAabbs");
 
-	cbtTransform predictedTrans;
-	for (int i = 0; i < m_collisionObjects.size(); i++)
+	/* ***CHRONO*** Compute AABBs concurrently, then update the broadphase (not thread-safe) sequentially */
+	int numObjects = m_collisionObjects.size();
+	if (numObjects == 0)
+		return;
+
+	m_aabbMin.resizeNoInitialize(numObjects);
+	m_aabbMax.resizeNoInitialize(numObjects);
+
+	UpdateAabbsLoop loop;
+	loop.mWorld = this;
+	loop.mObjects = &m_collisionObjects[0];
+	loop.mMin = &m_aabbMin[0];
+	loop.mMax = &m_aabbMax[0];
+	loop.mForceUpdateAll = m_forceUpdateAllAabbs;
+	cbtParallelFor(0, numObjects, 256, loop);
+
+	for (int i = 0; i < numObjects; i++)
 	{
 		cbtCollisionObject* colObj = m_collisionObjects[i];
 		cbtAssert(colObj->getWorldArrayIndex() == i);
@@ -209,7 +254,7 @@ void cbtCollisionWorld::updateAabbs()
 		//only update aabb of active objects
 		if (m_forceUpdateAllAabbs || colObj->isActive())
 		{
-			updateSingleAabb(colObj);
+			setSingleAabb(colObj, m_aabbMin[i], m_aabbMax[i]);
 		}
 	}
 }
@@ -102,6 +102,10 @@ protected:
 	///it is true by default, because it is error-prone (setting the position of static objects wouldn't update their AABB)
 	bool m_forceUpdateAllAabbs;
 
+	/* ***CHRONO*** AABBs computed concurrently in updateAabbs, before updating the broadphase */
+	cbtAlignedObjectArray<cbtVector3> m_aabbMin;
+	cbtAlignedObjectArray<cbtVector3> m_aabbMax;
+
 	void serializeCollisionObjects(cbtSerializer* serializer);
 
 	void serializeContactManifolds(cbtSerializer* serializer);
@@ -144,6 +148,12 @@ public:
 
 	void updateSingleAabb(cbtCollisionObject* colObj);
 
+	/* ***CHRONO*** Compute the (inflated) AABB of a collision object, without updating the broadphase */
+	void computeSingleAabb(cbtCollisionObject* colObj, cbtVector3& minAabb, cbtVector3& maxAabb);
+
+	/* ***CHRONO*** Update the broadphase with a precomputed AABB of a collision object */
+	void setSingleAabb(cbtCollisionObject* colObj, const cbtVector3& minAabb, const cbtVector3& maxAabb);
+
 	virtual void updateAabbs();
 
 	///the computeOverlappingPairs is usually already called by performDiscreteCollisionDetection (or stepSimulation)
@@ -0,0 +1,48 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Bullet collision shape wrapping a Chrono signed distance field.
+//
+// =============================================================================
+
+#include "cbtCEsdfShape.h"
+#include "LinearMath/cbtAabbUtil2.h"
+
+using namespace chrono;
+
+cbtCEsdfShape::cbtCEsdfShape(const ChSignedDistanceField* mfield, cbtScalar menvelope)
+    : field(mfield), envelope(menvelope), localScaling(1, 1, 1) {
+    m_shapeType = CE_SDF_SHAPE_PROXYTYPE;
+}
+
+void cbtCEsdfShape::getAabb(const cbtTransform& t, cbtVector3& aabbMin, cbtVector3& aabbMax) const {
+    ChAABB bbox = field->GetBoundingBox();
+    cbtVector3 localMin((cbtScalar)bbox.min.x(), (cbtScalar)bbox.min.y(), (cbtScalar)bbox.min.z());
+    cbtVector3 localMax((cbtScalar)bbox.max.x(), (cbtScalar)bbox.max.y(), (cbtScalar)bbox.max.z());
+    cbtTransformAabb(localMin, localMax, envelope, t, aabbMin, aabbMax);
+}
+
+void cbtCEsdfShape::calculateLocalInertia(cbtScalar mass, cbtVector3& inertia) const {
+    // as an approximation, take the inertia of the grid bounding box
+    ChVector3d size = field->GetBoundingBox().Size();
+
+    const cbtScalar x2 = (cbtScalar)(size.x() * size.x());
+    const cbtScalar y2 = (cbtScalar)(size.y() * size.y());
+    const cbtScalar z2 = (cbtScalar)(size.z() * size.z());
+    const cbtScalar scaledmass = mass * cbtScalar(.08333333);
+
+    inertia[0] = scaledmass * (y2 + z2);
+    inertia[1] = scaledmass * (x2 + z2);
+    inertia[2] = scaledmass * (x2 + y2);
+}
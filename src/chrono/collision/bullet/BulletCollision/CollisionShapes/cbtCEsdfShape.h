@@ -0,0 +1,63 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Bullet collision shape wrapping a Chrono signed distance field.
+//
+// =============================================================================
+
+#ifndef BT_CE_SDF_SHAPE_H
+#define BT_CE_SDF_SHAPE_H
+
+#include "cbtConcaveShape.h"
+#include "BulletCollision/BroadphaseCollision/cbtBroadphaseProxy.h"  // for the types
+#include "LinearMath/cbtVector3.h"
+#include "chrono/collision/ChSignedDistanceField.h"
+
+/// cbtCEsdfShape represents a rigid shape described by a (sparse) signed distance field.
+/// The shape does not provide triangles nor support functions: collisions are handled by dedicated algorithms which
+/// sample the distance field (see cbtSDFCollisionAlgorithm). Pairs without such an algorithm produce no contacts.
+/// The distance field is shared (not owned) with the Chrono collision shape.
+
+class cbtCEsdfShape : public cbtConcaveShape {
+  private:
+    const chrono::ChSignedDistanceField* field;
+    cbtScalar envelope;
+    cbtVector3 localScaling;
+
+  public:
+    cbtCEsdfShape(const chrono::ChSignedDistanceField* mfield, cbtScalar menvelope);
+
+    /// CollisionShape Interface
+    virtual void getAabb(const cbtTransform& t, cbtVector3& aabbMin, cbtVector3& aabbMax) const;
+
+    virtual void calculateLocalInertia(cbtScalar mass, cbtVector3& inertia) const;
+
+    virtual void setLocalScaling(const cbtVector3& scaling) { localScaling = scaling; }
+    virtual const cbtVector3& getLocalScaling() const { return localScaling; }
+
+    virtual const char* getName() const { return "CEsdfShape"; }
+
+    /// cbtConcaveShape Interface (no triangles are reported)
+    virtual void processAllTriangles(cbtTriangleCallback* callback,
+                                     const cbtVector3& aabbMin,
+                                     const cbtVector3& aabbMax) const {}
+
+    /// access the distance field
+    const chrono::ChSignedDistanceField* getField() const { return field; }
+
+    /// collision envelope around the zero level set
+    cbtScalar getEnvelope() const { return envelope; }
+};
+
+#endif
@@ -25,6 +25,7 @@
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbtCapsuleShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbt2DShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbtCEtriangleShape.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbtCEsdfShape.h"
 
 namespace chrono {
 
@@ -1564,4 +1565,245 @@ cbtCollisionAlgorithm* cbtCEtriangleShapeCollisionAlgorithm::CreateFunc::CreateC
     }
 }
 
+// ================================================================================================
+
+cbtSDFCollisionAlgorithm::cbtSDFCollisionAlgorithm(cbtPersistentManifold* mf,
+                                                   const cbtCollisionAlgorithmConstructionInfo& ci,
+                                                   const cbtCollisionObjectWrapper* col0,
+                                                   const cbtCollisionObjectWrapper* col1,
+                                                   bool isSwapped)
+    : cbtActivatingCollisionAlgorithm(ci, col0, col1), m_ownManifold(false), m_manifoldPtr(mf), m_isSwapped(isSwapped) {
+    const cbtCollisionObjectWrapper* sdfObjWrap = m_isSwapped ? col1 : col0;
+    const cbtCollisionObjectWrapper* otherObjWrap = m_isSwapped ? col0 : col1;
+
+    if (!m_manifoldPtr &&
+        m_dispatcher->needsCollision(sdfObjWrap->getCollisionObject(), otherObjWrap->getCollisionObject())) {
+        m_manifoldPtr =
+            m_dispatcher->getNewManifold(sdfObjWrap->getCollisionObject(), otherObjWrap->getCollisionObject());
+        m_ownManifold = true;
+    }
+}
+
+cbtSDFCollisionAlgorithm::cbtSDFCollisionAlgorithm(const cbtCollisionAlgorithmConstructionInfo& ci)
+    : cbtActivatingCollisionAlgorithm(ci) {}
+
+cbtSDFCollisionAlgorithm::~cbtSDFCollisionAlgorithm() {
+    if (m_ownManifold) {
+        if (m_manifoldPtr)
+            m_dispatcher->releaseManifold(m_manifoldPtr);
+    }
+}
+
+// Sample the distance field at the given point (expressed in the field frame).
+// Return false if the point is outside the narrow band or if the gradient cannot be normalized.
+static bool SampleSDF(const ChSignedDistanceField* field, const cbtVector3& p, cbtScalar& dist, cbtVector3& grad) {
+    double d;
+    ChVector3d g;
+    if (!field->Evaluate(ChVector3d(p.x(), p.y(), p.z()), d, g))
+        return false;
+    double len = g.Length();
+    if (len < 1e-8)
+        return false;
+    dist = (cbtScalar)d;
+    grad = cbtVector3((cbtScalar)(g.x() / len), (cbtScalar)(g.y() / len), (cbtScalar)(g.z() / len));
+    return true;
+}
+
+// Check and add contact between the field (object A) and a sphere of given radius (on object B).
+// The sphere center is expressed in the field frame.
+static int addSDFContactPoint(const ChSignedDistanceField* field,
+                              cbtScalar envelope,
+                              const cbtTransform& X_sdf,
+                              const cbtVector3& center,
+                              cbtScalar radius,
+                              cbtManifoldResult* resultOut) {
+    double d;
+    ChVector3d g;
+    if (!field->EvaluateSphere(ChVector3d(center.x(), center.y(), center.z()), radius, envelope, d, g))
+        return 0;
+    cbtVector3 grad((cbtScalar)g.x(), (cbtScalar)g.y(), (cbtScalar)g.z());
+
+    cbtScalar penetration = (cbtScalar)d - envelope - radius;
+    if (penetration >= 0)
+        return 0;
+
+    // A new contact point must specify:
+    //   normal, pointing from B towards A
+    //   point, located on surface of B
+    //   distance, negative for penetration
+    cbtVector3 normal = -(X_sdf.getBasis() * grad);
+    cbtVector3 point = X_sdf(center) + normal * radius;
+    resultOut->addContactPoint(normal, point, penetration);
+
+    return 1;
+}
+
+// Collision of a signed distance field shape with a sphere, capsule, box, or another distance field shape.
+//   - sphere: the sphere center is sampled in the field
+//   - capsule: points along the capsule axis (spaced at most one grid cell apart) are sampled in the field
+//   - box: the box corners and the midpoints of its edges and faces are sampled in the field; the field surface
+//     points are tested against the box
+//   - SDF: the surface points of each field are sampled in the other field
+void cbtSDFCollisionAlgorithm::processCollision(const cbtCollisionObjectWrapper* body0,
+                                                const cbtCollisionObjectWrapper* body1,
+                                                const cbtDispatcherInfo& dispatchInfo,
+                                                cbtManifoldResult* resultOut) {
+    (void)dispatchInfo;
+    (void)resultOut;
+    if (!m_manifoldPtr)
+        return;
+
+    const cbtCollisionObjectWrapper* sdfObjWrap = m_isSwapped ? body1 : body0;
+    const cbtCollisionObjectWrapper* otherObjWrap = m_isSwapped ? body0 : body1;
+
+    resultOut->setPersistentManifold(m_manifoldPtr);
+
+    const cbtCEsdfShape* sdf = (cbtCEsdfShape*)sdfObjWrap->getCollisionShape();
+    const ChSignedDistanceField* field = sdf->getField();
+    const cbtScalar envelope = sdf->getEnvelope();
+
+    // Express the other shape in the field frame
+    const cbtTransform& abs_X_sdf = sdfObjWrap->getWorldTransform();
+    const cbtTransform& abs_X_other = otherObjWrap->getWorldTransform();
+    cbtTransform sdf_X_other = abs_X_sdf.inverseTimes(abs_X_other);
+
+    switch (otherObjWrap->getCollisionShape()->getShapeType()) {
+        case SPHERE_SHAPE_PROXYTYPE: {
+            const cbtSphereShape* sphere = (cbtSphereShape*)otherObjWrap->getCollisionShape();
+            addSDFContactPoint(field, envelope, abs_X_sdf, sdf_X_other.getOrigin(), sphere->getRadius(), resultOut);
+            break;
+        }
+        case CAPSULE_SHAPE_PROXYTYPE: {
+            const cbtCapsuleShape* cap = (cbtCapsuleShape*)otherObjWrap->getCollisionShape();
+            cbtScalar radius = cap->getRadius();
+            cbtScalar hlen = cap->getHalfHeight();
+            cbtVector3 a = sdf_X_other.getBasis().getColumn(cap->getUpAxis());  // capsule axis (in field frame)
+            cbtVector3 c = sdf_X_other.getOrigin();                             // capsule center (in field frame)
+
+            int n = std::max(1, (int)std::ceil(2 * hlen / field->GetCellSize()));
+            for (int i = 0; i <= n; i++) {
+                cbtScalar t = -hlen + (2 * hlen * i) / n;
+                addSDFContactPoint(field, envelope, abs_X_sdf, c + a * t, radius, resultOut);
+            }
+            break;
+        }
+        case BOX_SHAPE_PROXYTYPE: {
+            const cbtBoxShape* box = (cbtBoxShape*)otherObjWrap->getCollisionShape();
+            cbtVector3 hdims = box->getHalfExtentsWithMargin();
+
+            // Box corners, edge midpoints, and face centers, sampled in the field
+            for (int i = -1; i <= 1; i++) {
+                for (int j = -1; j <= 1; j++) {
+                    for (int k = -1; k <= 1; k++) {
+                        if (i == 0 && j == 0 && k == 0)
+                            continue;
+                        cbtVector3 p(i * hdims.x(), j * hdims.y(), k * hdims.z());
+                        addSDFContactPoint(field, envelope, abs_X_sdf, sdf_X_other(p), 0, resultOut);
+                    }
+                }
+            }
+
+            // Field surface points, tested against the box (working in the box frame)
+            cbtTransform box_X_sdf = sdf_X_other.inverse();
+            for (const auto& v : field->GetSurfacePoints()) {
+                cbtVector3 p = box_X_sdf(cbtVector3((cbtScalar)v.x(), (cbtScalar)v.y(), (cbtScalar)v.z()));
+                if (std::abs(p.x()) > hdims.x() + envelope || std::abs(p.y()) > hdims.y() + envelope ||
+                    std::abs(p.z()) > hdims.z() + envelope)
+                    continue;
+
+                cbtVector3 q = p;
+                cbtVector3 n(0, 0, 0);
+                cbtScalar dist;
+                if (bt_utils::SnapPointToBox(hdims, q)) {
+                    // Point outside box
+                    cbtVector3 delta = p - q;
+                    dist = delta.length();
+                    if (dist <= 1e-12)
+                        continue;
+                    n = delta / dist;
+                } else {
+                    // Point inside box: project on closest face
+                    int iface = bt_utils::FindClosestBoxFace(hdims, p);
+                    int i = std::abs(iface) - 1;
+                    cbtScalar sign = iface > 0 ? cbtScalar(1) : cbtScalar(-1);
+                    q[i] = sign * hdims[i];
+                    n[i] = sign;
+                    dist = sign * p[i] - hdims[i];
+                }
+
+                cbtScalar penetration = dist - envelope;
+                if (penetration >= 0)
+                    continue;
+
+                cbtVector3 normal = abs_X_other.getBasis() * n;
+                cbtVector3 point = abs_X_other(q);
+                resultOut->addContactPoint(normal, point, penetration);
+            }
+            break;
+        }
+        case CE_SDF_SHAPE_PROXYTYPE: {
+            const cbtCEsdfShape* sdf_other = (cbtCEsdfShape*)otherObjWrap->getCollisionShape();
+            const ChSignedDistanceField* field_other = sdf_other->getField();
+            const cbtScalar envelope_other = sdf_other->getEnvelope();
+
+            // Surface points of the other field, sampled in this field
+            for (const auto& v : field_other->GetSurfacePoints()) {
+                cbtVector3 p = sdf_X_other(cbtVector3((cbtScalar)v.x(), (cbtScalar)v.y(), (cbtScalar)v.z()));
+                addSDFContactPoint(field, envelope, abs_X_sdf, p, envelope_other, resultOut);
+            }
+
+            // Surface points of this field, sampled in the other field
+            cbtTransform other_X_sdf = sdf_X_other.inverse();
+            for (const auto& v : field->GetSurfacePoints()) {
+                cbtVector3 p = other_X_sdf(cbtVector3((cbtScalar)v.x(), (cbtScalar)v.y(), (cbtScalar)v.z()));
+                cbtScalar dist;
+                cbtVector3 grad;
+                if (!SampleSDF(field_other, p, dist, grad))
+                    continue;
+
+                cbtScalar penetration = dist - envelope - envelope_other;
+                if (penetration >= 0)
+                    continue;
+
+                cbtVector3 normal = abs_X_other.getBasis() * grad;
+                cbtVector3 point = abs_X_other(p) - normal * (dist - envelope_other);
+                resultOut->addContactPoint(normal, point, penetration);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    if (m_ownManifold && m_manifoldPtr->getNumContacts()) {
+        resultOut->refreshContactPoints();
+    }
+}
+
+cbtScalar cbtSDFCollisionAlgorithm::calculateTimeOfImpact(cbtCollisionObject* body0,
+                                                          cbtCollisionObject* body1,
+                                                          const cbtDispatcherInfo& dispatchInfo,
+                                                          cbtManifoldResult* resultOut) {
+    // not yet
+    return cbtScalar(1.);
+}
+
+void cbtSDFCollisionAlgorithm::getAllContactManifolds(cbtManifoldArray& manifoldArray) {
+    if (m_manifoldPtr && m_ownManifold) {
+        manifoldArray.push_back(m_manifoldPtr);
+    }
+}
+
+cbtCollisionAlgorithm* cbtSDFCollisionAlgorithm::CreateFunc::CreateCollisionAlgorithm(
+    cbtCollisionAlgorithmConstructionInfo& ci,
+    const cbtCollisionObjectWrapper* body0Wrap,
+    const cbtCollisionObjectWrapper* body1Wrap) {
+    void* mem = ci.m_dispatcher1->allocateCollisionAlgorithm(sizeof(cbtSDFCollisionAlgorithm));
+    if (!m_swapped) {
+        return new (mem) cbtSDFCollisionAlgorithm(0, ci, body0Wrap, body1Wrap, false);
+    } else {
+        return new (mem) cbtSDFCollisionAlgorithm(0, ci, body0Wrap, body1Wrap, true);
+    }
+}
+
 }  // namespace chrono
@@ -246,6 +246,45 @@ class cbtCEtriangleShapeCollisionAlgorithm : public cbtActivatingCollisionAlgori
     bool m_isSwapped;
 };
 
+// ================================================================================================
+
+/// Custom Bullet algorithm for collisions involving a signed distance field shape.
+/// Supported pairs are SDF-sphere, SDF-capsule, SDF-box, and SDF-SDF. Points of the other shape (sphere center,
+/// points on the capsule axis, box vertices and edge/face midpoints, or surface points of the other field) are
+/// sampled in the distance field. For SDF-box and SDF-SDF pairs, the surface points of the field are also tested
+/// against the other shape.
+class cbtSDFCollisionAlgorithm : public cbtActivatingCollisionAlgorithm {
+  public:
+    cbtSDFCollisionAlgorithm(cbtPersistentManifold* mf,
+                             const cbtCollisionAlgorithmConstructionInfo& ci,
+                             const cbtCollisionObjectWrapper* col0,
+                             const cbtCollisionObjectWrapper* col1,
+                             bool isSwapped);
+    cbtSDFCollisionAlgorithm(const cbtCollisionAlgorithmConstructionInfo& ci);
+    ~cbtSDFCollisionAlgorithm();
+
+    virtual void processCollision(const cbtCollisionObjectWrapper* body0,
+                                  const cbtCollisionObjectWrapper* body1,
+                                  const cbtDispatcherInfo& dispatchInfo,
+                                  cbtManifoldResult* resultOut) override;
+    virtual cbtScalar calculateTimeOfImpact(cbtCollisionObject* body0,
+                                            cbtCollisionObject* body1,
+                                            const cbtDispatcherInfo& dispatchInfo,
+                                            cbtManifoldResult* resultOut) override;
+    virtual void getAllContactManifolds(cbtManifoldArray& manifoldArray) override;
+
+    struct CreateFunc : public cbtCollisionAlgorithmCreateFunc {
+        virtual cbtCollisionAlgorithm* CreateCollisionAlgorithm(cbtCollisionAlgorithmConstructionInfo& ci,
+                                                                const cbtCollisionObjectWrapper* body0Wrap,
+                                                                const cbtCollisionObjectWrapper* body1Wrap) override;
+    };
+
+  private:
+    bool m_ownManifold;
+    cbtPersistentManifold* m_manifoldPtr;
+    bool m_isSwapped;
+};
+
 /// @} collision_bullet
 
 }  // namespace chrono
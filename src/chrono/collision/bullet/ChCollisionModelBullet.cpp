@@ -22,6 +22,7 @@
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbt2DShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbtBarrelShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbtCEtriangleShape.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbtCEsdfShape.h"
 #include "chrono/collision/bullet/cbtBulletCollisionCommon.h"
 #include "chrono/collision/gimpact/GIMPACT/Bullet/cbtGImpactCollisionAlgorithm.h"
 #include "chrono/collision/gimpact/GIMPACTUtils/cbtGImpactConvexDecompositionShape.h"
@@ -215,6 +216,17 @@ void ChCollisionModelBullet::Populate() {
                 injectTriangleProxy(shape_triangle);
                 break;
             }
+            case ChCollisionShape::Type::SDF: {
+                auto shape_sdf = std::static_pointer_cast<ChCollisionShapeSDF>(shape);
+                auto field = shape_sdf->GetField();
+                if (!field || field->IsEmpty())
+                    break;
+                model->SetSafeMargin(std::min((double)safe_margin, field->GetCellSize()));
+                auto bt_shape = chrono_types::make_shared<cbtCEsdfShape>(field.get(), (cbtScalar)envelope);
+                bt_shape->setMargin((cbtScalar)full_margin);
+                injectShape(shape, bt_shape, frame);
+                break;
+            }
             default:
                 // Shape type not supported
                 break;
@@ -20,12 +20,17 @@
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChParticleCloud.h"
 #include "chrono/fea/ChMesh.h"
+#include "chrono/utils/ChOpenMP.h"
+#include "chrono/utils/ChRadixSort.h"
+#include "chrono/utils/ChUtils.h"
 
 #include "chrono/collision/bullet/ChCollisionSystemBullet.h"
 #include "chrono/collision/bullet/ChCollisionModelBullet.h"
 #include "chrono/collision/bullet/ChCollisionAlgorithmsBullet.h"
 #include "chrono/collision/gimpact/GIMPACT/Bullet/cbtGImpactCollisionAlgorithm.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionDispatch/cbtCollisionDispatcherMt.h"
+#include "chrono/collision/bullet/BulletCollision/BroadphaseCollision/cbtDbvtBroadphase.h"
+#include "chrono/collision/bullet/LinearMath/cbtAabbUtil2.h"
 #include "chrono/collision/bullet/LinearMath/cbtIDebugDraw.h"
 
 extern cbtScalar gContactBreakingThreshold;
@@ -37,7 +42,31 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChCollisionSystemBullet)
 CH_UPCASTING(ChCollisionSystemBullet, ChCollisionSystem)
 
-ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr) {
+// Traversal of the broadphase AABB trees, counting the pairs of proxies with overlapping AABBs. Pairs which pass the
+// collision family test (the default test in cbtOverlappingPairCache) are counted separately from those culled by it.
+// Used only if statistics collection is enabled.
+struct FamilyPairCounter : cbtDbvt::ICollide {
+    FamilyPairCounter() : num_pairs(0), num_culled(0) {}
+
+    virtual void Process(const cbtDbvtNode* na, const cbtDbvtNode* nb) override {
+        auto pa = static_cast<cbtDbvtProxy*>(na->data);
+        auto pb = static_cast<cbtDbvtProxy*>(nb->data);
+        if (pa == pb || !TestAabbAgainstAabb2(pa->m_aabbMin, pa->m_aabbMax, pb->m_aabbMin, pb->m_aabbMax))
+            return;
+        bool collides = (pa->m_collisionFilterGroup & pb->m_collisionFilterMask) != 0;
+        collides = collides && (pb->m_collisionFilterGroup & pa->m_collisionFilterMask);
+        if (collides)
+            num_pairs++;
+        else
+            num_culled++;
+    }
+
+    unsigned int num_pairs;
+    unsigned int num_culled;
+};
+
+ChCollisionSystemBullet::ChCollisionSystemBullet()
+    : m_debug_drawer(nullptr), m_num_threads(1) {
     bt_collision_configuration = new cbtDefaultCollisionConfiguration();
 
 #ifdef BT_USE_OPENMP
@@ -88,6 +117,16 @@ ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr) {
     bt_dispatcher->registerCollisionCreateFunc(CE_TRIANGLE_SHAPE_PROXYTYPE, CE_TRIANGLE_SHAPE_PROXYTYPE,
                                                m_collision_cetri_cetri);
 
+    // custom collision for signed distance field shapes
+    m_collision_sdf_other = new cbtSDFCollisionAlgorithm::CreateFunc;
+    m_collision_other_sdf = new cbtSDFCollisionAlgorithm::CreateFunc;
+    m_collision_other_sdf->m_swapped = true;
+    for (auto type : {SPHERE_SHAPE_PROXYTYPE, CAPSULE_SHAPE_PROXYTYPE, BOX_SHAPE_PROXYTYPE}) {
+        bt_dispatcher->registerCollisionCreateFunc(CE_SDF_SHAPE_PROXYTYPE, type, m_collision_sdf_other);
+        bt_dispatcher->registerCollisionCreateFunc(type, CE_SDF_SHAPE_PROXYTYPE, m_collision_other_sdf);
+    }
+    bt_dispatcher->registerCollisionCreateFunc(CE_SDF_SHAPE_PROXYTYPE, CE_SDF_SHAPE_PROXYTYPE, m_collision_sdf_other);
+
     // custom collision for point-point case (in point clouds, just never create point-point contacts)
     // cbtCollisionAlgorithmCreateFunc* m_collision_point_point = new cbtPointPointCollisionAlgorithm::CreateFunc;
     m_tmp_mem = cbtAlignedAlloc(sizeof(cbtEmptyAlgorithm::CreateFunc), 16);
@@ -120,11 +159,14 @@ ChCollisionSystemBullet::~ChCollisionSystemBullet() {
     delete m_collision_seg_arc;
     delete m_collision_arc_arc;
     delete m_collision_cetri_cetri;
+    delete m_collision_sdf_other;
+    delete m_collision_other_sdf;
     m_emptyCreateFunc->~cbtCollisionAlgorithmCreateFunc();
     cbtAlignedFree(m_tmp_mem);
 }
 
 void ChCollisionSystemBullet::SetNumThreads(int nthreads) {
+    m_num_threads = std::max(nthreads, 1);
 #ifdef BT_USE_OPENMP
     cbtGetOpenMPTaskScheduler()->setNumThreads(nthreads);
 #endif
@@ -181,8 +223,69 @@ void ChCollisionSystemBullet::Remove(ChCollisionModelBullet* bt_model, bool eras
 }
 
 void ChCollisionSystemBullet::Run() {
-    if (bt_collision_world) {
-        bt_collision_world->performDiscreteCollisionDetection();
+    if (!bt_collision_world)
+        return;
+
+    double broad = bt_collision_world->timer_collision_broad();
+    double narrow = bt_collision_world->timer_collision_narrow();
+    double start = GetTraceTime();
+
+    bt_collision_world->performDiscreteCollisionDetection();
+
+    // The AABB update, broadphase, and narrowphase are performed in sequence
+    double total = GetTraceTime() - start;
+    broad = bt_collision_world->timer_collision_broad() - broad;
+    narrow = bt_collision_world->timer_collision_narrow() - narrow;
+    AddTraceEvent("AABB update", start, total - broad - narrow);
+    AddTraceEvent("Broadphase", start + total - broad - narrow, broad);
+    AddTraceEvent("Narrowphase", start + total - narrow, narrow);
+
+    if (m_stats_enabled)
+        CollectStats();
+}
+
+void ChCollisionSystemBullet::CollectStats() {
+    // Shape type of a collision model (UNKNOWN_SHAPE for a model with shapes of different types)
+    auto model_type = [](const ChCollisionModelBullet* bt_model) {
+        if (bt_model->m_shapes.empty())
+            return ChCollisionShape::Type::UNKNOWN_SHAPE;
+        auto type = bt_model->m_shapes[0]->GetType();
+        for (const auto& shape : bt_model->m_shapes) {
+            if (shape->GetType() != type)
+                return ChCollisionShape::Type::UNKNOWN_SHAPE;
+        }
+        return type;
+    };
+
+    m_stats.Reset();
+    m_stats.num_models = bt_collision_world->getNumCollisionObjects();
+
+    // Count the pairs of models with overlapping AABBs, over the two sets of the DBVT broadphase (moving and resting
+    // proxies). The overlapping pair cache cannot be used for this: it may contain pairs whose AABBs no longer overlap
+    // and it never contains the pairs culled by the collision families.
+    auto dbvt = static_cast<cbtDbvtBroadphase*>(bt_broadphase);
+    FamilyPairCounter counter;
+    dbvt->m_sets[0].collideTT(dbvt->m_sets[0].m_root, dbvt->m_sets[0].m_root, counter);
+    dbvt->m_sets[0].collideTT(dbvt->m_sets[0].m_root, dbvt->m_sets[1].m_root, counter);
+    dbvt->m_sets[1].collideTT(dbvt->m_sets[1].m_root, dbvt->m_sets[1].m_root, counter);
+    m_stats.num_broadphase_pairs = counter.num_pairs;
+    m_stats.num_filtered_pairs = counter.num_culled;
+
+    // Pairs with a collision algorithm were processed by the narrowphase
+    cbtOverlappingPairCache* pair_cache = bt_broadphase->getOverlappingPairCache();
+    int numPairs = pair_cache->getNumOverlappingPairs();
+    for (int i = 0; i < numPairs; i++) {
+        const cbtBroadphasePair& mp = pair_cache->getOverlappingPairArray().at(i);
+        if (!mp.m_algorithm)
+            continue;
+
+        auto obA = static_cast<cbtCollisionObject*>(mp.m_pProxy0->m_clientObject);
+        auto obB = static_cast<cbtCollisionObject*>(mp.m_pProxy1->m_clientObject);
+        auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
+        auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
+
+        m_stats.num_narrowphase_pairs++;
+        m_stats.AddNarrowphaseCall(model_type(bt_modelA), model_type(bt_modelB));
     }
 }
 
@@ -208,41 +311,59 @@ double ChCollisionSystemBullet::GetTimerCollisionNarrow() const {
     return bt_collision_world->timer_collision_narrow();
 }
 
+// Contacts are extracted concurrently from the Bullet contact manifolds. Each thread processes a contiguous range of
+// manifolds (static schedule) and stores the resulting contacts in its own buffer. The buffers are then merged in
+// thread order, so that contacts are passed to the user callbacks and to the contact container sequentially and in the
+// same order as with a serial traversal of the manifolds.
 void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontainer) {
+    double start = GetTraceTime();
+    unsigned int num_contacts = 0;
+
     // This should remove all old contacts (or at least rewind the index)
     mcontactcontainer->BeginAddContact();
 
-    // NOTE: Bullet does not provide information on radius of curvature at a contact point.
-    // As such, for all Bullet-identified contacts, the default value will be used (SMC only).
-    ChCollisionInfo icontact;
-
     int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
-    for (int i = 0; i < numManifolds; i++) {
-        cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
-        const cbtCollisionObject* obA = contactManifold->getBody0();
-        const cbtCollisionObject* obB = contactManifold->getBody1();
-        contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
+    m_buffers.resize(m_num_threads);
+    for (auto& buffer : m_buffers) {
+        buffer.manifolds.clear();
+        buffer.contacts.clear();
+    }
 
-        auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
-        auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
+#pragma omp parallel num_threads(m_num_threads)
+    {
+        ThreadBuffer& buffer = m_buffers[ChOMP::GetThreadNum()];
 
-        icontact.modelA = bt_modelA->model;
-        icontact.modelB = bt_modelB->model;
+        // NOTE: Bullet does not provide information on radius of curvature at a contact point.
+        // As such, for all Bullet-identified contacts, the default value will be used (SMC only).
+        ChCollisionInfo icontact;
 
-        double envelopeA = icontact.modelA->GetEnvelope();
-        double envelopeB = icontact.modelB->GetEnvelope();
+#pragma omp for schedule(static)
+        for (int i = 0; i < numManifolds; i++) {
+            cbtPersistentManifold* contactManifold =
+                bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
+            const cbtCollisionObject* obA = contactManifold->getBody0();
+            const cbtCollisionObject* obB = contactManifold->getBody1();
+            contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
 
-        double marginA = icontact.modelA->GetSafeMargin();
-        double marginB = icontact.modelB->GetSafeMargin();
+            auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
+            auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
 
-        // Execute custom broadphase callback, if any
-        bool do_narrow_contactgeneration = true;
-        if (broad_callback)
-            do_narrow_contactgeneration = broad_callback->OnBroadphase(icontact.modelA, icontact.modelB);
+            icontact.modelA = bt_modelA->model;
+            icontact.modelB = bt_modelB->model;
+
+            double envelopeA = icontact.modelA->GetEnvelope();
+            double envelopeB = icontact.modelB->GetEnvelope();
+
+            double marginA = icontact.modelA->GetSafeMargin();
+            double marginB = icontact.modelB->GetSafeMargin();
+
+            bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+            bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+
+            ManifoldRecord record{icontact.modelA, icontact.modelB, buffer.contacts.size(), 0, 0, 0};
+            record.key = ((uint64_t)(uint32_t)obA->getWorldArrayIndex() << 32) | (uint32_t)obB->getWorldArrayIndex();
 
-        if (do_narrow_contactgeneration) {
             int numContacts = contactManifold->getNumContacts();
-            // std::cout << "numContacts=" << numContacts << std::endl;
             for (int j = 0; j < numContacts; j++) {
                 cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
 
@@ -266,61 +387,157 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
 
                     icontact.reaction_cache = pt.reactions_cache;
 
-                    bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
-                    bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
-
                     int indexA = compoundA ? pt.m_index0 : 0;
                     int indexB = compoundB ? pt.m_index1 : 0;
 
                     icontact.shapeA = bt_modelA->m_shapes[indexA].get();
                     icontact.shapeB = bt_modelB->m_shapes[indexB].get();
 
-                    // Execute some user custom callback, if any
-                    bool add_contact = true;
-                    if (this->narrow_callback)
-                        add_contact = this->narrow_callback->OnNarrowphase(icontact);
-
-                    // Add to contact container
-                    if (add_contact) {
-                        ////std::cout << " add indexA=" << indexA << " indexB=" << indexB << std::endl;
-                        ////std::cout << "     typeA=" << icontact.shapeA->m_type << " typeB=" <<
-                        /// icontact.shapeB->m_type << std::endl;
+                    // Several manifolds may exist for the same pair of objects (e.g., one for each pair of children
+                    // of compound shapes). These are distinguished by the shape (or triangle) indices of their points.
+                    if (record.count == 0)
+                        record.subkey = ((uint64_t)(uint32_t)pt.m_index0 << 32) | (uint32_t)pt.m_index1;
 
-                        mcontactcontainer->AddContact(icontact);
-                    }
+                    buffer.contacts.push_back(icontact);
+                    record.count++;
                 }
             }
+
+            buffer.manifolds.push_back(record);
+
+            // Uncomment this line to remove all points
+            ////contactManifold->clearManifold();
         }
+    }
+
+    // Merge the per-thread buffers and add contacts to the container
+    auto add_manifold = [&](ThreadBuffer& buffer, const ManifoldRecord& record) {
+        // Execute custom broadphase callback, if any
+        bool do_narrow_contactgeneration = true;
+        if (broad_callback)
+            do_narrow_contactgeneration = broad_callback->OnBroadphase(record.modelA, record.modelB);
+
+        if (!do_narrow_contactgeneration)
+            return;
+
+        for (size_t j = record.first; j < record.first + record.count; j++) {
+            ChCollisionInfo& icontact = buffer.contacts[j];
 
-        // Uncomment this line to remove all points
-        ////contactManifold->clearManifold();
+            // Execute some user custom callback, if any
+            bool add_contact = true;
+            if (this->narrow_callback)
+                add_contact = this->narrow_callback->OnNarrowphase(icontact);
+
+            // Add to contact container
+            if (add_contact) {
+                mcontactcontainer->AddContact(icontact);
+                num_contacts++;
+            }
+        }
+    };
+
+    if (m_deterministic) {
+        // The order of the manifolds in the dispatcher depends on the thread scheduling in the narrowphase.
+        // Sort the manifold records by (object indices, shape indices); the order of the points within a manifold is
+        // deterministic.
+        m_records.clear();
+        for (int t = 0; t < (int)m_buffers.size(); t++) {
+            for (size_t i = 0; i < m_buffers[t].manifolds.size(); i++)
+                m_records.push_back({t, i});
+        }
+
+        m_sort_order.clear();
+        m_sort_keys.resize(m_records.size());
+        for (size_t i = 0; i < m_records.size(); i++)
+            m_sort_keys[i] = m_buffers[m_records[i].first].manifolds[m_records[i].second].subkey;
+        utils::RadixSort(m_sort_keys, m_sort_order, m_num_threads);
+        for (size_t i = 0; i < m_records.size(); i++)
+            m_sort_keys[i] = m_buffers[m_records[i].first].manifolds[m_records[i].second].key;
+        utils::RadixSort(m_sort_keys, m_sort_order, m_num_threads);
+
+        for (auto i : m_sort_order) {
+            auto& buffer = m_buffers[m_records[i].first];
+            add_manifold(buffer, buffer.manifolds[m_records[i].second]);
+        }
+    } else {
+        // Process the per-thread buffers in thread order
+        for (auto& buffer : m_buffers) {
+            for (const auto& record : buffer.manifolds)
+                add_manifold(buffer, record);
+        }
     }
+
+    ReportSpeculativeContacts(mcontactcontainer);
+
     mcontactcontainer->EndAddContact();
+
+    m_stats.num_contacts = num_contacts;
+    AddTraceEvent("Report contacts", start, GetTraceTime() - start);
+    AddTraceCounters();
 }
 
 void ChCollisionSystemBullet::ReportProximities(ChProximityContainer* mproximitycontainer) {
     mproximitycontainer->BeginAddProximities();
 
-    int numPairs = bt_collision_world->getBroadphase()->getOverlappingPairCache()->getNumOverlappingPairs();
-    for (int i = 0; i < numPairs; i++) {
-        cbtBroadphasePair mp =
-            bt_collision_world->getBroadphase()->getOverlappingPairCache()->getOverlappingPairArray().at(i);
+    cbtOverlappingPairCache* pair_cache = bt_collision_world->getBroadphase()->getOverlappingPairCache();
+    int numPairs = pair_cache->getNumOverlappingPairs();
+    m_buffers.resize(m_num_threads);
+    for (auto& buffer : m_buffers)
+        buffer.manifolds.clear();
 
-        cbtCollisionObject* obA = static_cast<cbtCollisionObject*>(mp.m_pProxy0->m_clientObject);
-        cbtCollisionObject* obB = static_cast<cbtCollisionObject*>(mp.m_pProxy1->m_clientObject);
+    // Collect the pairs of collision models concurrently, in per-thread buffers (see ReportContacts)
+#pragma omp parallel num_threads(m_num_threads)
+    {
+        ThreadBuffer& buffer = m_buffers[ChOMP::GetThreadNum()];
 
-        auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
-        auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
+#pragma omp for schedule(static)
+        for (int i = 0; i < numPairs; i++) {
+            const cbtBroadphasePair& mp = pair_cache->getOverlappingPairArray().at(i);
+
+            cbtCollisionObject* obA = static_cast<cbtCollisionObject*>(mp.m_pProxy0->m_clientObject);
+            cbtCollisionObject* obB = static_cast<cbtCollisionObject*>(mp.m_pProxy1->m_clientObject);
+
+            auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
+            auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
 
-        ChCollisionModel* modelA = bt_modelA->model;
-        ChCollisionModel* modelB = bt_modelB->model;
+            buffer.manifolds.push_back({bt_modelA->model, bt_modelB->model, 0, 0, 0, 0});
+        }
+    }
 
-        // Add to proximity container
-        mproximitycontainer->AddProximity(modelA, modelB);
+    // Add to proximity container (in thread order)
+    for (const auto& buffer : m_buffers) {
+        for (const auto& record : buffer.manifolds)
+            mproximitycontainer->AddProximity(record.modelA, record.modelB);
     }
+
     mproximitycontainer->EndAddProximities();
 }
 
+// Closest-hit ray callback which also records the index of the hit child of a compound collision shape.
+// Bullet reports the child index only for convex children; for concave children (triangle meshes), the shape info
+// identifies the hit triangle instead.
+struct cbtClosestShapeRayResultCallback : public cbtCollisionWorld::ClosestRayResultCallback {
+    cbtClosestShapeRayResultCallback(const cbtVector3& from, const cbtVector3& to)
+        : cbtCollisionWorld::ClosestRayResultCallback(from, to), m_child(-1) {}
+
+    virtual cbtScalar addSingleResult(cbtCollisionWorld::LocalRayResult& rayResult, bool normalInWorldSpace) override {
+        const auto* info = rayResult.m_localShapeInfo;
+        m_child = (info && info->m_shapePart == -1) ? info->m_triangleIndex : -1;
+        return ClosestRayResultCallback::addSingleResult(rayResult, normalInWorldSpace);
+    }
+
+    int m_child;  ///< index of the hit child shape (-1 if not known)
+};
+
+ChCollisionShape* ChCollisionSystemBullet::GetHitShape(const cbtCollisionObject* obj, int child) {
+    auto bt_model = static_cast<ChCollisionModelBullet*>(obj->getUserPointer());
+    if (obj->getCollisionShape()->getShapeType() != COMPOUND_SHAPE_PROXYTYPE)
+        return bt_model->m_shapes.empty() ? nullptr : bt_model->m_shapes[0].get();
+    if (child < 0 || child >= (int)bt_model->m_shapes.size())
+        return nullptr;
+    return bt_model->m_shapes[child].get();
+}
+
 bool ChCollisionSystemBullet::RayHit(const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const {
     return RayHit(from, to, result, cbtBroadphaseProxy::DefaultFilter, cbtBroadphaseProxy::AllFilter);
 }
@@ -333,7 +550,7 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
     cbtVector3 btfrom((cbtScalar)from.x(), (cbtScalar)from.y(), (cbtScalar)from.z());
     cbtVector3 btto((cbtScalar)to.x(), (cbtScalar)to.y(), (cbtScalar)to.z());
 
-    cbtCollisionWorld::ClosestRayResultCallback rayCallback(btfrom, btto);
+    cbtClosestShapeRayResultCallback rayCallback(btfrom, btto);
     rayCallback.m_collisionFilterGroup = filter_group;
     rayCallback.m_collisionFilterMask = filter_mask;
 
@@ -344,6 +561,7 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
         result.hitModel = bt_model->model;
         if (result.hitModel) {
             result.hit = true;
+            result.hitShape = GetHitShape(rayCallback.m_collisionObject, rayCallback.m_child);
             result.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
                                     rayCallback.m_hitPointWorld.z());
             result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
@@ -401,6 +619,7 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
     auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObjects[hit]->getUserPointer());
     result.hit = true;
     result.hitModel = bt_model->model;
+    result.hitShape = nullptr;
     result.abs_hitPoint.Set(rayCallback.m_hitPointWorld[hit].x(), rayCallback.m_hitPointWorld[hit].y(),
                             rayCallback.m_hitPointWorld[hit].z());
     result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld[hit].x(), rayCallback.m_hitNormalWorld[hit].y(),
@@ -411,6 +630,141 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
     return true;
 }
 
+// Number of consecutive rays processed together in RayHitBatch.
+static const int ray_packet_size = 16;
+
+// Broadphase callback collecting the collision objects with an AABB overlapping a given box.
+struct cbtCollectAabbCallback : public cbtBroadphaseAabbCallback {
+    cbtCollectAabbCallback(std::vector<cbtCollisionObject*>& objects) : m_objects(objects) {}
+    virtual bool process(const cbtBroadphaseProxy* proxy) override {
+        m_objects.push_back(static_cast<cbtCollisionObject*>(proxy->m_clientObject));
+        return true;
+    }
+    std::vector<cbtCollisionObject*>& m_objects;
+};
+
+size_t ChCollisionSystemBullet::RayHitBatch(const std::vector<ChRay>& rays,
+                                            std::vector<ChRayhitResult>& results) const {
+    results.resize(rays.size());
+
+    int num_rays = (int)rays.size();
+    int num_packets = (num_rays + ray_packet_size - 1) / ray_packet_size;
+    size_t num_hits = 0;
+
+#pragma omp parallel for schedule(dynamic) num_threads(m_num_threads) reduction(+ : num_hits)
+    for (int ip = 0; ip < num_packets; ip++) {
+        int first = ip * ray_packet_size;
+        int last = std::min(first + ray_packet_size, num_rays);
+        num_hits += RayHitPacket(rays, results, first, last);
+    }
+
+    return num_hits;
+}
+
+size_t ChCollisionSystemBullet::RayHitPacket(const std::vector<ChRay>& rays,
+                                             std::vector<ChRayhitResult>& results,
+                                             int first,
+                                             int last) const {
+    static thread_local std::vector<cbtCollisionObject*> candidates;
+
+    // Bounding box of the packet rays and check for a common start point
+    const ChVector3d& origin = rays[first].from;
+    cbtVector3 btorigin((cbtScalar)origin.x(), (cbtScalar)origin.y(), (cbtScalar)origin.z());
+    cbtVector3 packet_min = btorigin;
+    cbtVector3 packet_max = btorigin;
+    bool shared_origin = true;
+    for (int i = first; i < last; i++) {
+        cbtVector3 btfrom((cbtScalar)rays[i].from.x(), (cbtScalar)rays[i].from.y(), (cbtScalar)rays[i].from.z());
+        cbtVector3 btto((cbtScalar)rays[i].to.x(), (cbtScalar)rays[i].to.y(), (cbtScalar)rays[i].to.z());
+        packet_min.setMin(btfrom);
+        packet_max.setMax(btfrom);
+        packet_min.setMin(btto);
+        packet_max.setMax(btto);
+        shared_origin = shared_origin && (rays[i].from == origin);
+    }
+
+    // Collision objects with AABB overlapping the packet bounding box
+    candidates.clear();
+    cbtCollectAabbCallback aabb_callback(candidates);
+    bt_broadphase->aabbTest(packet_min, packet_max, aabb_callback);
+
+    // Rays with a common start point: discard objects outside the cone bounding all packet rays
+    if (shared_origin && last - first > 1 && !candidates.empty()) {
+        ChVector3d axis = VNULL;
+        for (int i = first; i < last; i++)
+            axis += (rays[i].to - origin).GetNormalized();
+        double cos_max = 1;
+        if (axis.Normalize()) {
+            for (int i = first; i < last; i++)
+                cos_max = std::min(cos_max, (rays[i].to - origin).GetNormalized() ^ axis);
+        }
+        if (cos_max > 0) {
+            double angle = std::acos(std::min(cos_max, 1.0));
+            auto outside = [&](cbtCollisionObject* obj) {
+                const auto* proxy = obj->getBroadphaseHandle();
+                cbtVector3 center = (proxy->m_aabbMin + proxy->m_aabbMax) * cbtScalar(0.5);
+                double radius = (proxy->m_aabbMax - proxy->m_aabbMin).length() * 0.5;
+                ChVector3d v(center.x() - origin.x(), center.y() - origin.y(), center.z() - origin.z());
+                double dist = v.Length();
+                if (dist <= radius)
+                    return false;
+                double obj_angle = std::acos(ChClamp((v ^ axis) / dist, -1.0, 1.0));
+                return obj_angle > angle + std::asin(radius / dist);
+            };
+            candidates.erase(std::remove_if(candidates.begin(), candidates.end(), outside), candidates.end());
+        }
+    }
+
+    // Test each ray against the candidate objects
+    size_t num_hits = 0;
+    for (int i = first; i < last; i++) {
+        ChRayhitResult& result = results[i];
+        result.hit = false;
+
+        cbtVector3 btfrom((cbtScalar)rays[i].from.x(), (cbtScalar)rays[i].from.y(), (cbtScalar)rays[i].from.z());
+        cbtVector3 btto((cbtScalar)rays[i].to.x(), (cbtScalar)rays[i].to.y(), (cbtScalar)rays[i].to.z());
+        cbtTransform from_trans(cbtMatrix3x3::getIdentity(), btfrom);
+        cbtTransform to_trans(cbtMatrix3x3::getIdentity(), btto);
+
+        cbtClosestShapeRayResultCallback rayCallback(btfrom, btto);
+        rayCallback.m_collisionFilterGroup = cbtBroadphaseProxy::DefaultFilter;
+        rayCallback.m_collisionFilterMask = cbtBroadphaseProxy::AllFilter;
+
+        for (auto obj : candidates) {
+            if (rayCallback.m_closestHitFraction == cbtScalar(0))
+                break;
+            auto proxy = obj->getBroadphaseHandle();
+            if (!rayCallback.needsCollision(proxy))
+                continue;
+            cbtScalar param = rayCallback.m_closestHitFraction;
+            cbtVector3 normal;
+            if (!cbtRayAabb(btfrom, btto, proxy->m_aabbMin, proxy->m_aabbMax, param, normal))
+                continue;
+            cbtCollisionWorld::rayTestSingle(from_trans, to_trans, obj, obj->getCollisionShape(),
+                                             obj->getWorldTransform(), rayCallback);
+        }
+
+        if (rayCallback.hasHit()) {
+            auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObject->getUserPointer());
+            result.hitModel = bt_model->model;
+            if (result.hitModel) {
+                result.hit = true;
+                result.hitShape = GetHitShape(rayCallback.m_collisionObject, rayCallback.m_child);
+                result.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
+                                        rayCallback.m_hitPointWorld.z());
+                result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
+                                         rayCallback.m_hitNormalWorld.z());
+                result.abs_hitNormal.Normalize();
+                result.dist_factor = rayCallback.m_closestHitFraction;
+                result.abs_hitPoint = result.abs_hitPoint - result.abs_hitNormal * result.hitModel->GetEnvelope();
+                num_hits++;
+            }
+        }
+    }
+
+    return num_hits;
+}
+
 void ChCollisionSystemBullet::SetContactBreakingThreshold(double threshold) {
     gContactBreakingThreshold = (cbtScalar)threshold;
 }
@@ -50,6 +50,8 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     // virtual void RemoveAll();
 
     /// Set the number of OpenMP threads for collision detection.
+    /// This controls both the Bullet task scheduler (if enabled) and the extraction of contacts and proximity pairs
+    /// (see ReportContacts and ReportProximities).
     virtual void SetNumThreads(int nthreads) override;
 
     /// Run the algorithm and finds all the contacts.
@@ -95,6 +97,13 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests with all collision models for a batch of rays.
+    /// Rays are processed concurrently, in packets of consecutive rays. The collision objects with an AABB overlapping
+    /// the bounding box of a packet are found once per packet, using the Bullet broadphase. If all rays in a packet
+    /// share the same start point, the objects outside the cone bounding the packet rays are also discarded once per
+    /// packet. Each ray is then tested only against the remaining objects (with an additional ray-AABB test).
+    virtual size_t RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const override;
+
     /// Specify a callback object to be used for debug rendering of collision shapes.
     virtual void RegisterVisualizationCallback(std::shared_ptr<VisualizationCallback> callback) override;
 
@@ -136,10 +145,24 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                 short int filter_group,
                 short int filter_mask) const;
 
+    /// Perform ray-hit tests for the packet of rays in the range [first, last).
+    /// Return the number of rays which hit a collision model.
+    size_t RayHitPacket(const std::vector<ChRay>& rays,
+                        std::vector<ChRayhitResult>& results,
+                        int first,
+                        int last) const;
+
+    /// Return the collision shape hit by a ray, given the hit Bullet object and the index of the hit child shape (if
+    /// the object has a compound shape). Return null if the hit child of a compound shape is not known.
+    static ChCollisionShape* GetHitShape(const cbtCollisionObject* obj, int child);
+
     /// Remove the specified Bullet model from this collision system.
     /// If erase=true, also remove from the bt_models list.
     void Remove(ChCollisionModelBullet* bt_model, bool erase);
 
+    /// Update the collision detection statistics after a collision detection pass.
+    void CollectStats();
+
     std::vector<std::shared_ptr<ChCollisionModelBullet>> bt_models;
 
     cbtCollisionConfiguration* bt_collision_configuration;
@@ -155,11 +178,36 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     cbtCollisionAlgorithmCreateFunc* m_collision_seg_arc;
     cbtCollisionAlgorithmCreateFunc* m_collision_arc_arc;
     cbtCollisionAlgorithmCreateFunc* m_collision_cetri_cetri;
+    cbtCollisionAlgorithmCreateFunc* m_collision_sdf_other;
+    cbtCollisionAlgorithmCreateFunc* m_collision_other_sdf;
     void* m_tmp_mem;
     cbtCollisionAlgorithmCreateFunc* m_emptyCreateFunc;
 
     cbtIDebugDraw* m_debug_drawer;
 
+    /// Contacts (or proximity pairs) extracted from a contact manifold (or a broadphase pair).
+    struct ManifoldRecord {
+        ChCollisionModel* modelA;  ///< first collision model
+        ChCollisionModel* modelB;  ///< second collision model
+        size_t first;              ///< index of first contact in the owning thread buffer
+        size_t count;              ///< number of contacts
+        uint64_t key;              ///< sort key (world indices of the two collision objects)
+        uint64_t subkey;           ///< secondary sort key (shape indices of the first contact)
+    };
+
+    /// Per-thread buffer for concurrent extraction of contacts and proximity pairs.
+    struct ThreadBuffer {
+        std::vector<ManifoldRecord> manifolds;
+        std::vector<ChCollisionInfo> contacts;
+    };
+
+    int m_num_threads;                    ///< number of threads for contact and proximity extraction
+    std::vector<ThreadBuffer> m_buffers;  ///< per-thread extraction buffers
+
+    std::vector<std::pair<int, size_t>> m_records;  ///< (thread, index) of all manifold records (deterministic mode)
+    std::vector<uint64_t> m_sort_keys;              ///< sort keys of manifold records (deterministic mode)
+    std::vector<unsigned int> m_sort_order;         ///< sorted order of manifold records (deterministic mode)
+
     friend class ChCollisionModelBullet;
 };
 
@@ -38,6 +38,14 @@ ChBroadphase::ChBroadphase()
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
+      large_shape_bins(4),
+      coarse_factor(8),
+      incremental(false),
+      fat_margin(0),
+      fat_steps(4),
+      rebuild_fraction(real(0.1)),
+      fat_valid(false),
+      fat_reused(false),
       cd_data(nullptr) {}
 
 // -----------------------------------------------------------------------------
@@ -196,7 +204,9 @@ void ChBroadphase::ComputeTopLevelResolution() {
             bins_per_axis.z = (int)std::ceil(diag.z / bin_size.z);
             break;
         case GridType::FIXED_DENSITY:
+        case GridType::TWO_LEVEL:
             bins_per_axis = Compute_Grid_Resolution(num_shapes, diag, grid_density);
+            break;
     }
 
     // Calculate actual bin dimension
@@ -210,6 +220,23 @@ void ChBroadphase::ComputeTopLevelResolution() {
 
 // Use spatial subdivision to detect the list of POSSIBLE collisions
 void ChBroadphase::Process() {
+    // Incremental mode (single-level grid with rigid shapes only)
+    fat_reused = false;
+    if (incremental && grid_type != GridType::TWO_LEVEL && cd_data->num_rigid_shapes != 0 &&
+        cd_data->state_data.num_fluid_bodies == 0) {
+        cd_data->large_shapes.clear();
+        shape_large.clear();
+        fat_reused = IncrementalBroadphase();
+        if (!fat_reused)
+            FullIncrementalBroadphase();
+        FilterPairs();
+        cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
+        return;
+    }
+
+    fat_valid = false;
+    cd_data->moved_shapes.clear();
+
     // Compute overall AABB and then offset all AABBs
     DetermineBoundingBox();
     OffsetAABB();
@@ -217,8 +244,16 @@ void ChBroadphase::Process() {
     // Determine resolution of the top level grid
     ComputeTopLevelResolution();
 
+    cd_data->large_shapes.clear();
+    cd_data->num_coarse_active_bins = 0;
+    cd_data->num_coarse_intersections = 0;
+    shape_large.clear();
+
     if (cd_data->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        if (grid_type == GridType::TWO_LEVEL)
+            TwoLevelBroadphase();
+        else
+            OneLevelBroadphase();
         cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
     }
     return;
@@ -259,7 +294,7 @@ void ChBroadphase::OneLevelBroadphase() {
     // Count the number of bins intersected by each shape AABB -> bin_intersections
 #pragma omp parallel for
     for (int i = 0; i < num_shapes; i++) {
-        if (obj_data_id[i] == UINT_MAX) {
+        if (obj_data_id[i] == UINT_MAX || (!shape_large.empty() && shape_large[i])) {
             bin_intersections[i] = 0;
             continue;
         }
@@ -278,7 +313,7 @@ void ChBroadphase::OneLevelBroadphase() {
     // For each shape, store the bin index and the shape ID for intersections with this shape
 #pragma omp parallel for
     for (int i = 0; i < num_shapes; i++) {
-        if (obj_data_id[i] == UINT_MAX)
+        if (obj_data_id[i] == UINT_MAX || (!shape_large.empty() && shape_large[i]))
             continue;
         f_Store_AABB_BIN_Intersection(i, bins_per_axis, inv_bin_size, aabb_min, aabb_max, bin_intersections, bin_number,
                                       bin_aabb_number);
@@ -343,4 +378,554 @@ void ChBroadphase::OneLevelBroadphase() {
     }
 }
 
+// -----------------------------------------------------------------------------
+
+void ChBroadphase::TwoLevelBroadphase() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    // Flag the shapes which span more than the specified number of fine bins in any direction
+    shape_large.resize(num_shapes);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        if (obj_data_id[i] == UINT_MAX) {
+            shape_large[i] = 0;
+            continue;
+        }
+        vec3 span = HashMax(aabb_max[i], inv_bin_size) - HashMin(aabb_min[i], inv_bin_size) + vec3(1);
+        shape_large[i] = (span.x > large_shape_bins || span.y > large_shape_bins || span.z > large_shape_bins);
+    }
+
+    for (int i = 0; i < num_shapes; i++) {
+        if (shape_large[i])
+            cd_data->large_shapes.push_back(i);
+    }
+
+    // Candidate pairs of small shapes (fine grid)
+    OneLevelBroadphase();
+
+    // Candidate pairs involving large shapes (coarse grid)
+    if (!cd_data->large_shapes.empty())
+        CoarseLevelBroadphase();
+}
+
+void ChBroadphase::CoarseLevelBroadphase() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const std::vector<uint>& large_shapes = cd_data->large_shapes;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    // Coarse grid resolution
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    vec3& coarse_bins_per_axis = cd_data->coarse_bins_per_axis;
+    coarse_bins_per_axis.x = (bins_per_axis.x + coarse_factor - 1) / coarse_factor;
+    coarse_bins_per_axis.y = (bins_per_axis.y + coarse_factor - 1) / coarse_factor;
+    coarse_bins_per_axis.z = (bins_per_axis.z + coarse_factor - 1) / coarse_factor;
+
+    real3 diag = Abs(cd_data->max_bounding_point - cd_data->global_origin);
+    cd_data->coarse_bin_size =
+        diag / real3(coarse_bins_per_axis.x, coarse_bins_per_axis.y, coarse_bins_per_axis.z);
+    const real3 inv_coarse_bin_size = 1.0 / cd_data->coarse_bin_size;
+    const uint num_coarse_bins = coarse_bins_per_axis.x * coarse_bins_per_axis.y * coarse_bins_per_axis.z;
+
+    // Flag the coarse bins intersected by at least one large shape.
+    // Small shapes need only be inserted in these coarse bins.
+    coarse_bin_flag.assign(num_coarse_bins, 0);
+    for (auto i : large_shapes) {
+        vec3 gmin = HashMin(aabb_min[i], inv_coarse_bin_size);
+        vec3 gmax = HashMax(aabb_max[i], inv_coarse_bin_size);
+        for (int a = gmin.x; a <= gmax.x; a++)
+            for (int b = gmin.y; b <= gmax.y; b++)
+                for (int c = gmin.z; c <= gmax.z; c++)
+                    coarse_bin_flag[Hash_Index(vec3(a, b, c), coarse_bins_per_axis)] = 1;
+    }
+
+    // Count the number of flagged coarse bins intersected by each shape AABB
+    coarse_intersections.resize(num_shapes + 1);
+    coarse_intersections[num_shapes] = 0;
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        uint count = 0;
+        if (obj_data_id[i] != UINT_MAX) {
+            vec3 gmin = HashMin(aabb_min[i], inv_coarse_bin_size);
+            vec3 gmax = HashMax(aabb_max[i], inv_coarse_bin_size);
+            for (int a = gmin.x; a <= gmax.x; a++)
+                for (int b = gmin.y; b <= gmax.y; b++)
+                    for (int c = gmin.z; c <= gmax.z; c++)
+                        count += coarse_bin_flag[Hash_Index(vec3(a, b, c), coarse_bins_per_axis)];
+        }
+        coarse_intersections[i] = count;
+    }
+
+    Thrust_Exclusive_Scan(coarse_intersections);
+    uint num_intersections = coarse_intersections.back();
+    cd_data->num_coarse_intersections = num_intersections;
+
+    coarse_bin_number.resize(num_intersections);
+    coarse_bin_aabb_number.resize(num_intersections);
+    coarse_bin_active.resize(num_intersections);
+    coarse_bin_start_index.resize(num_intersections);
+
+    // For each shape, store the coarse bin index and the shape ID for intersections with this shape
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        if (obj_data_id[i] == UINT_MAX)
+            continue;
+        uint count = coarse_intersections[i];
+        vec3 gmin = HashMin(aabb_min[i], inv_coarse_bin_size);
+        vec3 gmax = HashMax(aabb_max[i], inv_coarse_bin_size);
+        for (int a = gmin.x; a <= gmax.x; a++) {
+            for (int b = gmin.y; b <= gmax.y; b++) {
+                for (int c = gmin.z; c <= gmax.z; c++) {
+                    uint bin = Hash_Index(vec3(a, b, c), coarse_bins_per_axis);
+                    if (coarse_bin_flag[bin]) {
+                        coarse_bin_number[count] = bin;
+                        coarse_bin_aabb_number[count] = i;
+                        count++;
+                    }
+                }
+            }
+        }
+    }
+
+    // Sort by coarse bin and find the active coarse bins
+    Thrust_Sort_By_Key(coarse_bin_number, coarse_bin_aabb_number);
+    uint num_active = (uint)(Run_Length_Encode(coarse_bin_number, coarse_bin_active, coarse_bin_start_index));
+    cd_data->num_coarse_active_bins = num_active;
+
+    coarse_bin_active.resize(num_active);
+    coarse_bin_start_index.resize(num_active + 1);
+    coarse_bin_start_index[num_active] = 0;
+    Thrust_Exclusive_Scan(coarse_bin_start_index);
+
+    // In each active coarse bin, order the shapes with the large shapes first (and by shape ID, for determinism)
+    const std::vector<char>& large = shape_large;
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_active; index++) {
+        std::sort(coarse_bin_aabb_number.begin() + coarse_bin_start_index[index],
+                  coarse_bin_aabb_number.begin() + coarse_bin_start_index[index + 1], [&large](uint a, uint b) {
+                      return large[a] != large[b] ? large[a] > large[b] : a < b;
+                  });
+    }
+
+    // Count and then store the candidate pairs involving large shapes, appending them to the fine grid pairs
+    coarse_bin_num_contact.resize(num_active + 1);
+    coarse_bin_num_contact[num_active] = 0;
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_active; index++) {
+        coarse_bin_num_contact[index] = CoarseBinPairs(index, nullptr);
+    }
+
+    Thrust_Exclusive_Scan(coarse_bin_num_contact);
+    uint num_coarse_pairs = coarse_bin_num_contact.back();
+    uint offset = cd_data->num_possible_collisions;
+    pair_shapeIDs.resize(offset + num_coarse_pairs);
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_active; index++) {
+        CoarseBinPairs(index, pair_shapeIDs.data() + offset + coarse_bin_num_contact[index]);
+    }
+
+    cd_data->num_possible_collisions = offset + num_coarse_pairs;
+}
+
+// Find the candidate pairs involving at least one large shape in the specified active coarse bin.
+// If 'pairs' is not null, the encoded shape IDs of each candidate pair are stored there.
+uint ChBroadphase::CoarseBinPairs(uint index, long long* pairs) const {
+    const std::vector<uint>& body_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<char>& body_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& body_collide = *cd_data->state_data.collide_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const real3 inv_coarse_bin_size = 1.0 / cd_data->coarse_bin_size;
+
+    uint start = coarse_bin_start_index[index];
+    uint end = coarse_bin_start_index[index + 1];
+    uint count = 0;
+
+    // Large shapes are first in each bin
+    for (uint i = start; i < end; i++) {
+        uint shapeA = coarse_bin_aabb_number[i];
+        if (!shape_large[shapeA])
+            break;
+
+        uint bodyA = body_id[shapeA];
+        if (body_collide[bodyA] == 0)
+            continue;
+
+        for (uint k = i + 1; k < end; k++) {
+            uint shapeB = coarse_bin_aabb_number[k];
+            uint bodyB = body_id[shapeB];
+
+            if (bodyA == bodyB)
+                continue;
+            if (body_collide[bodyB] == 0)
+                continue;
+            if (!body_active[bodyA] && !body_active[bodyB])
+                continue;
+            if (!collide(fam_data[shapeA], fam_data[shapeB]))
+                continue;
+            if (!overlap(aabb_min[shapeA], aabb_max[shapeA], aabb_min[shapeB], aabb_max[shapeB]))
+                continue;
+            if (!current_bin(aabb_min[shapeA], aabb_max[shapeA], aabb_min[shapeB], aabb_max[shapeB],
+                             inv_coarse_bin_size, cd_data->coarse_bins_per_axis, coarse_bin_active[index]))
+                continue;
+
+            if (pairs)
+                pairs[count] = ((long long)std::min(shapeA, shapeB) << 32 | (long long)std::max(shapeA, shapeB));
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// -----------------------------------------------------------------------------
+
+uint ChBroadphase::CountFilteredPairs() const {
+    const std::vector<uint>& body_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const std::vector<uint>& bin_active = cd_data->bin_active;
+    const std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    const std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+
+    uint count = 0;
+
+#pragma omp parallel for reduction(+ : count)
+    for (int index = 0; index < (signed)cd_data->num_active_bins; index++) {
+        for (uint i = bin_start_index[index]; i < bin_start_index[index + 1]; i++) {
+            uint shapeA = bin_aabb_number[i];
+            for (uint k = i + 1; k < bin_start_index[index + 1]; k++) {
+                uint shapeB = bin_aabb_number[k];
+                if (body_id[shapeA] == UINT_MAX || body_id[shapeB] == UINT_MAX || body_id[shapeA] == body_id[shapeB])
+                    continue;
+                if (collide(fam_data[shapeA], fam_data[shapeB]))
+                    continue;
+                if (!overlap(aabb_min[shapeA], aabb_max[shapeA], aabb_min[shapeB], aabb_max[shapeB]))
+                    continue;
+                if (!current_bin(aabb_min[shapeA], aabb_max[shapeA], aabb_min[shapeB], aabb_max[shapeB], inv_bin_size,
+                                 bins_per_axis, bin_active[index]))
+                    continue;
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+// -----------------------------------------------------------------------------
+
+// Inflate the AABB of the specified shape by a margin proportional to its motion over the last step.
+// The resulting box is expressed relative to the current grid origin.
+void ChBroadphase::FattenAABB(int index) {
+    const real3& amin = cd_data->aabb_min[index];
+    const real3& amax = cd_data->aabb_max[index];
+    real3 center = 0.5 * (amin + amax);
+    real margin = fat_margin + fat_steps * Length(center - prev_center[index]);
+    fat_min[index] = amin - margin - cd_data->global_origin;
+    fat_max[index] = amax + margin - cd_data->global_origin;
+}
+
+// Build the grid and the list of candidate pairs for the inflated shape AABBs.
+void ChBroadphase::FullIncrementalBroadphase() {
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    // Without history (first pass or changed shapes), use the minimum margin
+    if (prev_center.size() != (size_t)num_shapes) {
+        prev_center.resize(num_shapes);
+#pragma omp parallel for
+        for (int i = 0; i < num_shapes; i++)
+            prev_center[i] = 0.5 * (aabb_min[i] + aabb_max[i]);
+    }
+
+    // Inflate AABBs (in the absolute frame, as the grid origin is not yet known)
+    fat_min.resize(num_shapes);
+    fat_max.resize(num_shapes);
+    cd_data->global_origin = real3(0);
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        FattenAABB(i);
+    }
+
+    // Bin the inflated AABBs and find their candidate pairs
+    std::swap(cd_data->aabb_min, fat_min);
+    std::swap(cd_data->aabb_max, fat_max);
+    DetermineBoundingBox();
+    OffsetAABB();
+    ComputeTopLevelResolution();
+    OneLevelBroadphase();
+    std::swap(cd_data->aabb_min, fat_min);
+    std::swap(cd_data->aabb_max, fat_max);
+
+    fat_pairs.assign(cd_data->pair_shapeIDs.begin(), cd_data->pair_shapeIDs.begin() + cd_data->num_possible_collisions);
+    fat_active = *cd_data->state_data.active_rigid;
+    fat_collide = *cd_data->state_data.collide_rigid;
+    shape_rebinned.assign(num_shapes, 0);
+    cd_data->moved_shapes.clear();
+    fat_valid = true;
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++)
+        prev_center[i] = 0.5 * (aabb_min[i] + aabb_max[i]);
+
+    OffsetAABB();
+}
+
+// Update the candidate pairs for the shapes which left their inflated AABB since the previous step, reusing the grid.
+// Return false if a full grid update is required.
+bool ChBroadphase::IncrementalBroadphase() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<uint>& moved_shapes = cd_data->moved_shapes;
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    if (!fat_valid || fat_min.size() != (size_t)num_shapes)
+        return false;
+    if (*cd_data->state_data.active_rigid != fat_active || *cd_data->state_data.collide_rigid != fat_collide)
+        return false;
+
+    const real3& origin = cd_data->global_origin;
+    const real3 diag = cd_data->max_bounding_point - origin;
+
+    // Flag the shapes which left their inflated AABB
+    shape_moved.resize(num_shapes);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        if (obj_data_id[i] == UINT_MAX) {
+            shape_moved[i] = 0;
+            continue;
+        }
+        real3 amin = aabb_min[i] - origin;
+        real3 amax = aabb_max[i] - origin;
+        shape_moved[i] = !(amin.x >= fat_min[i].x && amin.y >= fat_min[i].y && amin.z >= fat_min[i].z &&
+                           amax.x <= fat_max[i].x && amax.y <= fat_max[i].y && amax.z <= fat_max[i].z);
+    }
+
+    moved_list.clear();
+    for (int i = 0; i < num_shapes; i++) {
+        if (shape_moved[i])
+            moved_list.push_back(i);
+    }
+
+    if (!moved_list.empty()) {
+        // Check if the number of re-binned shapes exceeds the threshold for a full update
+        uint num_rebinned = (uint)moved_shapes.size();
+        for (auto i : moved_list)
+            num_rebinned += (shape_rebinned[i] == 0);
+        if (num_rebinned > rebuild_fraction * num_shapes)
+            return false;
+
+        // Inflate the AABBs of the moved shapes; these must stay inside the grid domain
+        bool inside = true;
+        for (auto i : moved_list) {
+            FattenAABB(i);
+            inside = inside && fat_min[i].x >= 0 && fat_min[i].y >= 0 && fat_min[i].z >= 0 &&
+                     fat_max[i].x <= diag.x && fat_max[i].y <= diag.y && fat_max[i].z <= diag.z;
+        }
+        if (!inside)
+            return false;
+
+        for (auto i : moved_list) {
+            if (!shape_rebinned[i]) {
+                shape_rebinned[i] = 1;
+                moved_shapes.push_back(i);
+            }
+        }
+
+        // Discard the candidate pairs of the moved shapes
+        const std::vector<char>& moved = shape_moved;
+        fat_pairs.erase(std::remove_if(fat_pairs.begin(), fat_pairs.end(),
+                                       [&moved](long long p) { return moved[p >> 32] || moved[p & 0xffffffff]; }),
+                        fat_pairs.end());
+
+        // Bin all re-binned shapes (with their current inflated AABBs)
+        const uint num_moved = (uint)moved_shapes.size();
+        const vec3& bins_per_axis = cd_data->bins_per_axis;
+        const real3& inv_bin_size = cd_data->inv_bin_size;
+        moved_intersections.resize(num_moved + 1);
+        moved_intersections[num_moved] = 0;
+
+#pragma omp parallel for
+        for (int k = 0; k < (signed)num_moved; k++) {
+            uint i = moved_shapes[k];
+            vec3 gmin = Clamp(HashMin(fat_min[i], inv_bin_size), vec3(0), bins_per_axis - vec3(1));
+            vec3 gmax = Clamp(HashMax(fat_max[i], inv_bin_size), vec3(0), bins_per_axis - vec3(1));
+            moved_intersections[k] = (gmax.x - gmin.x + 1) * (gmax.y - gmin.y + 1) * (gmax.z - gmin.z + 1);
+        }
+
+        Thrust_Exclusive_Scan(moved_intersections);
+        moved_bin_number.resize(moved_intersections.back());
+        moved_bin_aabb_number.resize(moved_intersections.back());
+
+#pragma omp parallel for
+        for (int k = 0; k < (signed)num_moved; k++) {
+            uint i = moved_shapes[k];
+            uint count = moved_intersections[k];
+            vec3 gmin = Clamp(HashMin(fat_min[i], inv_bin_size), vec3(0), bins_per_axis - vec3(1));
+            vec3 gmax = Clamp(HashMax(fat_max[i], inv_bin_size), vec3(0), bins_per_axis - vec3(1));
+            for (int a = gmin.x; a <= gmax.x; a++) {
+                for (int b = gmin.y; b <= gmax.y; b++) {
+                    for (int c = gmin.z; c <= gmax.z; c++) {
+                        moved_bin_number[count] = Hash_Index(vec3(a, b, c), bins_per_axis);
+                        moved_bin_aabb_number[count] = i;
+                        count++;
+                    }
+                }
+            }
+        }
+
+        Thrust_Sort_By_Key(moved_bin_number, moved_bin_aabb_number);
+
+        // Count and then store the new candidate pairs of the moved shapes
+        const uint num_new = (uint)moved_list.size();
+        moved_num_pairs.resize(num_new + 1);
+        moved_num_pairs[num_new] = 0;
+
+#pragma omp parallel for
+        for (int k = 0; k < (signed)num_new; k++) {
+            moved_num_pairs[k] = MovedShapePairs(moved_list[k], nullptr);
+        }
+
+        Thrust_Exclusive_Scan(moved_num_pairs);
+        size_t offset = fat_pairs.size();
+        fat_pairs.resize(offset + moved_num_pairs.back());
+
+#pragma omp parallel for
+        for (int k = 0; k < (signed)num_new; k++) {
+            MovedShapePairs(moved_list[k], fat_pairs.data() + offset + moved_num_pairs[k]);
+        }
+    }
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++)
+        prev_center[i] = 0.5 * (aabb_min[i] + aabb_max[i]);
+
+    OffsetAABB();
+
+    return true;
+}
+
+// Find the candidate pairs (for the inflated AABBs) of a shape which left its inflated AABB at the current step.
+// Pairs with shapes that were not re-binned are found from the grid built at the last full update, while pairs with
+// re-binned shapes are found from their current bins. If 'pairs' is not null, the encoded shape IDs of each candidate
+// pair are stored there.
+uint ChBroadphase::MovedShapePairs(uint shapeA, long long* pairs) const {
+    const std::vector<uint>& body_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
+    const std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+    const bool grid_active = cd_data->num_active_bins > 0;
+
+    const real3& Amin = fat_min[shapeA];
+    const real3& Amax = fat_max[shapeA];
+    const uint bodyA = body_id[shapeA];
+    const short2 famA = fam_data[shapeA];
+
+    // Candidate pair test (the pair is reported only in the bin containing the lower corner of the AABB overlap)
+    auto test = [&](uint shapeB, uint bin) {
+        uint bodyB = body_id[shapeB];
+        if (bodyB == UINT_MAX || bodyA == bodyB)
+            return false;
+        if (!collide(famA, fam_data[shapeB]))
+            return false;
+        if (!overlap(Amin, Amax, fat_min[shapeB], fat_max[shapeB]))
+            return false;
+        return current_bin(Amin, Amax, fat_min[shapeB], fat_max[shapeB], inv_bin_size, bins_per_axis, bin);
+    };
+
+    uint count = 0;
+    vec3 gmin = Clamp(HashMin(Amin, inv_bin_size), vec3(0), bins_per_axis - vec3(1));
+    vec3 gmax = Clamp(HashMax(Amax, inv_bin_size), vec3(0), bins_per_axis - vec3(1));
+    for (int a = gmin.x; a <= gmax.x; a++) {
+        for (int b = gmin.y; b <= gmax.y; b++) {
+            for (int c = gmin.z; c <= gmax.z; c++) {
+                uint bin = Hash_Index(vec3(a, b, c), bins_per_axis);
+
+                // Shapes not re-binned since the last full update
+                if (grid_active) {
+                    for (uint j = bin_start_index_ext[bin]; j < bin_start_index_ext[bin + 1]; j++) {
+                        uint shapeB = bin_aabb_number[j];
+                        if (shape_rebinned[shapeB] || !test(shapeB, bin))
+                            continue;
+                        if (pairs)
+                            pairs[count] = ((long long)std::min(shapeA, shapeB) << 32 | std::max(shapeA, shapeB));
+                        count++;
+                    }
+                }
+
+                // Re-binned shapes (a pair of moved shapes is reported by the one with the lower ID)
+                auto range = std::equal_range(moved_bin_number.begin(), moved_bin_number.end(), bin);
+                for (auto it = range.first; it != range.second; ++it) {
+                    uint shapeB = moved_bin_aabb_number[it - moved_bin_number.begin()];
+                    if (shapeB == shapeA || (shape_moved[shapeB] && shapeB < shapeA) || !test(shapeB, bin))
+                        continue;
+                    if (pairs)
+                        pairs[count] = ((long long)std::min(shapeA, shapeB) << 32 | std::max(shapeA, shapeB));
+                    count++;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+// Extract the candidate pairs for the actual shape AABBs from the candidate pairs for the inflated AABBs.
+void ChBroadphase::FilterPairs() {
+    const std::vector<uint>& body_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<char>& body_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& body_collide = *cd_data->state_data.collide_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    const uint num_fat_pairs = (uint)fat_pairs.size();
+
+    pair_flags.resize(num_fat_pairs + 1);
+    pair_flags[num_fat_pairs] = 0;
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_fat_pairs; index++) {
+        uint shapeA = (uint)(fat_pairs[index] >> 32);
+        uint shapeB = (uint)(fat_pairs[index] & 0xffffffff);
+        uint bodyA = body_id[shapeA];
+        uint bodyB = body_id[shapeB];
+        pair_flags[index] = bodyA != UINT_MAX && bodyB != UINT_MAX && body_collide[bodyA] && body_collide[bodyB] &&
+                            (body_active[bodyA] || body_active[bodyB]) &&
+                            collide(fam_data[shapeA], fam_data[shapeB]) &&
+                            overlap(aabb_min[shapeA], aabb_max[shapeA], aabb_min[shapeB], aabb_max[shapeB]);
+    }
+
+    Thrust_Exclusive_Scan(pair_flags);
+    cd_data->num_possible_collisions = pair_flags.back();
+    pair_shapeIDs.resize(cd_data->num_possible_collisions);
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_fat_pairs; index++) {
+        if (pair_flags[index + 1] != pair_flags[index])
+            pair_shapeIDs[pair_flags[index]] = fat_pairs[index];
+    }
+}
+
 }  // end namespace chrono
@@ -27,13 +27,24 @@ namespace chrono {
 /// @{
 
 /// Class for performing broad-phase collision detection.
+/// With a single-level grid, each shape AABB is inserted in all grid bins it intersects. With a two-level grid
+/// (GridType::TWO_LEVEL), shapes spanning more than a given number of fine grid bins in any direction are instead
+/// inserted in a coarse grid (with bins a given number of times larger than the fine grid bins). Candidate pairs of
+/// small shapes are found in the fine grid, while candidate pairs involving at least one large shape are found in the
+/// coarse grid.\n
+/// In incremental mode (single-level grid only), the grid is built from shape AABBs inflated by a margin which scales
+/// with the shape motion over the last step. The list of candidate pairs (for the inflated AABBs) is then kept across
+/// steps; only the shapes which leave their inflated AABB are re-binned and have their candidate pairs recomputed.
+/// A full grid update is performed when the fraction of re-binned shapes exceeds a threshold, when an inflated AABB
+/// leaves the grid domain, or when the set of colliding shapes or bodies changes.
 class ChApi ChBroadphase {
   public:
     /// Method for computing grid resolution
     enum class GridType {
         FIXED_RESOLUTION,  ///< user-specified number of bins in each direction
         FIXED_BIN_SIZE,    ///< user-specified grid bin dimension
-        FIXED_DENSITY      ///< user-specified density of shapes per bin
+        FIXED_DENSITY,     ///< user-specified density of shapes per bin
+        TWO_LEVEL          ///< user-specified density of shapes per bin (fine grid), large shapes in a coarse grid
     };
 
     ChBroadphase();
@@ -44,18 +55,62 @@ class ChApi ChBroadphase {
 
   private:
     void OneLevelBroadphase();
+    bool IncrementalBroadphase();
+    void FullIncrementalBroadphase();
+    void FattenAABB(int index);
+    uint MovedShapePairs(uint index, long long* pairs) const;
+    void FilterPairs();
+    void TwoLevelBroadphase();
+    void CoarseLevelBroadphase();
+    uint CoarseBinPairs(uint index, long long* pairs) const;
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
     void RigidBoundingBox();
     void FluidBoundingBox();
 
+    /// Count the pairs of shapes with overlapping AABBs culled by the collision family masks (statistics only).
+    /// Only the shapes stored in the fine grid at the last full broadphase update are considered.
+    uint CountFilteredPairs() const;
+
     std::shared_ptr<ChCollisionData> cd_data;
 
-    GridType grid_type;    ///< (input) method for setting grid resolution
-    vec3 grid_resolution;  ///< (input) number of bins (used for GridType::FIXED_RESOLUTION)
-    real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
-    real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
+    GridType grid_type;     ///< (input) method for setting grid resolution
+    vec3 grid_resolution;   ///< (input) number of bins (used for GridType::FIXED_RESOLUTION)
+    real3 bin_size;         ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
+    real grid_density;      ///< (input) collision grid density (used for GridType::FIXED_DENSITY and TWO_LEVEL)
+    int large_shape_bins;   ///< (input) fine bins spanned by a large shape (used for GridType::TWO_LEVEL)
+    int coarse_factor;      ///< (input) ratio of coarse to fine bin size (used for GridType::TWO_LEVEL)
+    bool incremental;       ///< (input) keep candidate pairs across steps, re-binning only moved shapes
+    real fat_margin;        ///< (input) minimum AABB inflation margin (incremental mode)
+    real fat_steps;         ///< (input) number of steps of current shape motion covered by the inflation margin
+    real rebuild_fraction;  ///< (input) fraction of re-binned shapes triggering a full grid update
+
+    std::vector<char> shape_large;             ///< flags for shapes binned in the coarse grid
+    std::vector<char> coarse_bin_flag;         ///< flags for coarse bins intersected by a large shape
+    std::vector<uint> coarse_intersections;    ///< number of coarse bin intersections for each shape AABB
+    std::vector<uint> coarse_bin_number;       ///< coarse bin index for bin-shape AABB intersections
+    std::vector<uint> coarse_bin_aabb_number;  ///< shape ID for coarse bin-shape AABB intersections
+    std::vector<uint> coarse_bin_active;       ///< coarse bin index of active coarse bins
+    std::vector<uint> coarse_bin_start_index;  ///< start of the shape IDs in each active coarse bin
+    std::vector<uint> coarse_bin_num_contact;  ///< start of the candidate pairs found in each active coarse bin
+
+    bool fat_valid;                           ///< inflated AABBs and candidate pairs are up to date
+    bool fat_reused;                          ///< the last pass reused the grid from a previous step
+    std::vector<real3> fat_min;               ///< inflated AABB lower corners (relative to grid origin)
+    std::vector<real3> fat_max;               ///< inflated AABB upper corners (relative to grid origin)
+    std::vector<real3> prev_center;           ///< shape AABB centers at previous step
+    std::vector<long long> fat_pairs;         ///< candidate pairs for the inflated AABBs
+    std::vector<char> fat_active;             ///< body active flags at last full grid update
+    std::vector<char> fat_collide;            ///< body collide flags at last full grid update
+    std::vector<char> shape_moved;            ///< flags for shapes which left their inflated AABB at current step
+    std::vector<char> shape_rebinned;         ///< flags for shapes re-binned since the last full grid update
+    std::vector<uint> moved_list;             ///< shapes which left their inflated AABB at current step
+    std::vector<uint> moved_num_pairs;        ///< start of the new candidate pairs of each moved shape
+    std::vector<uint> moved_intersections;    ///< number of bin intersections for each re-binned shape
+    std::vector<uint> moved_bin_number;       ///< bin index for re-binned shape intersections (sorted)
+    std::vector<uint> moved_bin_aabb_number;  ///< shape ID for re-binned shape intersections
+    std::vector<uint> pair_flags;             ///< flags (then output positions) of candidate pairs for the actual AABBs
 
     friend class ChCollisionSystemMulticore;
     friend class ChCollisionSystemChronoMulticore;
@@ -25,12 +25,25 @@
 
 namespace chrono {
 
+class ChSignedDistanceField;
+
 /// @addtogroup collision_mc
 /// @{
 
 /// Readibility type definition.
 typedef int shape_type;
 
+/// Node of the static bounding volume hierarchy of a triangle mesh shape.
+/// For a leaf node, 'left' is the index of the first triangle and 'count' is the number of triangles in the leaf. For
+/// an internal node, 'count' is 0 and its two children are stored at 'left' and 'left+1'. Node and triangle indices
+/// are relative to the first node and to the first triangle of the associated mesh.
+struct bvh_node {
+    real3 aabb_min;  ///< lower corner of node AABB (in mesh frame)
+    real3 aabb_max;  ///< upper corner of node AABB (in mesh frame)
+    int left;        ///< first child (internal node) or first triangle (leaf node)
+    int count;       ///< number of triangles (0 for an internal node)
+};
+
 /// Structure of arrays containing rigid collision shape information.
 struct shape_container {
     // All arrays of num_shapes length and indexed by the shape ID.
@@ -40,7 +53,7 @@ struct shape_container {
     std::vector<int> typ_rigid;     ///< shape type
     std::vector<int> local_rigid;   ///< local shape index in collision model of associated body
     std::vector<int> start_rigid;   ///< start index in the appropriate container of dimensions
-    std::vector<int> length_rigid;  ///< usually 1, except for convex
+    std::vector<int> length_rigid;  ///< usually 1, except for convex and triangle mesh
 
     std::vector<quaternion> ObR_rigid;  ///< shape rotations
     std::vector<real3> ObA_rigid;       ///< shape positions
@@ -54,6 +67,12 @@ struct shape_container {
     std::vector<real2> capsule_rigid;    ///< radius and half-length for capsule shapes
     std::vector<real4> rbox_like_rigid;  ///< dimensions and radius for rbox-like shapes
     std::vector<real3> convex_rigid;     ///< points for convex hull shapes
+    std::vector<vec3> trimesh_rigid;     ///< first BVH node, first triangle, and number of triangles for mesh shapes
+
+    std::vector<const ChSignedDistanceField*> sdf_rigid;  ///< distance fields for SDF shapes
+
+    std::vector<real3> trimesh_triangles;  ///< vertices of all triangle mesh shapes (3 per triangle, in shape frame)
+    std::vector<bvh_node> trimesh_nodes;   ///< BVH nodes of all triangle mesh shapes
 
     std::vector<real3> triangle_global;  ///< triangle vertices in global frame
 };
@@ -115,6 +134,11 @@ class ChApi ChCollisionData {
           ff_max_bounding_point(real3(0)),
           ff_bins_per_axis(vec3(0)),
           //
+          coarse_bins_per_axis(vec3(0)),
+          coarse_bin_size(real3(0)),
+          num_coarse_active_bins(0),
+          num_coarse_intersections(0),
+          //
           num_rigid_shapes(0),
           num_rigid_contacts(0),
           num_rigid_fluid_contacts(0),
@@ -160,6 +184,7 @@ class ChApi ChCollisionData {
     std::vector<real3> aabb_max;  ///< list of bounding boxes maximum point
 
     std::vector<long long> pair_shapeIDs;     ///< shape IDs for each shape pair (encoded in a single long long)
+    std::vector<int> pair_triangleIDs;        ///< mesh triangle index for each shape pair (-1 if no mesh in pair)
     std::vector<long long> contact_shapeIDs;  ///< shape IDs for each contact (encoded in a single long long)
 
     // Rigid-rigid geometric collision data
@@ -212,6 +237,16 @@ class ChApi ChCollisionData {
     std::vector<uint> bin_start_index_ext;  ///< [num_bins+1]
     std::vector<uint> bin_num_contact;      ///< [num_active_bins+1]
 
+    // Two-level broadphase data
+    vec3 coarse_bins_per_axis;       ///< number of slices along each axis of the coarse grid
+    real3 coarse_bin_size;           ///< coarse grid bin sizes in each direction
+    uint num_coarse_active_bins;     ///< number of coarse bins intersecting at least one large shape AABB
+    uint num_coarse_intersections;   ///< number of coarse bin - shape AABB intersections
+    std::vector<uint> large_shapes;  ///< IDs of shapes binned in the coarse grid (not present in the fine grid bins)
+
+    // Incremental broadphase data
+    std::vector<uint> moved_shapes;  ///< IDs of shapes which left their grid bins since the last full grid update
+
     // Indexing variables
     // ------------------
 
@@ -20,6 +20,7 @@
 // =============================================================================
 
 #include "chrono/collision/multicore/ChCollisionModelMulticore.h"
+#include "chrono/collision/multicore/ChCollisionUtils.h"
 
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChBodyAuxRef.h"
@@ -232,23 +233,50 @@ void ChCollisionModelMulticore::Populate() {
             case ChCollisionShape::Type::TRIANGLEMESH: {
                 auto shape_trimesh = std::static_pointer_cast<ChCollisionShapeTriangleMesh>(shape);
                 auto trimesh = shape_trimesh->GetMesh();
+                auto num_triangles = trimesh->GetNumTriangles();
+                if (num_triangles == 0)
+                    break;
 
-                for (unsigned int i = 0; i < trimesh->GetNumTriangles(); i++) {
+                // Keep the mesh triangles in the shape frame and build the mesh BVH (which reorders the triangles)
+                std::vector<real3> triangles(3 * num_triangles);
+                for (unsigned int i = 0; i < num_triangles; i++) {
                     ChTriangle tri = trimesh->GetTriangle(i);
-                    ChVector3d p1 = position + rotation.Rotate(tri.p1);
-                    ChVector3d p2 = position + rotation.Rotate(tri.p2);
-                    ChVector3d p3 = position + rotation.Rotate(tri.p3);
-                    auto shape_triangle = chrono_types::make_shared<ChCollisionShapeTriangle>(material, p1, p2, p3);
-
-                    auto ct_shape = chrono_types::make_shared<ctCollisionShape>();
-                    ct_shape->A = FromChVector(p1);
-                    ct_shape->B = FromChVector(p2);
-                    ct_shape->C = FromChVector(p3);
-                    ct_shape->R = quaternion(1, 0, 0, 0);
-
-                    m_shapes.push_back(shape_triangle);
-                    m_ct_shapes.push_back(ct_shape);
+                    triangles[3 * i + 0] = FromChVector(tri.p1);
+                    triangles[3 * i + 1] = FromChVector(tri.p2);
+                    triangles[3 * i + 2] = FromChVector(tri.p3);
                 }
+                std::vector<bvh_node> nodes;
+                mc_utils::BuildTriangleMeshBVH(triangles, nodes);
+
+                auto ct_shape = chrono_types::make_shared<ctCollisionShape>();
+                ct_shape->A = real3(position.x(), position.y(), position.z());
+                ct_shape->B = real3((chrono::real)num_triangles, (chrono::real)(local_trimesh_data.size() / 3),
+                                    (chrono::real)local_trimesh_nodes.size());
+                ct_shape->C = real3(0, 0, 0);
+                ct_shape->R = quaternion(rotation.e0(), rotation.e1(), rotation.e2(), rotation.e3());
+                local_trimesh_data.insert(local_trimesh_data.end(), triangles.begin(), triangles.end());
+                local_trimesh_nodes.insert(local_trimesh_nodes.end(), nodes.begin(), nodes.end());
+
+                m_shapes.push_back(shape);
+                m_ct_shapes.push_back(ct_shape);
+                break;
+            }
+            case ChCollisionShape::Type::SDF: {
+                auto shape_sdf = std::static_pointer_cast<ChCollisionShapeSDF>(shape);
+                auto field = shape_sdf->GetField();
+                if (!field || field->IsEmpty())
+                    break;
+
+                // The distance field is evaluated in the shape frame
+                auto ct_shape = chrono_types::make_shared<ctCollisionShape>();
+                ct_shape->A = real3(position.x(), position.y(), position.z());
+                ct_shape->B = real3((chrono::real)local_sdf_data.size(), 0, 0);
+                ct_shape->C = real3(0, 0, 0);
+                ct_shape->R = quaternion(rotation.e0(), rotation.e1(), rotation.e2(), rotation.e3());
+                local_sdf_data.push_back(field.get());
+
+                m_shapes.push_back(shape);
+                m_ct_shapes.push_back(ct_shape);
                 break;
             }
             default:
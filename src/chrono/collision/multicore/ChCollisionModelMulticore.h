@@ -19,6 +19,7 @@
 
 #include "chrono/collision/ChCollisionModel.h"
 
+#include "chrono/collision/multicore/ChCollisionData.h"
 #include "chrono/multicore_math/ChMulticoreMath.h"
 
 namespace chrono {
@@ -49,6 +50,11 @@ class ChApi ChCollisionModelMulticore : public ChCollisionModelImpl {
     virtual ChAABB GetBoundingBox() const override;
 
     std::vector<real3> local_convex_data;
+    std::vector<real3> local_trimesh_data;      ///< triangle vertices of all mesh shapes (in shape frame)
+    std::vector<bvh_node> local_trimesh_nodes;  ///< BVH nodes of all mesh shapes
+
+    /// Distance fields of all SDF shapes.
+    std::vector<const ChSignedDistanceField*> local_sdf_data;
 
     ChVector3d aabb_min;
     ChVector3d aabb_max;
@@ -17,6 +17,8 @@
 //
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/physics/ChSystem.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChParticleCloud.h"
@@ -24,19 +26,22 @@
 
 #include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
 #include "chrono/collision/multicore/ChRayTest.h"
+#include "chrono/collision/ChSignedDistanceField.h"
 
 namespace chrono {
 
 CH_FACTORY_REGISTER(ChCollisionSystemMulticore)
 CH_UPCASTING(ChCollisionSystemMulticore, ChCollisionSystem)
 
-ChCollisionSystemMulticore::ChCollisionSystemMulticore() : use_aabb_active(false) {
+ChCollisionSystemMulticore::ChCollisionSystemMulticore()
+    : use_sphere_collider(false), sphere_collider_active(false), use_aabb_active(false) {
     // Create the shared data structure with own state data
     cd_data = chrono_types::make_shared<ChCollisionData>(true);
     cd_data->collision_envelope = ChCollisionModel::GetDefaultSuggestedEnvelope();
 
     broadphase.cd_data = cd_data;
     narrowphase.cd_data = cd_data;
+    spheres.cd_data = cd_data;
 }
 
 ChCollisionSystemMulticore::~ChCollisionSystemMulticore() {}
@@ -62,10 +67,56 @@ void ChCollisionSystemMulticore::SetBroadphaseGridDensity(double density) {
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
 }
 
+void ChCollisionSystemMulticore::SetBroadphaseGridTwoLevel(double density, int large_shape_bins, int coarse_factor) {
+    broadphase.grid_density = real(density);
+    broadphase.large_shape_bins = std::max(large_shape_bins, 1);
+    broadphase.coarse_factor = std::max(coarse_factor, 2);
+    broadphase.grid_type = ChBroadphase::GridType::TWO_LEVEL;
+}
+
+void ChCollisionSystemMulticore::SetBroadphaseIncremental(bool val,
+                                                          double margin,
+                                                          double motion_steps,
+                                                          double rebuild_fraction) {
+    broadphase.incremental = val;
+    broadphase.fat_margin = real(std::max(margin, 0.0));
+    broadphase.fat_steps = real(std::max(motion_steps, 0.0));
+    broadphase.rebuild_fraction = real(rebuild_fraction);
+    broadphase.fat_valid = false;
+}
+
+ChCollisionSystemMulticore::BroadphaseStats ChCollisionSystemMulticore::GetBroadphaseStats() const {
+    BroadphaseStats stats;
+    stats.bins_per_axis = ChVector3i(cd_data->bins_per_axis.x, cd_data->bins_per_axis.y, cd_data->bins_per_axis.z);
+    stats.num_bins = cd_data->num_bins;
+    stats.num_active_bins = cd_data->num_active_bins;
+    stats.num_intersections = cd_data->num_bin_aabb_intersections;
+    stats.num_candidate_pairs = cd_data->num_possible_collisions;
+    stats.max_shapes_per_bin = 0;
+    stats.avg_shapes_per_bin = 0;
+    if (cd_data->num_active_bins > 0) {
+        const auto& start = cd_data->bin_start_index;
+        for (uint i = 0; i < cd_data->num_active_bins; i++)
+            stats.max_shapes_per_bin = std::max(stats.max_shapes_per_bin, start[i + 1] - start[i]);
+        stats.avg_shapes_per_bin = double(cd_data->num_bin_aabb_intersections) / cd_data->num_active_bins;
+    }
+    stats.num_large_shapes = (unsigned int)cd_data->large_shapes.size();
+    stats.coarse_bins_per_axis = ChVector3i(cd_data->coarse_bins_per_axis.x, cd_data->coarse_bins_per_axis.y,
+                                            cd_data->coarse_bins_per_axis.z);
+    stats.num_coarse_active = cd_data->num_coarse_active_bins;
+    stats.incremental_update = broadphase.fat_reused;
+    stats.num_moved_shapes = (unsigned int)cd_data->moved_shapes.size();
+    return stats;
+}
+
 void ChCollisionSystemMulticore::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
     narrowphase.algorithm = algorithm;
 }
 
+void ChCollisionSystemMulticore::EnableSphereCollider(bool val) {
+    use_sphere_collider = val;
+}
+
 void ChCollisionSystemMulticore::EnableActiveBoundingBox(const ChVector3d& aabb_min, const ChVector3d& aabb_max) {
     active_aabb_min = FromChVector(aabb_min);
     active_aabb_max = FromChVector(aabb_max);
@@ -98,6 +149,15 @@ void ChCollisionSystemMulticore::Add(std::shared_ptr<ChCollisionModel> model) {
     shape_data.convex_rigid.insert(shape_data.convex_rigid.end(), ct_model->local_convex_data.begin(),
                                    ct_model->local_convex_data.end());
 
+    // Insert the mesh triangles and BVH nodes into the global lists. Node and triangle indices in the BVH nodes are
+    // relative to the mesh, so only the mesh offsets must be adjusted.
+    int trimesh_data_offset = (int)(shape_data.trimesh_triangles.size() / 3);
+    int trimesh_nodes_offset = (int)shape_data.trimesh_nodes.size();
+    shape_data.trimesh_triangles.insert(shape_data.trimesh_triangles.end(), ct_model->local_trimesh_data.begin(),
+                                        ct_model->local_trimesh_data.end());
+    shape_data.trimesh_nodes.insert(shape_data.trimesh_nodes.end(), ct_model->local_trimesh_nodes.begin(),
+                                    ct_model->local_trimesh_nodes.end());
+
     // Shape index in the collision model
     int local_shape_index = 0;
 
@@ -163,6 +223,16 @@ void ChCollisionSystemMulticore::Add(std::shared_ptr<ChCollisionModel> model) {
                 shape_data.triangle_rigid.push_back(obB);
                 shape_data.triangle_rigid.push_back(obC);
                 break;
+            case ChCollisionShape::Type::TRIANGLEMESH:
+                start = (int)shape_data.trimesh_rigid.size();
+                length = (int)obB.x;
+                shape_data.trimesh_rigid.push_back(
+                    vec3((int)obB.z + trimesh_nodes_offset, (int)obB.y + trimesh_data_offset, (int)obB.x));
+                break;
+            case ChCollisionShape::Type::SDF:
+                start = (int)shape_data.sdf_rigid.size();
+                shape_data.sdf_rigid.push_back(ct_model->local_sdf_data[(int)obB.x]);
+                break;
             default:
                 start = -1;
                 break;
@@ -182,10 +252,14 @@ void ChCollisionSystemMulticore::Add(std::shared_ptr<ChCollisionModel> model) {
     }
 
     ct_models.push_back(ct_model);
+
+    // The shape indices of the cached broadphase grid are no longer valid
+    broadphase.fat_valid = false;
 }
 
 void ChCollisionSystemMulticore::Clear() {
     ct_models.clear();
+    broadphase.fat_valid = false;
     //// TODO more here
 }
 
@@ -193,6 +267,8 @@ void ChCollisionSystemMulticore::Clear() {
 #define ERASE_MACRO_LEN(x, y, z) x.erase(x.begin() + y, x.begin() + y + z);
 
 void ChCollisionSystemMulticore::Remove(std::shared_ptr<ChCollisionModel> model) {
+    broadphase.fat_valid = false;
+
     //// TODO
     std::cerr << "\nChCollisionSystemMulticore::Remove() not yet implemented.\n" << std::endl;
     throw std::runtime_error("ChCollisionSystemMulticore::Remove() not yet implemented.");
@@ -301,12 +377,57 @@ void ChCollisionSystemMulticore::Run() {
         }
     }
 
+    // Specialized collision detection if (almost) all shapes are spheres
+    sphere_collider_active =
+        use_sphere_collider && narrowphase.algorithm != ChNarrowphase::Algorithm::MPR && spheres.CheckShapes();
+
+    if (sphere_collider_active) {
+        // The broadphase grid is not updated; force a full grid update if the broadphase is used again
+        broadphase.fat_valid = false;
+        {
+            CH_PROFILE("Broad-phase");
+            m_timer_broad.start();
+            double start = GetTraceTime();
+            GenerateAABB();
+            double aabb = GetTraceTime();
+            spheres.ProcessCells();
+            spheres.ProcessOtherPairs();
+            AddTraceEvent("AABB update", start, aabb - start);
+            AddTraceEvent("Broadphase", aabb, GetTraceTime() - aabb);
+            m_timer_broad.stop();
+        }
+        {
+            CH_PROFILE("Narrow-phase");
+            m_timer_narrow.start();
+            double start = GetTraceTime();
+            // Pairs involving non-sphere shapes are processed by the generic narrowphase
+            if (!spheres.other_shapes.empty()) {
+                narrowphase.sort_contacts = m_deterministic;
+                narrowphase.Process();
+            } else {
+                narrowphase.num_potential_rigid_contacts = 0;
+            }
+            spheres.ProcessContacts();
+            AddTraceEvent("Narrowphase", start, GetTraceTime() - start);
+            m_timer_narrow.stop();
+        }
+        if (m_stats_enabled) {
+            CollectStats();
+            AddTraceCounters();
+        }
+        return;
+    }
+
     // Broadphase
     {
         CH_PROFILE("Broad-phase");
         m_timer_broad.start();
+        double start = GetTraceTime();
         GenerateAABB();
+        double aabb = GetTraceTime();
         broadphase.Process();
+        AddTraceEvent("AABB update", start, aabb - start);
+        AddTraceEvent("Broadphase", aabb, GetTraceTime() - aabb);
         m_timer_broad.stop();
     }
 
@@ -314,14 +435,74 @@ void ChCollisionSystemMulticore::Run() {
     {
         CH_PROFILE("Narrow-phase");
         m_timer_narrow.start();
+        double start = GetTraceTime();
+        narrowphase.sort_contacts = m_deterministic;
         narrowphase.Process();
+        AddTraceEvent("Narrowphase", start, GetTraceTime() - start);
         m_timer_narrow.stop();
     }
+
+    if (m_stats_enabled) {
+        CollectStats();
+        AddTraceCounters();
+    }
+}
+
+// Largest bin occupancy with a separate entry in the bin histogram.
+static const unsigned int max_bin_histogram = 64;
+
+void ChCollisionSystemMulticore::CollectStats() {
+    const shape_type* obj_data_T = cd_data->shape_data.typ_rigid.data();
+    const std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    const std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+
+    m_stats.Reset();
+    m_stats.num_models = cd_data->state_data.num_rigid_bodies;
+
+    // Narrowphase pairs, after expansion of the pairs involving triangle meshes
+    for (uint i = 0; i < narrowphase.num_potential_rigid_contacts; i++) {
+        auto type1 = (ChCollisionShape::Type)obj_data_T[int(pair_shapeIDs[i] >> 32)];
+        auto type2 = (ChCollisionShape::Type)obj_data_T[int(pair_shapeIDs[i] & 0xffffffff)];
+        m_stats.AddNarrowphaseCall(type1, type2);
+    }
+
+    // With the sphere collision detection, all spheres in neighbor cells are candidates for the sphere-sphere test
+    if (sphere_collider_active) {
+        const std::vector<uint>& cell_start = spheres.cell_start;
+        m_stats.num_broadphase_pairs = spheres.num_other_pairs + spheres.num_tested;
+        m_stats.num_filtered_pairs = spheres.num_filtered;
+        m_stats.num_narrowphase_pairs = narrowphase.num_potential_rigid_contacts + spheres.num_tested;
+        m_stats.num_contacts = cd_data->num_rigid_contacts;
+        m_stats.narrowphase_calls[ChCollisionShape::Type::SPHERE][ChCollisionShape::Type::SPHERE] += spheres.num_tested;
+        for (uint i = 0; i < spheres.num_cells; i++) {
+            unsigned int n = std::min(cell_start[i + 1] - cell_start[i], max_bin_histogram);
+            if (n == 0)
+                continue;
+            if (m_stats.bin_histogram.size() < n)
+                m_stats.bin_histogram.resize(n, 0);
+            m_stats.bin_histogram[n - 1]++;
+        }
+        return;
+    }
+
+    m_stats.num_broadphase_pairs = cd_data->num_possible_collisions;
+    m_stats.num_filtered_pairs = broadphase.CountFilteredPairs();
+    m_stats.num_narrowphase_pairs = narrowphase.num_potential_rigid_contacts;
+    m_stats.num_contacts = cd_data->num_rigid_contacts;
+
+    // Occupancy of the active bins in the (fine) broadphase grid
+    for (uint i = 0; i < cd_data->num_active_bins; i++) {
+        unsigned int n = std::min(bin_start_index[i + 1] - bin_start_index[i], max_bin_histogram);
+        if (m_stats.bin_histogram.size() < n)
+            m_stats.bin_histogram.resize(n, 0);
+        m_stats.bin_histogram[n - 1]++;
+    }
 }
 
 // -----------------------------------------------------------------------------
 
 void ChCollisionSystemMulticore::ReportContacts(ChContactContainer* container) {
+    double start = GetTraceTime();
     const auto& blist = m_system->GetBodies();
 
     // Resize global arrays with composite material properties.
@@ -366,7 +547,11 @@ void ChCollisionSystemMulticore::ReportContacts(ChContactContainer* container) {
             container->AddContact(cinfo);
     }
 
+    ReportSpeculativeContacts(container);
+
     container->EndAddContact();
+
+    AddTraceEvent("Report contacts", start, GetTraceTime() - start);
 }
 
 // -----------------------------------------------------------------------------
@@ -532,6 +717,22 @@ void ChCollisionSystemMulticore::GenerateAABB() {
 
                 ComputeAABBTriangle(A, B, C, temp_min, temp_max);
 
+            } else if (type == ChCollisionShape::Type::TRIANGLEMESH) {
+                // Use the (rotated) AABB of the mesh BVH root node
+                const bvh_node& root = cd_data->shape_data.trimesh_nodes[cd_data->shape_data.trimesh_rigid[start].x];
+                real3 center = 0.5 * (root.aabb_max + root.aabb_min);
+                real3 hdims = 0.5 * (root.aabb_max - root.aabb_min);
+                ComputeAABBBox(hdims + envelope, local_pos + Rotate(center, local_rot), position, rotation,
+                               body_rot[id], temp_min, temp_max);
+
+            } else if (type == ChCollisionShape::Type::SDF) {
+                // Use the (rotated) AABB of the distance field grid
+                ChAABB bbox = cd_data->shape_data.sdf_rigid[start]->GetBoundingBox();
+                real3 center = FromChVector(bbox.Center());
+                real3 hdims = FromChVector(bbox.Size() / 2);
+                ComputeAABBBox(hdims + envelope, local_pos + Rotate(center, local_rot), position, rotation,
+                               body_rot[id], temp_min, temp_max);
+
             } else {
                 continue;
             }
@@ -571,7 +772,7 @@ std::vector<vec2> ChCollisionSystemMulticore::GetOverlappingPairs() {
 // -----------------------------------------------------------------------------
 
 bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const {
-    if (cd_data->num_active_bins == 0) {
+    if (cd_data->num_active_bins == 0 && cd_data->large_shapes.empty()) {
         result.hit = false;
         return false;
     }
@@ -588,8 +789,9 @@ bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d
         // ID of the body carring the closest hit shape
         uint bid = cd_data->shape_data.id_rigid[info.shapeID];
 
-        // Collision model of hit body
+        // Collision model of hit body and hit shape
         result.hitModel = m_system->GetBodies()[bid]->GetCollisionModel().get();
+        result.hitShape = GetHitShape(result.hitModel, info.shapeID);
 
         return true;
     }
@@ -598,13 +800,74 @@ bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d
     return false;
 }
 
+// Number of consecutive rays processed together in RayHitBatch.
+static const int ray_packet_size = 16;
+
+size_t ChCollisionSystemMulticore::RayHitBatch(const std::vector<ChRay>& rays,
+                                               std::vector<ChRayhitResult>& results) const {
+    results.resize(rays.size());
+
+    if (cd_data->num_active_bins == 0 && cd_data->large_shapes.empty() && cd_data->moved_shapes.empty()) {
+        for (auto& result : results)
+            result.hit = false;
+        return 0;
+    }
+
+    int num_rays = (int)rays.size();
+    int num_packets = (num_rays + ray_packet_size - 1) / ray_packet_size;
+    size_t num_hits = 0;
+
+#pragma omp parallel reduction(+ : num_hits)
+    {
+        ChRayTest tester(cd_data);
+        real3 start[ray_packet_size];
+        real3 end[ray_packet_size];
+        ChRayTest::RayHitInfo info[ray_packet_size];
+
+#pragma omp for schedule(dynamic)
+        for (int ip = 0; ip < num_packets; ip++) {
+            int first = ip * ray_packet_size;
+            int n = std::min(ray_packet_size, num_rays - first);
+            for (int i = 0; i < n; i++) {
+                start[i] = FromChVector(rays[first + i].from);
+                end[i] = FromChVector(rays[first + i].to);
+            }
+
+            num_hits += tester.CheckPacket(n, start, end, info);
+
+            for (int i = 0; i < n; i++) {
+                ChRayhitResult& result = results[first + i];
+                result.hit = (info[i].shapeID >= 0);
+                if (!result.hit)
+                    continue;
+                result.abs_hitNormal = ToChVector(info[i].normal);
+                result.abs_hitPoint = ToChVector(info[i].point);
+                result.dist_factor = info[i].t;
+                uint bid = cd_data->shape_data.id_rigid[info[i].shapeID];
+                result.hitModel = m_system->GetBodies()[bid]->GetCollisionModel().get();
+                result.hitShape = GetHitShape(result.hitModel, info[i].shapeID);
+            }
+        }
+    }
+
+    return num_hits;
+}
+
 bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from,
                                         const ChVector3d& to,
                                         ChCollisionModel* model,
                                         ChRayhitResult& result) const {
+    result.hit = false;
+    result.hitShape = nullptr;
     return false;
 }
 
+ChCollisionShape* ChCollisionSystemMulticore::GetHitShape(ChCollisionModel* model, int shape_id) const {
+    auto model_mc = (ChCollisionModelMulticore*)model->GetImplementation();
+    auto index = cd_data->shape_data.local_rigid[shape_id];
+    return model_mc->m_shapes[index].get();
+}
+
 // -----------------------------------------------------------------------------
 
 void DrawHemisphere(ChCollisionSystem::VisualizationCallback* vis,
@@ -826,6 +1089,27 @@ void ChCollisionSystemMulticore::VisualizeShapes() {
                 vis_callback->DrawLine(ToChVector(C), ToChVector(A), ChColor(1, 0, 0));
                 break;
             }
+            case ChCollisionShape::Type::TRIANGLEMESH: {
+                const vec3& mesh = cd_data->shape_data.trimesh_rigid[start];
+                const real3* triangles = &cd_data->shape_data.trimesh_triangles[3 * mesh.y];
+                for (int t = 0; t < mesh.z; t++) {
+                    real3 A = Rotate(triangles[3 * t + 0], rotation) + position;
+                    real3 B = Rotate(triangles[3 * t + 1], rotation) + position;
+                    real3 C = Rotate(triangles[3 * t + 2], rotation) + position;
+                    vis_callback->DrawLine(ToChVector(A), ToChVector(B), ChColor(1, 0, 0));
+                    vis_callback->DrawLine(ToChVector(B), ToChVector(C), ChColor(1, 0, 0));
+                    vis_callback->DrawLine(ToChVector(C), ToChVector(A), ChColor(1, 0, 0));
+                }
+                break;
+            }
+            case ChCollisionShape::Type::SDF: {
+                // Draw the distance field grid box
+                ChAABB bbox = cd_data->shape_data.sdf_rigid[start]->GetBoundingBox();
+                real3 center = position + Rotate(FromChVector(bbox.Center()), rotation);
+                DrawBox(vis_callback.get(), ChCoordsys<>(ToChVector(center), ToChQuaternion(rotation)),
+                        bbox.Size() / 2, ChColor(1, 0, 0));
+                break;
+            }
         }
     }
 }
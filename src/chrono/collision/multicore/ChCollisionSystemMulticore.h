@@ -27,6 +27,7 @@
 #include "chrono/collision/multicore/ChCollisionData.h"
 #include "chrono/collision/multicore/ChBroadphase.h"
 #include "chrono/collision/multicore/ChNarrowphase.h"
+#include "chrono/collision/multicore/ChSphereCollider.h"
 
 #include "chrono/multicore_math/ChMulticoreMath.h"
 
@@ -77,12 +78,60 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Use a two-level broadphase grid.
+    /// The fine grid has a variable number of bins, such that there are roughly `density` collision shapes per bin
+    /// (as with SetBroadphaseGridDensity). Shapes spanning more than `large_shape_bins` fine bins in any direction are
+    /// instead binned in a coarse grid, with bins `coarse_factor` times larger than the fine bins in each direction.
+    /// This avoids inserting a few large shapes (e.g., terrain or container walls) in a very large number of bins in
+    /// scenes with a wide range of shape sizes.
+    void SetBroadphaseGridTwoLevel(double density, int large_shape_bins = 4, int coarse_factor = 8);
+
+    /// Enable or disable the incremental (temporal coherence) broadphase (default: false).
+    /// If enabled, the broadphase grid is built from shape AABBs inflated by a margin equal to `margin` plus
+    /// `motion_steps` times the shape displacement over the last step. The candidate pairs are then kept across steps,
+    /// and only the shapes which leave their inflated AABB are re-binned and have their candidate pairs recomputed. A
+    /// full grid update is performed when more than `rebuild_fraction` of all shapes were re-binned, when an inflated
+    /// AABB leaves the grid domain, or when collision models or body active/collide flags change. Incremental updates
+    /// are used only with a single-level grid and in the absence of fluid particles.
+    void SetBroadphaseIncremental(bool val, double margin = 0, double motion_steps = 4, double rebuild_fraction = 0.1);
+
+    /// Broadphase statistics, as computed during the last call to Run().
+    struct BroadphaseStats {
+        ChVector3i bins_per_axis;          ///< number of (fine) grid bins in each direction
+        unsigned int num_bins;             ///< total number of (fine) grid bins
+        unsigned int num_active_bins;      ///< number of bins intersected by at least one shape AABB
+        unsigned int num_intersections;    ///< number of bin - shape AABB intersections
+        unsigned int num_candidate_pairs;  ///< number of candidate pairs passed to the narrowphase
+        unsigned int max_shapes_per_bin;   ///< maximum number of shapes in an active bin
+        double avg_shapes_per_bin;         ///< average number of shapes in an active bin
+        unsigned int num_large_shapes;     ///< number of shapes binned in the coarse grid (two-level grid only)
+        ChVector3i coarse_bins_per_axis;   ///< number of coarse grid bins in each direction (two-level grid only)
+        unsigned int num_coarse_active;    ///< number of active coarse bins (two-level grid only)
+        bool incremental_update;           ///< grid reused from a previous step (incremental broadphase only)
+        unsigned int num_moved_shapes;     ///< shapes re-binned since full grid update (incremental broadphase only)
+    };
+
+    /// Return statistics on the broadphase grid occupancy from the last collision detection pass.
+    BroadphaseStats GetBroadphaseStats() const;
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     void SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm);
 
+    /// Enable or disable the specialized collision detection for systems with sphere shapes (default: false).
+    /// If enabled, this is used automatically whenever all but a small fraction of the collision shapes are spheres,
+    /// there are no 3-dof particles, and the narrowphase algorithm is not ChNarrowphase::Algorithm::MPR. The broadphase
+    /// grid is then replaced by a cell list of sphere centers, and the sphere-sphere tests are vectorized. Pairs
+    /// involving other shapes (e.g., container walls) are still processed by the generic narrowphase (see
+    /// ChSphereCollider). The resulting contacts are identical to those generated by the generic collision detection,
+    /// although possibly in a different order.
+    void EnableSphereCollider(bool val);
+
+    /// Return true if the last collision detection pass used the specialized sphere collision detection.
+    bool IsSphereColliderActive() const { return sphere_collider_active; }
+
     /// Enable monitoring of shapes outside active bounding box (default: false).
     /// If enabled, objects whose collision shapes exit the active bounding box are deactivated (frozen).
     /// The size of the bounding box is specified by its min and max extents.
@@ -129,6 +178,12 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// Currently not implemented.
     virtual bool RayHit(const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests with all collision models for a batch of rays.
+    /// Rays are processed concurrently, in packets of consecutive rays. The shapes not stored in the broadphase grid
+    /// (large shapes with a two-level grid and moved shapes with an incremental broadphase) are culled once per packet;
+    /// the grid itself is traversed separately for each ray.
+    virtual size_t RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const override;
+
     /// Perform a ray-hit test with the specified collision model.
     /// Currently not implemented.
     virtual bool RayHit(const ChVector3d& from,
@@ -158,6 +213,12 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// Generate the current axis-aligned bounding boxes of collision shapes.
     void GenerateAABB();
 
+    /// Update the collision detection statistics after a collision detection pass.
+    void CollectStats();
+
+    /// Return the collision shape with specified global ID, owned by the given collision model.
+    ChCollisionShape* GetHitShape(ChCollisionModel* model, int shape_id) const;
+
     /// Visualize collision shapes (wireframe).
     void VisualizeShapes();
 
@@ -173,6 +234,10 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
 
     ChBroadphase broadphase;    ///< methods for broad-phase collision detection
     ChNarrowphase narrowphase;  ///< methods for narrow-phase collision detection
+    ChSphereCollider spheres;   ///< methods for collision detection with sphere shapes only
+
+    bool use_sphere_collider;     ///< use the specialized sphere collision detection when possible
+    bool sphere_collider_active;  ///< the last pass used the specialized sphere collision detection
 
     std::vector<char> body_active;
 
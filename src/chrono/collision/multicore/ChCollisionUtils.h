@@ -774,6 +774,29 @@ ChApi int box_intersects_triangle(const real3& hdims,
 
 /// @}
 
+// =============================================================================
+
+/// @name Utility functions for triangle mesh BVH
+/// @{
+
+/// Build a static bounding volume hierarchy over the specified triangles (3 consecutive vertices per triangle).
+/// The hierarchy is constructed top-down, splitting at the median triangle centroid along the largest extent of the
+/// centroid bounds, until a node contains at most 'max_leaf_size' triangles. On return, the triangles are reordered so
+/// that every leaf node refers to a contiguous range of triangles; the root node is always the first node.
+ChApi void BuildTriangleMeshBVH(std::vector<real3>& triangles, std::vector<bvh_node>& nodes, int max_leaf_size = 4);
+
+/// Find the triangles of a mesh with an AABB overlapping the given box (expressed in the mesh frame).
+/// The indices of the overlapping triangles (relative to the first triangle of the mesh) are written in 'list', if
+/// provided. The function returns the number of overlapping triangles.
+ChApi int QueryTriangleMeshBVH(const bvh_node* nodes,    ///< BVH nodes of the mesh (root first)
+                               const real3* triangles,   ///< triangle vertices of the mesh (in mesh frame)
+                               const real3& aabb_min,    ///< lower corner of query box (in mesh frame)
+                               const real3& aabb_max,    ///< upper corner of query box (in mesh frame)
+                               int* list                 ///< [output] indices of overlapping triangles (may be null)
+);
+
+/// @}
+
 }  // end namespace mc_utils
 
 /// @} collision_mc
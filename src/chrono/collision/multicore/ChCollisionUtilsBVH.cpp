@@ -0,0 +1,155 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Description: Construction and traversal of the static bounding volume
+// hierarchy used for triangle mesh collision shapes.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <numeric>
+
+#include "chrono/collision/multicore/ChCollisionUtils.h"
+#include "chrono/collision/multicore/ChCollisionData.h"
+
+namespace chrono {
+namespace mc_utils {
+
+// Maximum depth of the BVH traversal stack. A median split BVH has depth log2(N/max_leaf_size), so this is more than
+// enough for any practical mesh.
+static const int bvh_stack_size = 64;
+
+void BuildTriangleMeshBVH(std::vector<real3>& triangles, std::vector<bvh_node>& nodes, int max_leaf_size) {
+    const int num_triangles = (int)(triangles.size() / 3);
+
+    nodes.clear();
+    if (num_triangles == 0)
+        return;
+
+    // Triangle centroids and current triangle order
+    std::vector<real3> centroids(num_triangles);
+    std::vector<int> order(num_triangles);
+    for (int i = 0; i < num_triangles; i++)
+        centroids[i] = (triangles[3 * i + 0] + triangles[3 * i + 1] + triangles[3 * i + 2]) / 3;
+    std::iota(order.begin(), order.end(), 0);
+
+    // Top-down construction, using an explicit stack of (node, first triangle, number of triangles).
+    // The two children of a node are always allocated together.
+    struct Range {
+        int node;
+        int first;
+        int count;
+    };
+    std::vector<Range> stack;
+
+    nodes.reserve(2 * (num_triangles / std::max(max_leaf_size, 1)) + 1);
+    nodes.push_back(bvh_node());
+    stack.push_back({0, 0, num_triangles});
+
+    while (!stack.empty()) {
+        Range r = stack.back();
+        stack.pop_back();
+
+        // Bounds of the triangles and of their centroids
+        real3 bmin(C_REAL_MAX), bmax(-C_REAL_MAX);
+        real3 cmin(C_REAL_MAX), cmax(-C_REAL_MAX);
+        for (int i = r.first; i < r.first + r.count; i++) {
+            int t = order[i];
+            for (int k = 0; k < 3; k++) {
+                bmin = Min(bmin, triangles[3 * t + k]);
+                bmax = Max(bmax, triangles[3 * t + k]);
+            }
+            cmin = Min(cmin, centroids[t]);
+            cmax = Max(cmax, centroids[t]);
+        }
+        nodes[r.node].aabb_min = bmin;
+        nodes[r.node].aabb_max = bmax;
+
+        if (r.count <= max_leaf_size) {
+            nodes[r.node].left = r.first;
+            nodes[r.node].count = r.count;
+            continue;
+        }
+
+        // Split at the median centroid along the largest extent of the centroid bounds
+        real3 extent = cmax - cmin;
+        int axis = 0;
+        if (extent.y > extent[axis])
+            axis = 1;
+        if (extent.z > extent[axis])
+            axis = 2;
+
+        int half = r.count / 2;
+        std::nth_element(order.begin() + r.first, order.begin() + r.first + half, order.begin() + r.first + r.count,
+                         [&centroids, axis](int a, int b) { return centroids[a][axis] < centroids[b][axis]; });
+
+        int left = (int)nodes.size();
+        nodes.push_back(bvh_node());
+        nodes.push_back(bvh_node());
+        nodes[r.node].left = left;
+        nodes[r.node].count = 0;
+
+        stack.push_back({left, r.first, half});
+        stack.push_back({left + 1, r.first + half, r.count - half});
+    }
+
+    // Reorder the triangles so that each leaf refers to a contiguous range
+    std::vector<real3> sorted(triangles.size());
+    for (int i = 0; i < num_triangles; i++) {
+        sorted[3 * i + 0] = triangles[3 * order[i] + 0];
+        sorted[3 * i + 1] = triangles[3 * order[i] + 1];
+        sorted[3 * i + 2] = triangles[3 * order[i] + 2];
+    }
+    triangles.swap(sorted);
+}
+
+int QueryTriangleMeshBVH(const bvh_node* nodes,
+                         const real3* triangles,
+                         const real3& aabb_min,
+                         const real3& aabb_max,
+                         int* list) {
+    int stack[bvh_stack_size];
+    int top = 0;
+    int num_found = 0;
+
+    stack[top++] = 0;
+    while (top > 0) {
+        const bvh_node& node = nodes[stack[--top]];
+        if (!overlap(node.aabb_min, node.aabb_max, aabb_min, aabb_max))
+            continue;
+
+        if (node.count == 0) {
+            stack[top++] = node.left;
+            stack[top++] = node.left + 1;
+            continue;
+        }
+
+        // Leaf node: check the AABB of each triangle
+        for (int t = node.left; t < node.left + node.count; t++) {
+            const real3& A = triangles[3 * t + 0];
+            const real3& B = triangles[3 * t + 1];
+            const real3& C = triangles[3 * t + 2];
+            if (overlap(Min(A, Min(B, C)), Max(A, Max(B, C)), aabb_min, aabb_max)) {
+                if (list)
+                    list[num_found] = t;
+                num_found++;
+            }
+        }
+    }
+
+    return num_found;
+}
+
+}  // end namespace mc_utils
+}  // end namespace chrono
@@ -23,6 +23,9 @@
 
 #include "chrono/multicore_math/utility.h"
 
+#include "chrono/utils/ChOpenMP.h"
+#include "chrono/utils/ChRadixSort.h"
+
 // Always include ChConfig.h *before* any Thrust headers!
 #include "chrono/ChConfig.h"
 #include <thrust/remove.h>
@@ -37,6 +40,7 @@ using namespace chrono::mc_utils;
 
 ChNarrowphase::ChNarrowphase()
     : algorithm(Algorithm::HYBRID),
+      sort_contacts(false),
       num_potential_rigid_contacts(0),
       num_potential_fluid_contacts(0),
       num_potential_rigid_fluid_contacts(0),
@@ -87,24 +91,133 @@ void ChNarrowphase::ProcessRigids() {
 
 // -----------------------------------------------------------------------------
 
+// Express the AABB of the shape 'other' in the frame of the triangle mesh shape 'mesh'.
+static void MeshQueryBox(const ChCollisionData& cd_data, int mesh, int other, real3& qmin, real3& qmax) {
+    const real3& pos = cd_data.shape_data.obj_data_A_global[mesh];
+    const quaternion& rot = cd_data.shape_data.obj_data_R_global[mesh];
+
+    // Note that the shape AABBs are relative to the grid origin
+    real3 center = cd_data.global_origin + 0.5 * (cd_data.aabb_max[other] + cd_data.aabb_min[other]);
+    real3 hdims = 0.5 * (cd_data.aabb_max[other] - cd_data.aabb_min[other]);
+
+    center = TransformParentToLocal(pos, rot, center);
+    hdims = AbsRotate(Inv(rot), hdims);
+    qmin = center - hdims;
+    qmax = center + hdims;
+}
+
+void ChNarrowphase::PreprocessMeshPairs() {
+    const shape_container& shape_data = cd_data->shape_data;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    std::vector<int>& pair_triangleIDs = cd_data->pair_triangleIDs;
+
+    // Nothing to do if there are no triangle mesh shapes
+    pair_triangleIDs.clear();
+    if (shape_data.trimesh_rigid.empty())
+        return;
+
+    const shape_type* obj_data_T = shape_data.typ_rigid.data();
+    const int num_pairs = (int)num_potential_rigid_contacts;
+
+    // Count the candidate pairs generated by each broadphase pair:
+    //   - 1 for a pair without a mesh
+    //   - the number of mesh triangles with an AABB overlapping the AABB of the other shape for a mesh-shape pair
+    //   - 0 for a mesh-mesh or a mesh-SDF pair (not supported)
+    mesh_pair_counts.resize(num_pairs + 1);
+    mesh_pair_counts[num_pairs] = 0;
+
+#pragma omp parallel for
+    for (int index = 0; index < num_pairs; index++) {
+        vec2 pair = I2(int(pair_shapeIDs[index] >> 32), int(pair_shapeIDs[index] & 0xffffffff));
+        bool meshA = obj_data_T[pair.x] == ChCollisionShape::Type::TRIANGLEMESH;
+        bool meshB = obj_data_T[pair.y] == ChCollisionShape::Type::TRIANGLEMESH;
+
+        if (!meshA && !meshB) {
+            mesh_pair_counts[index] = 1;
+        } else if ((meshA && meshB) || obj_data_T[pair.x] == ChCollisionShape::Type::SDF ||
+                   obj_data_T[pair.y] == ChCollisionShape::Type::SDF) {
+            mesh_pair_counts[index] = 0;
+        } else {
+            int mesh = meshA ? pair.x : pair.y;
+            const vec3& mesh_data = shape_data.trimesh_rigid[shape_data.start_rigid[mesh]];
+            real3 qmin, qmax;
+            MeshQueryBox(*cd_data, mesh, meshA ? pair.y : pair.x, qmin, qmax);
+            mesh_pair_counts[index] =
+                QueryTriangleMeshBVH(&shape_data.trimesh_nodes[mesh_data.x],
+                                     &shape_data.trimesh_triangles[3 * mesh_data.y], qmin, qmax, nullptr);
+        }
+    }
+
+    Thrust_Exclusive_Scan(mesh_pair_counts);
+    uint num_mesh_pairs = mesh_pair_counts[num_pairs];
+
+    // Expand the candidate pairs, recording the mesh triangle for each pair involving a mesh
+    mesh_pair_shapeIDs.resize(num_mesh_pairs);
+    pair_triangleIDs.resize(num_mesh_pairs);
+
+#pragma omp parallel for
+    for (int index = 0; index < num_pairs; index++) {
+        uint start = mesh_pair_counts[index];
+        uint count = mesh_pair_counts[index + 1] - start;
+        if (count == 0)
+            continue;
+
+        long long p = pair_shapeIDs[index];
+        vec2 pair = I2(int(p >> 32), int(p & 0xffffffff));
+        bool meshA = obj_data_T[pair.x] == ChCollisionShape::Type::TRIANGLEMESH;
+        bool meshB = obj_data_T[pair.y] == ChCollisionShape::Type::TRIANGLEMESH;
+
+        if (!meshA && !meshB) {
+            pair_triangleIDs[start] = -1;
+        } else {
+            int mesh = meshA ? pair.x : pair.y;
+            const vec3& mesh_data = shape_data.trimesh_rigid[shape_data.start_rigid[mesh]];
+            real3 qmin, qmax;
+            MeshQueryBox(*cd_data, mesh, meshA ? pair.y : pair.x, qmin, qmax);
+            QueryTriangleMeshBVH(&shape_data.trimesh_nodes[mesh_data.x], &shape_data.trimesh_triangles[3 * mesh_data.y],
+                                 qmin, qmax, &pair_triangleIDs[start]);
+        }
+        for (uint i = 0; i < count; i++)
+            mesh_pair_shapeIDs[start + i] = p;
+    }
+
+    pair_shapeIDs.swap(mesh_pair_shapeIDs);
+    num_potential_rigid_contacts = num_mesh_pairs;
+}
+
 int ChNarrowphase::PreprocessCount() {
     // Set the number of potential contact points for each collision pair
     contact_index.resize(num_potential_rigid_contacts + 1);
 
+    // shape type (per shape)
+    const shape_type* obj_data_T = cd_data->shape_data.typ_rigid.data();
+    // encoded shape IDs (per collision pair)
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+
     if (algorithm == Algorithm::MPR) {
         // MPR always reports at most one contact per pair.
         Thrust_Fill(contact_index, 1);
+
+        // Pairs involving a distance field shape are always processed analytically.
+        if (!cd_data->shape_data.sdf_rigid.empty()) {
+#pragma omp parallel for
+            for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+                vec2 pair = I2(int(pair_shapeIDs[index] >> 32), int(pair_shapeIDs[index] & 0xffffffff));
+                shape_type type1 = obj_data_T[pair.x];
+                shape_type type2 = obj_data_T[pair.y];
+                if (type1 == ChCollisionShape::Type::SDF || type2 == ChCollisionShape::Type::SDF) {
+                    bool sphere = type1 == ChCollisionShape::Type::SPHERE || type2 == ChCollisionShape::Type::SPHERE;
+                    contact_index[index] = sphere ? 1 : 8;
+                }
+            }
+        }
     } else {
         // Analytical (and hence the hybrid) algorithms may produce different number
         // of contacts per pair, depending on the interacting shapes:
         //   - an interaction involving a sphere can produce at most one contact
         //   - an interaction involving a capsule can produce up to two contacts
         //   - a box-box interaction can produce up to 8 contacts
-
-        // shape type (per shape)
-        const shape_type* obj_data_T = cd_data->shape_data.typ_rigid.data();
-        // encoded shape IDs (per collision pair)
-        const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+        //   - an interaction involving a distance field can produce up to 8 contacts (1 with a sphere)
 
 #pragma omp parallel for
         for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
@@ -113,9 +226,17 @@ int ChNarrowphase::PreprocessCount() {
             shape_type type1 = obj_data_T[pair.x];
             shape_type type2 = obj_data_T[pair.y];
 
+            // A triangle mesh interacts through its individual triangles
+            if (type1 == ChCollisionShape::Type::TRIANGLEMESH)
+                type1 = ChCollisionShape::Type::TRIANGLE;
+            if (type2 == ChCollisionShape::Type::TRIANGLEMESH)
+                type2 = ChCollisionShape::Type::TRIANGLE;
+
             // Set the maximum number of possible contacts for this particular pair
             if (type1 == ChCollisionShape::Type::SPHERE || type2 == ChCollisionShape::Type::SPHERE) {
                 contact_index[index] = 1;
+            } else if (type1 == ChCollisionShape::Type::SDF || type2 == ChCollisionShape::Type::SDF) {
+                contact_index[index] = 8;
             } else if (type1 == ChCollisionShape::Type::CAPSULE || type2 == ChCollisionShape::Type::CAPSULE) {
                 contact_index[index] = 2;
             } else if (type1 == ChCollisionShape::Type::CYLSHELL || type2 == ChCollisionShape::Type::CYLSHELL) {
@@ -199,7 +320,10 @@ void ChNarrowphase::Dispatch_Init(uint index,
                                   uint& ID_A,
                                   uint& ID_B,
                                   ConvexShape* shapeA,
-                                  ConvexShape* shapeB) {
+                                  ConvexShape* shapeB,
+                                  ConvexShapeTriangle* triangle,
+                                  const ConvexBase*& convexA,
+                                  const ConvexBase*& convexB) {
     const std::vector<uint>& obj_data_ID = cd_data->shape_data.id_rigid;
     const std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
 
@@ -216,6 +340,30 @@ void ChNarrowphase::Dispatch_Init(uint index,
     shapeA->data = &cd_data->shape_data;
     shapeB->data = &cd_data->shape_data;
 
+    convexA = shapeA;
+    convexB = shapeB;
+
+    // For a pair involving a triangle mesh, replace the mesh with the candidate triangle (in global frame)
+    if (!cd_data->pair_triangleIDs.empty() && cd_data->pair_triangleIDs[index] >= 0) {
+        const shape_container& shape_data = cd_data->shape_data;
+        bool meshA = shape_data.typ_rigid[pair.x] == ChCollisionShape::Type::TRIANGLEMESH;
+        int mesh = meshA ? pair.x : pair.y;
+        const vec3& mesh_data = shape_data.trimesh_rigid[shape_data.start_rigid[mesh]];
+        const real3* vertices =
+            &shape_data.trimesh_triangles[3 * (mesh_data.y + cd_data->pair_triangleIDs[index])];
+        const real3& pos = shape_data.obj_data_A_global[mesh];
+        const quaternion& rot = shape_data.obj_data_R_global[mesh];
+
+        triangle->tri[0] = TransformLocalToParent(pos, rot, vertices[0]);
+        triangle->tri[1] = TransformLocalToParent(pos, rot, vertices[1]);
+        triangle->tri[2] = TransformLocalToParent(pos, rot, vertices[2]);
+
+        if (meshA)
+            convexA = triangle;
+        else
+            convexB = triangle;
+    }
+
     //// TODO: what is the best way to dispatch this?
     icoll = contact_index[index];
 }
@@ -240,16 +388,29 @@ void ChNarrowphase::DispatchMPR() {
 
     ConvexShape shapeA;
     ConvexShape shapeB;
+    ConvexShapeTriangle triangle;
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB, triangle)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
+        const ConvexBase* convexA;
+        const ConvexBase* convexB;
 
-        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB, &triangle, convexA, convexB);
 
-        if (MPRCollision(&shapeA, &shapeB, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
+        // Distance field shapes have no support function and are always processed analytically.
+        if (convexA->Type() == ChCollisionShape::Type::SDF || convexB->Type() == ChCollisionShape::Type::SDF) {
+            int nC;
+            if (PRIMSCollision(convexA, convexB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll],
+                               &contactDepth[icoll], &effective_radius[icoll], nC)) {
+                Dispatch_Finalize(icoll, ID_A, ID_B, nC);
+            }
+            continue;
+        }
+
+        if (MPRCollision(convexA, convexB, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
             effective_radius[icoll] = default_eff_radius;
             // The number of contacts reported by MPR is always 1.
             Dispatch_Finalize(icoll, ID_A, ID_B, 1);
@@ -267,16 +428,19 @@ void ChNarrowphase::DispatchPRIMS() {
 
     ConvexShape shapeA;
     ConvexShape shapeB;
+    ConvexShapeTriangle triangle;
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB, triangle)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
+        const ConvexBase* convexA;
+        const ConvexBase* convexB;
 
         int nC;
 
-        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB, &triangle, convexA, convexB);
 
-        if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
+        if (PRIMSCollision(convexA, convexB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
                            &effective_radius[icoll], nC)) {
             Dispatch_Finalize(icoll, ID_A, ID_B, nC);
         }
@@ -293,21 +457,24 @@ void ChNarrowphase::DispatchHybridMPR() {
 
     ConvexShape shapeA;
     ConvexShape shapeB;
+    ConvexShapeTriangle triangle;
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB, triangle)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
+        const ConvexBase* convexA;
+        const ConvexBase* convexB;
 
         int nC;
 
-        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB, &triangle, convexA, convexB);
 
-        if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
+        if (PRIMSCollision(convexA, convexB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
                            &effective_radius[icoll], nC)) {
             Dispatch_Finalize(icoll, ID_A, ID_B, nC);
-        } else if (MPRCollision(&shapeA, &shapeB, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
+        } else if (MPRCollision(convexA, convexB, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
             effective_radius[icoll] = default_eff_radius;
             Dispatch_Finalize(icoll, ID_A, ID_B, 1);
         }
@@ -328,6 +495,9 @@ void ChNarrowphase::ProcessRigidRigid() {
     std::vector<long long>& contact_shapeIDs = cd_data->contact_shapeIDs;
     uint& num_rigid_contacts = cd_data->num_rigid_contacts;
 
+    // Replace candidate pairs involving triangle meshes with candidate pairs involving individual mesh triangles.
+    PreprocessMeshPairs();
+
     // Set maximum possible number of contacts for each potential collision
     // (depending on the narrowphase algorithm and on the types of shapes in
     // potential collision) and calculate the total number of potential contacts.
@@ -379,6 +549,48 @@ void ChNarrowphase::ProcessRigidRigid() {
     erad_data.resize(num_rigid_contacts);
     bids_data.resize(num_rigid_contacts);
     contact_shapeIDs.resize(num_rigid_contacts);
+
+    // The order of the candidate pairs may depend on the history of the broadphase (incremental mode), so optionally
+    // reorder the contacts by the IDs of the shapes in contact.
+    if (sort_contacts)
+        SortRigidContacts();
+}
+
+// Reorder the given array according to the specified permutation.
+template <typename T>
+static void PermuteArray(std::vector<T>& data, const std::vector<unsigned int>& order, std::vector<T>& tmp) {
+    tmp.resize(data.size());
+#pragma omp parallel for
+    for (int i = 0; i < (int)order.size(); i++)
+        tmp[i] = data[order[i]];
+    data.swap(tmp);
+}
+
+void ChNarrowphase::SortRigidContacts() {
+    const uint num_rigid_contacts = cd_data->num_rigid_contacts;
+    const std::vector<long long>& contact_shapeIDs = cd_data->contact_shapeIDs;
+
+    // Contacts for the same pair of shapes are generated in a deterministic order (the sort is stable)
+    contact_keys.resize(num_rigid_contacts);
+#pragma omp parallel for
+    for (int i = 0; i < (int)num_rigid_contacts; i++)
+        contact_keys[i] = (uint64_t)contact_shapeIDs[i];
+
+    contact_order.clear();
+    utils::RadixSort(contact_keys, contact_order, ChOMP::GetMaxThreads());
+
+    std::vector<real3> tmp3;
+    std::vector<real> tmp1;
+    PermuteArray(cd_data->norm_rigid_rigid, contact_order, tmp3);
+    PermuteArray(cd_data->cpta_rigid_rigid, contact_order, tmp3);
+    PermuteArray(cd_data->cptb_rigid_rigid, contact_order, tmp3);
+    PermuteArray(cd_data->dpth_rigid_rigid, contact_order, tmp1);
+    PermuteArray(cd_data->erad_rigid_rigid, contact_order, tmp1);
+
+    std::vector<vec2> tmp_bids;
+    std::vector<long long> tmp_ids;
+    PermuteArray(cd_data->bids_rigid_rigid, contact_order, tmp_bids);
+    PermuteArray(cd_data->contact_shapeIDs, contact_order, tmp_ids);
 }
 
 // -----------------------------------------------------------------------------
@@ -623,30 +835,7 @@ void ChNarrowphase::ProcessRigidFluid() {
                         // if the sphere and the rigid body appear in the same bin more than once, dont count
                         if (current_bin(Amin, Amax, Bmin, Bmax, inv_bin_size, bins_per_axis, bin_number) == true) {
                             if (overlap(Amin, Amax, Bmin, Bmax) && collide(family, fam_data[shape_id_a])) {
-                                ConvexShape* shapeA = new ConvexShape(shape_id_a, &cd_data->shape_data);
-                                real3 ptA, ptB, norm;
-                                real depth, erad = 0;
-                                int nC = 0;
-                                if (PRIMSCollision(shapeA, shapeB, 2 * envelope, &norm, &ptA, &ptB, &depth, &erad,
-                                                   nC)) {
-                                    if (nC == 1) {
-                                        uint bodyA = cd_data->shape_data.id_rigid[shape_id_a];
-                                        neighbor_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = bodyA;
-                                        norm_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = norm;
-                                        cpta_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = ptA;
-                                        dpth_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = depth;
-                                        contact_counts[p]++;
-                                    }
-                                } else if (MPRCollision(
-                                               shapeA, shapeB, envelope,
-                                               norm_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]],
-                                               cpta_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]], ptB,
-                                               dpth_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]])) {
-                                    uint bodyA = cd_data->shape_data.id_rigid[shape_id_a];
-                                    neighbor_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = bodyA;
-                                    contact_counts[p]++;
-                                }
-                                delete shapeA;
+                                ProcessRigidFluidPair(shape_id_a, *shapeB, p);
                             }
                         }
                     }
@@ -656,8 +845,111 @@ void ChNarrowphase::ProcessRigidFluid() {
         }
     }
 
+    // Shapes binned in the coarse grid (two-level broadphase) do not appear in the fine grid bins.
+    // Test all particles against these shapes, using an AABB and collision family prefilter.
+    const std::vector<uint>& large_shapes = cd_data->large_shapes;
+    if (!large_shapes.empty()) {
+#pragma omp parallel for
+        for (int p = 0; p < num_spheres; p++) {
+            real3 pos_sphere = pos_spheres[p];
+            real3 Bmin = pos_sphere - real3(radius + envelope) - global_origin;
+            real3 Bmax = pos_sphere + real3(radius + envelope) - global_origin;
+            ConvexShapeSphere shapeB(pos_sphere, sphere_radius * .5);
+            for (auto shape_id_a : large_shapes) {
+                if (contact_counts[p] >= max_rigid_neighbors)
+                    break;
+                if (overlap(cd_data->aabb_min[shape_id_a], cd_data->aabb_max[shape_id_a], Bmin, Bmax) &&
+                    collide(family, fam_data[shape_id_a])) {
+                    ProcessRigidFluidPair(shape_id_a, shapeB, p);
+                }
+            }
+        }
+    }
+
     Thrust_Exclusive_Scan(contact_counts);
     num_contacts = contact_counts[num_spheres];
 }
 
+void ChNarrowphase::ProcessRigidFluidPair(uint shape_id_a, const ConvexShapeSphere& sphere, uint p) {
+    const real envelope = cd_data->collision_envelope;
+
+    std::vector<real3>& norm_rigid_sphere = cd_data->norm_rigid_fluid;
+    std::vector<real3>& cpta_rigid_sphere = cd_data->cpta_rigid_fluid;
+    std::vector<real>& dpth_rigid_sphere = cd_data->dpth_rigid_fluid;
+    std::vector<int>& neighbor_rigid_sphere = cd_data->neighbor_rigid_fluid;
+    std::vector<int>& contact_counts = cd_data->c_counts_rigid_fluid;
+
+    if (cd_data->shape_data.typ_rigid[shape_id_a] == ChCollisionShape::Type::TRIANGLEMESH) {
+        ProcessRigidFluidMesh(shape_id_a, sphere, p);
+        return;
+    }
+
+    ConvexShape shapeA(shape_id_a, &cd_data->shape_data);
+    real3 ptA, ptB, norm;
+    real depth, erad = 0;
+    int nC = 0;
+    if (PRIMSCollision(&shapeA, &sphere, 2 * envelope, &norm, &ptA, &ptB, &depth, &erad, nC)) {
+        if (nC == 1) {
+            uint bodyA = cd_data->shape_data.id_rigid[shape_id_a];
+            neighbor_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = bodyA;
+            norm_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = norm;
+            cpta_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = ptA;
+            dpth_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = depth;
+            contact_counts[p]++;
+        }
+    } else if (MPRCollision(&shapeA, &sphere, envelope, norm_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]],
+                            cpta_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]], ptB,
+                            dpth_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]])) {
+        uint bodyA = cd_data->shape_data.id_rigid[shape_id_a];
+        neighbor_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = bodyA;
+        contact_counts[p]++;
+    }
+}
+
+void ChNarrowphase::ProcessRigidFluidMesh(uint mesh, const ConvexShapeSphere& sphere, uint p) {
+    const shape_container& shape_data = cd_data->shape_data;
+    const real envelope = cd_data->collision_envelope;
+    const real3 hdims(cd_data->p_kernel_radius + envelope);
+
+    std::vector<real3>& norm_rigid_sphere = cd_data->norm_rigid_fluid;
+    std::vector<real3>& cpta_rigid_sphere = cd_data->cpta_rigid_fluid;
+    std::vector<real>& dpth_rigid_sphere = cd_data->dpth_rigid_fluid;
+    std::vector<int>& neighbor_rigid_sphere = cd_data->neighbor_rigid_fluid;
+    std::vector<int>& contact_counts = cd_data->c_counts_rigid_fluid;
+
+    const vec3& mesh_data = shape_data.trimesh_rigid[shape_data.start_rigid[mesh]];
+    const bvh_node* nodes = &shape_data.trimesh_nodes[mesh_data.x];
+    const real3* triangles = &shape_data.trimesh_triangles[3 * mesh_data.y];
+    const real3& pos = shape_data.obj_data_A_global[mesh];
+    const quaternion& rot = shape_data.obj_data_R_global[mesh];
+    uint bodyA = shape_data.id_rigid[mesh];
+
+    // Find the mesh triangles overlapping the particle AABB (in the mesh frame)
+    static thread_local std::vector<int> candidates;
+    real3 center = TransformParentToLocal(pos, rot, sphere.A());
+    candidates.resize(QueryTriangleMeshBVH(nodes, triangles, center - hdims, center + hdims, nullptr));
+    QueryTriangleMeshBVH(nodes, triangles, center - hdims, center + hdims, candidates.data());
+
+    for (int t : candidates) {
+        if (contact_counts[p] >= max_rigid_neighbors)
+            break;
+
+        real3 A = TransformLocalToParent(pos, rot, triangles[3 * t + 0]);
+        real3 B = TransformLocalToParent(pos, rot, triangles[3 * t + 1]);
+        real3 C = TransformLocalToParent(pos, rot, triangles[3 * t + 2]);
+        ConvexShapeTriangle triangle(A, B, C);
+
+        real3 ptA, ptB, norm;
+        real depth, erad = 0;
+        int nC = 0;
+        if (PRIMSCollision(&triangle, &sphere, 2 * envelope, &norm, &ptA, &ptB, &depth, &erad, nC) && nC == 1) {
+            neighbor_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = bodyA;
+            norm_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = norm;
+            cpta_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = ptA;
+            dpth_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = depth;
+            contact_counts[p]++;
+        }
+    }
+}
+
 }  // end namespace chrono
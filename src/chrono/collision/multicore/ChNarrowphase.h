@@ -33,16 +33,26 @@ namespace chrono {
 ///
 /// Currently supported analytical pair-wise interactions:
 /// <pre>
-///          |  sphere   box   rbox   capsule   cylinder   rcyl   trimesh
-/// ---------+----------------------------------------------------------
-/// sphere   |    Y       Y      Y       Y         Y        Y        Y
-/// box      |            Y      N       Y         N        N        Y
-/// rbox     |                   N       N         N        N        N
-/// capsule  |                           Y         N        N        N
-/// cylinder |                                     N        N        N
-/// rcyl     |                                              N        N
-/// trimesh  |                                                       N
+///          |  sphere   box   rbox   capsule   cylinder   rcyl   trimesh   sdf
+/// ---------+----------------------------------------------------------------
+/// sphere   |    Y       Y      Y       Y         Y        Y        Y       Y
+/// box      |            Y      N       Y         N        N        Y       Y
+/// rbox     |                   N       N         N        N        N       N
+/// capsule  |                           Y         N        N        N       Y
+/// cylinder |                                     N        N        N       N
+/// rcyl     |                                              N        N       N
+/// trimesh  |                                                       N       N
+/// sdf      |                                                               Y
 /// </pre>
+///
+/// Signed distance field (SDF) shapes interact with spheres, capsules, boxes, and other SDF shapes by sampling points
+/// of the other shape in the distance field (and, for boxes and SDF shapes, the field surface points in the other
+/// shape). These pairs are always processed analytically, for any choice of narrowphase algorithm.
+///
+/// Triangle mesh shapes are kept in their local frame, with a static bounding volume hierarchy over the triangles.
+/// The broadphase sees a single AABB per mesh; a mid-phase then queries the mesh BVH with the AABB of the other shape
+/// in each candidate pair and replaces the pair with one candidate pair per overlapping triangle. Mesh-mesh
+/// interactions are not supported.
 class ChApi ChNarrowphase {
   public:
     /// Narrowphase algorithm
@@ -112,6 +122,10 @@ class ChApi ChNarrowphase {
     static const int max_rigid_neighbors = 32;
 
   private:
+    /// Mesh mid-phase: expand each candidate pair involving a triangle mesh into candidate pairs with the mesh
+    /// triangles that overlap the AABB of the other shape.
+    void PreprocessMeshPairs();
+
     /// Calculate total number of potential contacts.
     int PreprocessCount();
 
@@ -128,13 +142,26 @@ class ChApi ChNarrowphase {
     void ProcessRigids();
     void ProcessRigidRigid();
     void ProcessRigidFluid();
+    void ProcessRigidFluidPair(uint shape_id_a, const ConvexShapeSphere& sphere, uint p);
+    void ProcessRigidFluidMesh(uint mesh, const ConvexShapeSphere& sphere, uint p);
 
     void DispatchMPR();
     void DispatchPRIMS();
     void DispatchHybridMPR();
-    void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
+    void Dispatch_Init(uint index,
+                       uint& icoll,
+                       uint& ID_A,
+                       uint& ID_B,
+                       ConvexShape* shapeA,
+                       ConvexShape* shapeB,
+                       ConvexShapeTriangle* triangle,
+                       const ConvexBase*& convexA,
+                       const ConvexBase*& convexB);
     void Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC);
 
+    /// Sort the rigid-rigid contacts by the IDs of the shapes in contact (deterministic mode).
+    void SortRigidContacts();
+
     std::shared_ptr<ChCollisionData> cd_data;
 
     std::vector<char> contact_rigid_active;
@@ -142,11 +169,18 @@ class ChApi ChNarrowphase {
     std::vector<char> contact_fluid_active;
     std::vector<uint> contact_index;
 
+    std::vector<uint> mesh_pair_counts;         ///< number of candidate pairs for each broadphase pair
+    std::vector<long long> mesh_pair_shapeIDs;  ///< expanded shape IDs (mesh mid-phase)
+
     uint num_potential_rigid_contacts;
     uint num_potential_fluid_contacts;
     uint num_potential_rigid_fluid_contacts;
 
     Algorithm algorithm;
+    bool sort_contacts;  ///< sort rigid-rigid contacts by shape IDs (deterministic mode)
+
+    std::vector<uint64_t> contact_keys;       ///< sort keys of rigid-rigid contacts (deterministic mode)
+    std::vector<unsigned int> contact_order;  ///< sorted order of rigid-rigid contacts (deterministic mode)
 
     std::vector<uint> f_bin_intersections;
     std::vector<uint> f_bin_number;
@@ -16,8 +16,12 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+
 #include "chrono/collision/multicore/ChNarrowphase.h"
 #include "chrono/collision/multicore/ChCollisionUtils.h"
+#include "chrono/collision/ChSignedDistanceField.h"
 
 namespace chrono {
 
@@ -1374,6 +1378,223 @@ int triangle_box(const real3& pos1,
     return nc;
 }
 
+// =============================================================================
+//              SDF - SPHERE, CAPSULE, BOX, SDF
+
+// Maximum number of contacts reported for a pair involving a distance field shape (other than a sphere).
+static const int max_sdf_contacts = 8;
+
+// Record a contact for a pair involving a distance field shape, keeping only the deepest max_sdf_contacts contacts.
+static void sdf_add_contact(const real3& norm,
+                            const real& depth,
+                            const real3& pt1,
+                            const real3& pt2,
+                            const real& eff_radius,
+                            real3* ct_norm,
+                            real* ct_depth,
+                            real3* ct_pt1,
+                            real3* ct_pt2,
+                            real* ct_eff_rad,
+                            int& nC) {
+    int i = nC;
+    if (nC < max_sdf_contacts) {
+        nC++;
+    } else {
+        i = (int)(std::max_element(ct_depth, ct_depth + nC) - ct_depth);
+        if (depth >= ct_depth[i])
+            return;
+    }
+    ct_norm[i] = norm;
+    ct_depth[i] = depth;
+    ct_pt1[i] = pt1;
+    ct_pt2[i] = pt2;
+    ct_eff_rad[i] = eff_radius;
+}
+
+// Distance field - sphere narrow phase collision detection.
+// In:  distance field at pos1, with orientation rot1
+//      sphere centered at pos2 with radius2 (a point if radius2 = 0)
+
+bool sdf_sphere(const real3& pos1,
+                const quaternion& rot1,
+                const ChSignedDistanceField* sdf1,
+                const real3& pos2,
+                const real& radius2,
+                const real& separation,
+                real3& norm,
+                real& depth,
+                real3& pt1,
+                real3& pt2,
+                real& eff_radius) {
+    // Express the sphere center in the field frame and sample the field.
+    real3 loc = TransformParentToLocal(pos1, rot1, pos2);
+    double d;
+    ChVector3d g;
+    if (!sdf1->EvaluateSphere(ToChVector(loc), radius2, separation, d, g))
+        return false;
+    real dist = (real)d;
+    real3 grad = FromChVector(g);
+
+    // If the sphere surface is farther than the separation value from the zero level set, there is no contact.
+    depth = dist - radius2;
+    if (depth >= separation)
+        return false;
+
+    // Generate contact information (the field gradient points from the field shape towards the sphere).
+    norm = Rotate(grad, rot1);
+    pt1 = TransformLocalToParent(pos1, rot1, loc - dist * grad);
+    pt2 = pos2 - norm * radius2;
+    eff_radius = radius2 > 0 ? radius2 : edge_radius;
+
+    return true;
+}
+
+// Distance field - capsule narrow phase collision detection.
+// In:  distance field at pos1, with orientation rot1
+//      capsule at pos2, with orientation rot2
+//              capsule has radius2 and half-length hlen2 (in Z direction)
+// Points on the capsule centerline, at most one grid cell apart, are tested as spheres.
+
+int sdf_capsule(const real3& pos1,
+                const quaternion& rot1,
+                const ChSignedDistanceField* sdf1,
+                const real3& pos2,
+                const quaternion& rot2,
+                const real& radius2,
+                const real& hlen2,
+                const real& separation,
+                real3* norm,
+                real* depth,
+                real3* pt1,
+                real3* pt2,
+                real* eff_radius) {
+    real3 W = AMatW(rot2);
+    int n = std::max(1, (int)std::ceil(2 * hlen2 / sdf1->GetCellSize()));
+
+    int nC = 0;
+    for (int i = 0; i <= n; i++) {
+        real3 loc = pos2 + (-hlen2 + (2 * hlen2 * i) / n) * W;
+        real3 c_norm, c_pt1, c_pt2;
+        real c_depth, c_erad;
+        if (sdf_sphere(pos1, rot1, sdf1, loc, radius2, separation, c_norm, c_depth, c_pt1, c_pt2, c_erad))
+            sdf_add_contact(c_norm, c_depth, c_pt1, c_pt2, c_erad, norm, depth, pt1, pt2, eff_radius, nC);
+    }
+
+    return nC;
+}
+
+// Distance field - box narrow phase collision detection.
+// In:  distance field at pos1, with orientation rot1
+//      box at pos2, with orientation rot2, and half-dimensions hdims2
+// The box corners and the midpoints of its edges and faces are sampled in the field. The surface points of the field
+// are tested against the box.
+
+int sdf_box(const real3& pos1,
+            const quaternion& rot1,
+            const ChSignedDistanceField* sdf1,
+            const real3& pos2,
+            const quaternion& rot2,
+            const real3& hdims2,
+            const real& separation,
+            real3* norm,
+            real* depth,
+            real3* pt1,
+            real3* pt2,
+            real* eff_radius) {
+    int nC = 0;
+    real3 c_norm, c_pt1, c_pt2;
+    real c_depth, c_erad;
+
+    // Box points sampled in the field
+    for (int i = -1; i <= 1; i++) {
+        for (int j = -1; j <= 1; j++) {
+            for (int k = -1; k <= 1; k++) {
+                if (i == 0 && j == 0 && k == 0)
+                    continue;
+                real3 loc = TransformLocalToParent(pos2, rot2, real3(i * hdims2.x, j * hdims2.y, k * hdims2.z));
+                if (sdf_sphere(pos1, rot1, sdf1, loc, 0, separation, c_norm, c_depth, c_pt1, c_pt2, c_erad))
+                    sdf_add_contact(c_norm, c_depth, c_pt1, c_pt2, c_erad, norm, depth, pt1, pt2, eff_radius, nC);
+            }
+        }
+    }
+
+    // Field surface points tested against the box (working in the box frame)
+    for (const auto& v : sdf1->GetSurfacePoints()) {
+        real3 pt = TransformLocalToParent(pos1, rot1, FromChVector(v));
+        real3 loc = TransformParentToLocal(pos2, rot2, pt);
+        if (Abs(loc.x) >= hdims2.x + separation || Abs(loc.y) >= hdims2.y + separation ||
+            Abs(loc.z) >= hdims2.z + separation)
+            continue;
+
+        real3 boxPos = loc;
+        real3 dir(0);
+        if (snap_to_box(hdims2, boxPos)) {
+            // Point outside the box
+            real3 delta = loc - boxPos;
+            c_depth = Length(delta);
+            if (c_depth >= separation || c_depth <= 1e-12)
+                continue;
+            dir = delta / c_depth;
+        } else {
+            // Point inside the box: project onto the closest face
+            int axis = 0;
+            real3 gap = hdims2 - Abs(loc);
+            if (gap.y < gap[axis])
+                axis = 1;
+            if (gap.z < gap[axis])
+                axis = 2;
+            real sign = loc[axis] > 0 ? real(1) : real(-1);
+            boxPos[axis] = sign * hdims2[axis];
+            dir[axis] = sign;
+            c_depth = -gap[axis];
+        }
+
+        c_norm = -Rotate(dir, rot2);
+        c_pt2 = TransformLocalToParent(pos2, rot2, boxPos);
+        sdf_add_contact(c_norm, c_depth, pt, c_pt2, edge_radius, norm, depth, pt1, pt2, eff_radius, nC);
+    }
+
+    return nC;
+}
+
+// Distance field - distance field narrow phase collision detection.
+// In:  distance field at pos1, with orientation rot1
+//      distance field at pos2, with orientation rot2
+// The surface points of each field are sampled in the other field.
+
+int sdf_sdf(const real3& pos1,
+            const quaternion& rot1,
+            const ChSignedDistanceField* sdf1,
+            const real3& pos2,
+            const quaternion& rot2,
+            const ChSignedDistanceField* sdf2,
+            const real& separation,
+            real3* norm,
+            real* depth,
+            real3* pt1,
+            real3* pt2,
+            real* eff_radius) {
+    int nC = 0;
+    real3 c_norm, c_pt1, c_pt2;
+    real c_depth, c_erad;
+
+    // Surface points of the second field, sampled in the first field
+    for (const auto& v : sdf2->GetSurfacePoints()) {
+        real3 loc = TransformLocalToParent(pos2, rot2, FromChVector(v));
+        if (sdf_sphere(pos1, rot1, sdf1, loc, 0, separation, c_norm, c_depth, c_pt1, c_pt2, c_erad))
+            sdf_add_contact(c_norm, c_depth, c_pt1, c_pt2, c_erad, norm, depth, pt1, pt2, eff_radius, nC);
+    }
+
+    // Surface points of the first field, sampled in the second field
+    for (const auto& v : sdf1->GetSurfacePoints()) {
+        real3 loc = TransformLocalToParent(pos1, rot1, FromChVector(v));
+        if (sdf_sphere(pos2, rot2, sdf2, loc, 0, separation, c_norm, c_depth, c_pt2, c_pt1, c_erad))
+            sdf_add_contact(-c_norm, c_depth, c_pt1, c_pt2, c_erad, norm, depth, pt1, pt2, eff_radius, nC);
+    }
+
+    return nC;
+}
+
 // =============================================================================
 
 void ChNarrowphase::SetDefaultEdgeRadius(real radius) {
@@ -1413,6 +1634,45 @@ bool ChNarrowphase::PRIMSCollision(const ConvexBase* shapeA,  // first candidate
 
     nC = 0;
 
+    // Pairs involving a distance field shape are always handled here (unsupported pairs produce no contacts).
+    if (shapeA->Type() == ChCollisionShape::Type::SDF || shapeB->Type() == ChCollisionShape::Type::SDF) {
+        bool swap = (shapeA->Type() != ChCollisionShape::Type::SDF);
+        const ConvexBase* sdf = swap ? shapeB : shapeA;
+        const ConvexBase* other = swap ? shapeA : shapeB;
+        real3* pt_sdf = swap ? ct_pt2 : ct_pt1;
+        real3* pt_other = swap ? ct_pt1 : ct_pt2;
+
+        switch (other->Type()) {
+            case ChCollisionShape::Type::SPHERE:
+                if (sdf_sphere(sdf->A(), sdf->R(), sdf->SDF(), other->A(), other->Radius(), separation, *ct_norm,
+                               *ct_depth, *pt_sdf, *pt_other, *ct_eff_rad)) {
+                    nC = 1;
+                }
+                break;
+            case ChCollisionShape::Type::CAPSULE:
+                nC = sdf_capsule(sdf->A(), sdf->R(), sdf->SDF(), other->A(), other->R(), other->Capsule().x,
+                                 other->Capsule().y, separation, ct_norm, ct_depth, pt_sdf, pt_other, ct_eff_rad);
+                break;
+            case ChCollisionShape::Type::BOX:
+                nC = sdf_box(sdf->A(), sdf->R(), sdf->SDF(), other->A(), other->R(), other->Box(), separation, ct_norm,
+                             ct_depth, pt_sdf, pt_other, ct_eff_rad);
+                break;
+            case ChCollisionShape::Type::SDF:
+                nC = sdf_sdf(sdf->A(), sdf->R(), sdf->SDF(), other->A(), other->R(), other->SDF(), separation, ct_norm,
+                             ct_depth, pt_sdf, pt_other, ct_eff_rad);
+                break;
+            default:
+                break;
+        }
+
+        if (swap) {
+            for (int i = 0; i < nC; i++) {
+                *(ct_norm + i) = -(*(ct_norm + i));
+            }
+        }
+        return true;
+    }
+
     if (shapeA->Type() == ChCollisionShape::Type::SPHERE && shapeB->Type() == ChCollisionShape::Type::SPHERE) {
         if (sphere_sphere(shapeA->A(), shapeA->Radius(), shapeB->A(), shapeB->Radius(), separation, *ct_norm, *ct_depth,
                           *ct_pt1, *ct_pt2, *ct_eff_rad)) {
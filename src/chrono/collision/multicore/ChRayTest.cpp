@@ -14,6 +14,8 @@
 
 #include "chrono/collision/multicore/ChRayTest.h"
 #include "chrono/collision/multicore/ChCollisionUtils.h"
+#include "chrono/multicore_math/utility.h"
+#include "chrono/collision/ChSignedDistanceField.h"
 
 // Always include ChConfig.h *before* any Thrust headers!
 #include "chrono/ChConfig.h"
@@ -23,7 +25,8 @@ namespace chrono {
 
 using namespace chrono::mc_utils;
 
-ChRayTest::ChRayTest(std::shared_ptr<ChCollisionData> data) : cd_data(data), num_bin_tests(0), num_shape_tests(0) {}
+ChRayTest::ChRayTest(std::shared_ptr<ChCollisionData> data)
+    : cd_data(data), num_bin_tests(0), num_shape_tests(0), packet_mode(false) {}
 
 // =============================================================================
 
@@ -373,6 +376,53 @@ bool triangle_ray(const real3& A,
     return true;
 }
 
+// Test for intersection between the zero level set of a signed distance field (at `pos` with orientation `rot`) and
+// the specified oriented line segment. The ray is clipped to the field grid and the intersection is then found by
+// sphere tracing. Outside the narrow band the field is clamped to the band width, which is still a safe step length.
+bool sdf_ray(const real3& pos,
+             const quaternion& rot,
+             const ChSignedDistanceField* sdf,
+             const real3& start,
+             const real3& end,
+             real3& normal,
+             real& mindist2) {
+    // Express the ray in the field frame
+    real3 start_S = RotateT(start - pos, rot);
+    real3 end_S = RotateT(end - pos, rot);
+
+    // Find the point where the ray enters the field grid
+    ChAABB bbox = sdf->GetBoundingBox();
+    real3 center = FromChVector(bbox.Center());
+    real3 hdims = FromChVector(bbox.Size() / 2);
+    real t_in;
+    real3 loc_in, nrm_in;
+    if (!aabb_ray(hdims, start_S - center, end_S - center, t_in, loc_in, nrm_in))
+        return false;
+
+    real len = Length(end_S - start_S);
+    if (len <= 0)
+        return false;
+    real3 dir = (end_S - start_S) / len;
+    real tol = real(1e-3) * sdf->GetCellSize();
+
+    // March along the ray, stepping by the distance to the surface
+    real s = Length(loc_in + center - start_S);
+    while (s <= len && s * s <= mindist2) {
+        double dist;
+        ChVector3d grad;
+        sdf->Evaluate(ToChVector(start_S + s * dir), dist, grad);
+        if (dist < tol) {
+            real3 grad_S = FromChVector(grad);
+            normal = Length2(grad_S) > 0 ? Rotate(Normalize(grad_S), rot) : Rotate(-dir, rot);
+            mindist2 = s * s;
+            return true;
+        }
+        s += std::max((real)dist, tol);
+    }
+
+    return false;
+}
+
 // =============================================================================
 
 // Use a variant of the 3D Digital Differential Analyser (Akira Fujimoto, "ARTS: Accelerated Ray Tracing Systems", 1986)
@@ -424,15 +474,46 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
         }
     }
 
-    // Walk through each bin intersected by the ray (DDA).
     ConvexShape shape(-1, &cd_data->shape_data);
     real mindist2 = C_REAL_MAX;
     bool hit = false;
+    int hit_shape = -1;
+
+    // Test ray against all shapes binned in the coarse grid (two-level broadphase) and against all shapes which left
+    // their grid bins since the last full grid update (incremental broadphase), if any.
+    // In packet mode, only those shapes overlapping the packet bounding box are tested.
+    const std::vector<uint>* lists[2] = {&cd_data->large_shapes, &cd_data->moved_shapes};
+    int num_lists = 2;
+    if (packet_mode) {
+        lists[0] = &packet_shapes;
+        num_lists = 1;
+    }
+    for (int l = 0; l < num_lists; l++) {
+        for (auto index : *lists[l]) {
+            num_shape_tests++;
+            shape.index = index;
+            bool shape_hit = (shape.Type() == ChCollisionShape::Type::TRIANGLEMESH)
+                                 ? CheckMesh(shape.index, start, end, info.normal, mindist2)
+                                 : CheckShape(shape, start, end, info.normal, mindist2);
+            if (shape_hit) {
+                hit = true;
+                hit_shape = shape.index;
+            }
+        }
+    }
 
+    // Walk through each bin intersected by the ray (DDA).
     ////std::cout << "Ray start: [" << start.x << "," << start.y << "," << start.z << "]" << std::endl;
     ////std::cout << "Ray end:   [" << end.x << "," << end.y << "," << end.z << "]" << std::endl;
 
-    while (true) {
+    real ray_len2 = Dot(ray);
+    real t_bin = t_min;  // ray parameter at entry in current bin
+
+    while (cd_data->num_active_bins > 0) {
+        // If a large shape was hit closer than the current bin, stop.
+        if (hit && t_bin * t_bin * ray_len2 > mindist2)
+            break;
+
         ////std::cout << "  Test BIN:  [" << bin.x << "," << bin.y << "," << bin.z << "]" << std::endl;
         num_bin_tests++;
 
@@ -441,20 +522,23 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
         auto start_index = bin_start_index_ext[bin_index];
         auto end_index = bin_start_index_ext[bin_index + 1];
 
+        bool bin_hit = false;
         for (uint j = start_index; j < end_index; j++) {
             num_shape_tests++;
             shape.index = bin_aabb_number[j];
             ////std::cout << "    Test SHAPE: " << shape.index << std::endl;
-            if (CheckShape(shape, start, end, info.normal, mindist2))
-                hit = true;
+            bool shape_hit = (shape.Type() == ChCollisionShape::Type::TRIANGLEMESH)
+                                 ? CheckMesh(shape.index, start, end, info.normal, mindist2)
+                                 : CheckShape(shape, start, end, info.normal, mindist2);
+            if (shape_hit) {
+                bin_hit = true;
+                hit_shape = shape.index;
+            }
         }
 
         // If a shape in the current bin was hit, stop.
-        if (hit) {
-            info.shapeID = shape.index;         // Identifier of closest hit shape
-            info.dist = Sqrt(mindist2);         // Distance from ray origin
-            info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
-            info.point = start + info.t * ray;  // Intersection point
+        if (bin_hit) {
+            hit = true;
             break;
         }
 
@@ -465,12 +549,56 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
         bin[axis] += step[axis];
         if (bin[axis] == exit[axis])
             break;
+        t_bin = t_next[axis];
         t_next[axis] += delta[axis];
     }
 
+    if (hit) {
+        info.shapeID = hit_shape;           // Identifier of closest hit shape
+        info.dist = Sqrt(mindist2);         // Distance from ray origin
+        info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
+        info.point = start + info.t * ray;  // Intersection point
+    }
+
     return hit;
 }
 
+// Ray packet intersection test. The shapes outside the broadphase grid (large shapes and moved shapes) are culled
+// against the packet bounding box (in the grid frame, as are the shape AABBs), then each ray is processed with Check.
+int ChRayTest::CheckPacket(int num_rays, const real3* start, const real3* end, RayHitInfo* info) {
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+
+    real3 packet_min(C_REAL_MAX);
+    real3 packet_max(-C_REAL_MAX);
+    for (int i = 0; i < num_rays; i++) {
+        packet_min = Min(packet_min, Min(start[i], end[i]));
+        packet_max = Max(packet_max, Max(start[i], end[i]));
+    }
+    packet_min -= cd_data->global_origin;
+    packet_max -= cd_data->global_origin;
+
+    packet_shapes.clear();
+    for (const auto* list : {&cd_data->large_shapes, &cd_data->moved_shapes}) {
+        for (auto index : *list) {
+            if (index >= aabb_min.size() || overlap(aabb_min[index], aabb_max[index], packet_min, packet_max))
+                packet_shapes.push_back(index);
+        }
+    }
+
+    packet_mode = true;
+    int num_hits = 0;
+    for (int i = 0; i < num_rays; i++) {
+        if (Check(start[i], end[i], info[i]))
+            num_hits++;
+        else
+            info[i].shapeID = -1;
+    }
+    packet_mode = false;
+
+    return num_hits;
+}
+
 // Narrowphase dispatcher for ray intersection test.  It uses analytical formulaes for known primitive shapes with
 // fallback on a generic ray-convex intersection test.
 bool ChRayTest::CheckShape(const ConvexBase& shape,
@@ -493,10 +621,64 @@ bool ChRayTest::CheckShape(const ConvexBase& shape,
         case ChCollisionShape::Type::TRIANGLE:
             return triangle_ray(shape.Triangles()[0], shape.Triangles()[1], shape.Triangles()[2], start, end, normal,
                                 mindist2);
+        case ChCollisionShape::Type::SDF:
+            return sdf_ray(shape.A(), shape.R(), shape.SDF(), start, end, normal, mindist2);
         default:
             //// TODO: fallback on generic ray-convex intersection test
             return false;
     }
 }
 
+// Ray intersection test with a triangle mesh. The ray is transformed to the mesh frame and the mesh BVH is traversed,
+// testing only the triangles in leaf nodes with an AABB intersected by the ray.
+bool ChRayTest::CheckMesh(int index, const real3& start, const real3& end, real3& normal, real& mindist2) {
+    const shape_container& shape_data = cd_data->shape_data;
+    const vec3& mesh_data = shape_data.trimesh_rigid[shape_data.start_rigid[index]];
+    const bvh_node* nodes = &shape_data.trimesh_nodes[mesh_data.x];
+    const real3* triangles = &shape_data.trimesh_triangles[3 * mesh_data.y];
+    const real3& pos = shape_data.obj_data_A_global[index];
+    const quaternion& rot = shape_data.obj_data_R_global[index];
+
+    // Ray in mesh frame (distances are preserved)
+    real3 lstart = TransformParentToLocal(pos, rot, start);
+    real3 lend = TransformParentToLocal(pos, rot, end);
+
+    int stack[64];
+    int top = 0;
+    stack[top++] = 0;
+
+    real3 lnormal;
+    bool hit = false;
+    while (top > 0) {
+        const bvh_node& node = nodes[stack[--top]];
+        real3 center = 0.5 * (node.aabb_max + node.aabb_min);
+        real3 hdims = 0.5 * (node.aabb_max - node.aabb_min);
+        real t;
+        real3 loc, nrm;
+        if (!aabb_ray(hdims, lstart - center, lend - center, t, loc, nrm))
+            continue;
+        if (t * t * Length2(lend - lstart) > mindist2)
+            continue;
+
+        if (node.count == 0) {
+            stack[top++] = node.left;
+            stack[top++] = node.left + 1;
+            continue;
+        }
+
+        for (int i = node.left; i < node.left + node.count; i++) {
+            if (triangle_ray(triangles[3 * i + 0], triangles[3 * i + 1], triangles[3 * i + 2], lstart, lend, nrm,
+                             mindist2)) {
+                lnormal = nrm;
+                hit = true;
+            }
+        }
+    }
+
+    if (hit)
+        normal = Rotate(lnormal, rot);
+
+    return hit;
+}
+
 }  // end namespace chrono
@@ -48,6 +48,16 @@ class ChApi ChRayTest {
                RayHitInfo& info     ///< [output] test result info
     );
 
+    /// Check for intersection of a packet of rays with all collision shapes in the system.
+    /// Same as calling Check for each ray in turn, except that the shapes tested outside the broadphase grid (see
+    /// Check) are culled only once, against the bounding box of the entire packet. On return, info[i].shapeID is -1 if
+    /// ray i did not hit any shape. Return the number of rays in the packet which hit a shape.
+    int CheckPacket(int num_rays,        ///< number of rays in packet
+                    const real3* start,  ///< ray start points
+                    const real3* end,    ///< ray end points
+                    RayHitInfo* info     ///< [output] test result info (one per ray)
+    );
+
     /// Return the number of bins visited by the DDA algorithm during the last ray test.
     uint GetNumBinTests() const { return num_bin_tests; }
 
@@ -63,7 +73,17 @@ class ChApi ChRayTest {
                     real& mindist2            ///< [output] smallest squared distance to ray origin
     );
 
+    /// Ray intersection test with the triangles of a mesh shape, using the mesh BVH.
+    bool CheckMesh(int index,           ///< index of the triangle mesh shape
+                   const real3& start,  ///< ray start point
+                   const real3& end,    ///< ray end point
+                   real3& normal,       ///< [output] normal to shape at intersectin point
+                   real& mindist2       ///< [output] smallest squared distance to ray origin
+    );
+
     std::shared_ptr<ChCollisionData> cd_data;  ///< shared collision detection data
+    std::vector<uint> packet_shapes;           ///< shapes outside the grid overlapping the current ray packet
+    bool packet_mode;                          ///< if true, test packet_shapes instead of all shapes outside the grid
     uint num_bin_tests;                        ///< number of bins visited during last ray test
     uint num_shape_tests;                      ///< number of shape checked during last ray test
 };
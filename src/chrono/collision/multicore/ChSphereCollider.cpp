@@ -0,0 +1,516 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Specialized collision detection for systems with sphere shapes only.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+#include "chrono/collision/ChCollisionModel.h"
+#include "chrono/collision/multicore/ChSphereCollider.h"
+#include "chrono/collision/multicore/ChCollisionUtils.h"
+#include "chrono/multicore_math/simd.h"
+#include "chrono/utils/ChOpenMP.h"
+#include "chrono/utils/ChRadixSort.h"
+
+namespace chrono {
+
+using namespace chrono::mc_utils;
+
+// Maximum number of cells in the cell list, per sphere.
+// If the cell size required by the largest sphere would result in more cells, the cells are enlarged.
+static const double max_cells_per_sphere = 8;
+
+// Maximum fraction of non-sphere shapes for using the cell list.
+static const double max_other_fraction = 0.05;
+
+// Offsets of the 13 neighbor cells which follow a cell in grid order (x index varying fastest).
+static const int forward_cells[13][3] = {
+    {1, 0, 0},                                                               //
+    {-1, 1, 0},  {0, 1, 0},  {1, 1, 0},                                      //
+    {-1, -1, 1}, {0, -1, 1}, {1, -1, 1}, {-1, 0, 1}, {0, 0, 1}, {1, 0, 1},  //
+    {-1, 1, 1},  {0, 1, 1},  {1, 1, 1}                                       //
+};
+
+ChSphereCollider::ChSphereCollider()
+    : separation(0), max_extent(0), num_cells(0), num_tested(0), num_filtered(0), num_other_pairs(0) {}
+
+bool ChSphereCollider::CheckShapes() {
+    const int num_shapes = (int)cd_data->num_rigid_shapes;
+    const std::vector<shape_type>& typ_rigid = cd_data->shape_data.typ_rigid;
+    const std::vector<uint>& id_rigid = cd_data->shape_data.id_rigid;
+
+    other_shapes.clear();
+    if (num_shapes == 0 || cd_data->state_data.num_fluid_bodies != 0)
+        return false;
+
+    for (int index = 0; index < num_shapes; index++) {
+        if (typ_rigid[index] != ChCollisionShape::Type::SPHERE && id_rigid[index] != UINT_MAX)
+            other_shapes.push_back(index);
+    }
+
+    return other_shapes.size() <= max_other_fraction * num_shapes;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSphereCollider::ProcessCells() {
+    shape_container& shape_data = cd_data->shape_data;
+    const std::vector<shape_type>& typ_rigid = shape_data.typ_rigid;
+    const std::vector<uint>& id_rigid = shape_data.id_rigid;
+    const std::vector<int>& start_rigid = shape_data.start_rigid;
+    const std::vector<real3>& obj_data_A = shape_data.ObA_rigid;
+    const std::vector<quaternion>& obj_data_R = shape_data.ObR_rigid;
+    const std::vector<real3>& body_pos = *cd_data->state_data.pos_rigid;
+    const std::vector<quaternion>& body_rot = *cd_data->state_data.rot_rigid;
+    const std::vector<char>& body_collide = *cd_data->state_data.collide_rigid;
+
+    std::vector<real3>& aabb_min = cd_data->aabb_min;
+    std::vector<real3>& aabb_max = cd_data->aabb_max;
+
+    const int num_shapes = (int)cd_data->num_rigid_shapes;
+    const real envelope = cd_data->collision_envelope;
+
+    separation = 2 * envelope;
+
+    shape_data.obj_data_A_global.resize(num_shapes);
+    shape_data.obj_data_R_global.resize(num_shapes);
+    radius.resize(num_shapes);
+
+    // Sphere centers. Overall bounding box of all colliding shapes and largest radius of all colliding spheres.
+    real3 min_point(C_REAL_MAX);
+    real3 max_point(-C_REAL_MAX);
+    real max_radius = 0;
+
+#pragma omp parallel
+    {
+        real3 t_min_point(C_REAL_MAX);
+        real3 t_max_point(-C_REAL_MAX);
+        real t_max_radius = 0;
+
+#pragma omp for
+        for (int index = 0; index < num_shapes; index++) {
+            uint id = id_rigid[index];
+            if (id == UINT_MAX)
+                continue;
+
+            bool sphere = typ_rigid[index] == ChCollisionShape::Type::SPHERE;
+            if (sphere) {
+                radius[index] = shape_data.sphere_rigid[start_rigid[index]];
+                shape_data.obj_data_A_global[index] = TransformLocalToParent(body_pos[id], body_rot[id], obj_data_A[index]);
+                shape_data.obj_data_R_global[index] = Mult(body_rot[id], obj_data_R[index]);
+            }
+
+            if (body_collide[id] == 0)
+                continue;
+
+            t_min_point = Min(t_min_point, aabb_min[index]);
+            t_max_point = Max(t_max_point, aabb_max[index]);
+            if (sphere)
+                t_max_radius = std::max(t_max_radius, radius[index]);
+        }
+
+#pragma omp critical
+        {
+            min_point = Min(min_point, t_min_point);
+            max_point = Max(max_point, t_max_point);
+            max_radius = std::max(max_radius, t_max_radius);
+        }
+    }
+
+    if (min_point.x > max_point.x) {
+        min_point = real3(0);
+        max_point = real3(0);
+    }
+
+    cd_data->rigid_min_bounding_point = min_point;
+    cd_data->rigid_max_bounding_point = max_point;
+
+    // Inflate the overall bounding box by a small percentage (as in the broadphase)
+    real3 size = max_point - min_point;
+    min_point = min_point - 1e-3 * size;
+    max_point = max_point + 1e-3 * size;
+
+    cd_data->min_bounding_point = min_point;
+    cd_data->max_bounding_point = max_point;
+    cd_data->global_origin = min_point;
+
+    // Cell size. Any two spheres within the contact separation have their centers in the same or in adjacent cells.
+    real3 diag = max_point - min_point;
+    max_extent = max_radius + envelope;
+    real cell_size = 2 * max_extent;
+    if (cell_size <= 0)
+        cell_size = std::max(Max(diag), real(1));
+
+    vec3& cells_per_axis = cd_data->bins_per_axis;
+    double max_cells = std::max(max_cells_per_sphere * num_shapes, 4096.0);
+    while (true) {
+        cells_per_axis.x = std::max((int)std::ceil(diag.x / cell_size), 1);
+        cells_per_axis.y = std::max((int)std::ceil(diag.y / cell_size), 1);
+        cells_per_axis.z = std::max((int)std::ceil(diag.z / cell_size), 1);
+        double n = double(cells_per_axis.x) * double(cells_per_axis.y) * double(cells_per_axis.z);
+        if (n <= max_cells)
+            break;
+        cell_size *= real(std::cbrt(n / max_cells) * 1.01);
+    }
+
+    num_cells = cells_per_axis.x * cells_per_axis.y * cells_per_axis.z;
+    cd_data->num_bins = num_cells;
+    cd_data->bin_size = real3(cell_size);
+    cd_data->inv_bin_size = real3(1 / cell_size);
+
+    // Cell index of each sphere (num_cells for other shapes and shapes which do not collide).
+    // Shape AABBs relative to the grid origin.
+    const vec3 last_cell = cells_per_axis - vec3(1, 1, 1);
+    const real3 inv_cell_size = cd_data->inv_bin_size;
+    cell_key.resize(num_shapes);
+
+#pragma omp parallel for
+    for (int index = 0; index < num_shapes; index++) {
+        uint id = id_rigid[index];
+        if (id == UINT_MAX) {
+            cell_key[index] = num_cells;
+            continue;
+        }
+        aabb_min[index] -= min_point;
+        aabb_max[index] -= min_point;
+        if (body_collide[id] == 0 || typ_rigid[index] != ChCollisionShape::Type::SPHERE) {
+            cell_key[index] = num_cells;
+            continue;
+        }
+        real3 center = shape_data.obj_data_A_global[index] - min_point;
+        cell_key[index] = Hash_Index(Clamp(HashMin(center, inv_cell_size), vec3(0, 0, 0), last_cell), cells_per_axis);
+    }
+
+    // Sort the shapes by cell index. The sort is stable, so the order of spheres in a cell does not depend on history.
+    cell_order.clear();
+    utils::RadixSort(cell_key, cell_order, ChOMP::GetMaxThreads());
+
+    // Start of each cell in the sorted list; shapes not in the cell list are last (past cell_start[num_cells])
+    cell_start.resize(num_cells + 1);
+
+#pragma omp parallel for
+    for (int i = 0; i <= num_shapes; i++) {
+        uint64_t first = (i == 0) ? 0 : cell_key[cell_order[i - 1]] + 1;
+        uint64_t last = (i == num_shapes) ? num_cells : std::min(cell_key[cell_order[i]], (uint64_t)num_cells);
+        for (uint64_t c = first; c <= last; c++)
+            cell_start[c] = i;
+    }
+
+    // Gather the sphere data in cell order (structure of arrays, for vectorized distance tests)
+    const uint num_spheres = cell_start[num_cells];
+    sorted_x.resize(num_spheres);
+    sorted_y.resize(num_spheres);
+    sorted_z.resize(num_spheres);
+    sorted_r.resize(num_spheres);
+
+#pragma omp parallel for
+    for (int i = 0; i < (int)num_spheres; i++) {
+        const real3& center = shape_data.obj_data_A_global[cell_order[i]];
+        sorted_x[i] = center.x;
+        sorted_y[i] = center.y;
+        sorted_z[i] = center.z;
+        sorted_r[i] = radius[cell_order[i]];
+    }
+
+    // The broadphase grid bins are not used; list all colliding shapes as stored outside the grid (for ray tests)
+    cd_data->large_shapes.assign(cell_order.begin(), cell_order.begin() + num_spheres);
+    for (auto index : other_shapes) {
+        if (body_collide[id_rigid[index]] != 0)
+            cd_data->large_shapes.push_back(index);
+    }
+    cd_data->moved_shapes.clear();
+    cd_data->num_active_bins = 0;
+    cd_data->num_bin_aabb_intersections = 0;
+    cd_data->num_coarse_active_bins = 0;
+    cd_data->num_coarse_intersections = 0;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSphereCollider::ProcessOtherPairs() {
+    const int num_other = (int)other_shapes.size();
+    other_pairs.resize(num_other);
+    uint filtered = 0;
+
+#pragma omp parallel for schedule(dynamic) reduction(+ : filtered)
+    for (int i = 0; i < num_other; i++) {
+        other_pairs[i].clear();
+        filtered += OtherShapePairs(i, other_pairs[i]);
+    }
+
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    pair_shapeIDs.clear();
+    for (const auto& pairs : other_pairs)
+        pair_shapeIDs.insert(pair_shapeIDs.end(), pairs.begin(), pairs.end());
+
+    num_other_pairs = (uint)pair_shapeIDs.size();
+    num_filtered = filtered;
+
+    cd_data->pair_triangleIDs.clear();
+    cd_data->num_possible_collisions = num_other_pairs;
+    cd_data->num_rigid_contacts = num_other_pairs;
+}
+
+uint ChSphereCollider::OtherShapePairs(uint index, std::vector<long long>& pairs) const {
+    const std::vector<uint>& body_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<char>& body_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& body_collide = *cd_data->state_data.collide_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const vec3& cells_per_axis = cd_data->bins_per_axis;
+    const vec3 last_cell = cells_per_axis - vec3(1, 1, 1);
+
+    uint shapeA = other_shapes[index];
+    uint bodyA = body_id[shapeA];
+    if (body_collide[bodyA] == 0)
+        return 0;
+
+    uint filtered = 0;
+    auto check = [&](uint shapeB) {
+        uint bodyB = body_id[shapeB];
+        if (bodyA == bodyB)
+            return;
+        if (!body_active[bodyA] && !body_active[bodyB])
+            return;
+        if (!overlap(aabb_min[shapeA], aabb_max[shapeA], aabb_min[shapeB], aabb_max[shapeB]))
+            return;
+        if (!collide(fam_data[shapeA], fam_data[shapeB])) {
+            filtered++;
+            return;
+        }
+        pairs.push_back((long long)std::min(shapeA, shapeB) << 32 | (long long)std::max(shapeA, shapeB));
+    };
+
+    // Spheres with centers in the cells overlapping the AABB (inflated by the largest sphere AABB half-size).
+    // The cells in a row along the x direction are contiguous in the cell list.
+    vec3 cmin = Clamp(HashMin(aabb_min[shapeA] - real3(max_extent), cd_data->inv_bin_size), vec3(0, 0, 0), last_cell);
+    vec3 cmax = Clamp(HashMin(aabb_max[shapeA] + real3(max_extent), cd_data->inv_bin_size), vec3(0, 0, 0), last_cell);
+    for (int k = cmin.z; k <= cmax.z; k++) {
+        for (int j = cmin.y; j <= cmax.y; j++) {
+            uint first = Hash_Index(vec3(cmin.x, j, k), cells_per_axis);
+            uint last = Hash_Index(vec3(cmax.x, j, k), cells_per_axis);
+            for (uint i = cell_start[first]; i < cell_start[last + 1]; i++)
+                check(cell_order[i]);
+        }
+    }
+
+    // Other shapes following this one
+    for (uint i = index + 1; i < (uint)other_shapes.size(); i++) {
+        uint shapeB = other_shapes[i];
+        if (body_collide[body_id[shapeB]] != 0)
+            check(shapeB);
+    }
+
+    return filtered;
+}
+
+void ChSphereCollider::TestRange(uint index, uint start, uint end, std::vector<uint>& hits) const {
+    const real x = sorted_x[index];
+    const real y = sorted_y[index];
+    const real z = sorted_z[index];
+    const real r = sorted_r[index] + separation;
+
+    // Spheres with (almost) coincident centers are ignored, as the contact direction cannot be decided.
+    static const real min_dist2 = real(1e-12);
+
+    uint j = start;
+
+#if defined(USE_AVX)
+    const __m256d vx = _mm256_set1_pd(x);
+    const __m256d vy = _mm256_set1_pd(y);
+    const __m256d vz = _mm256_set1_pd(z);
+    const __m256d vr = _mm256_set1_pd(r);
+    const __m256d vmin = _mm256_set1_pd(min_dist2);
+    for (; j + 4 <= end; j += 4) {
+        __m256d dx = _mm256_sub_pd(_mm256_loadu_pd(&sorted_x[j]), vx);
+        __m256d dy = _mm256_sub_pd(_mm256_loadu_pd(&sorted_y[j]), vy);
+        __m256d dz = _mm256_sub_pd(_mm256_loadu_pd(&sorted_z[j]), vz);
+        __m256d d2 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)), _mm256_mul_pd(dz, dz));
+        __m256d rsum = _mm256_add_pd(_mm256_loadu_pd(&sorted_r[j]), vr);
+        __m256d in = _mm256_and_pd(_mm256_cmp_pd(d2, _mm256_mul_pd(rsum, rsum), _CMP_LT_OQ),
+                                   _mm256_cmp_pd(d2, vmin, _CMP_GE_OQ));
+        int mask = _mm256_movemask_pd(in);
+        for (int k = 0; mask != 0; k++, mask >>= 1) {
+            if (mask & 1)
+                hits.push_back(j + k);
+        }
+    }
+#elif defined(USE_SSE)
+    const __m128 vx = _mm_set1_ps(x);
+    const __m128 vy = _mm_set1_ps(y);
+    const __m128 vz = _mm_set1_ps(z);
+    const __m128 vr = _mm_set1_ps(r);
+    const __m128 vmin = _mm_set1_ps(min_dist2);
+    for (; j + 4 <= end; j += 4) {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(&sorted_x[j]), vx);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(&sorted_y[j]), vy);
+        __m128 dz = _mm_sub_ps(_mm_loadu_ps(&sorted_z[j]), vz);
+        __m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        __m128 rsum = _mm_add_ps(_mm_loadu_ps(&sorted_r[j]), vr);
+        __m128 in = _mm_and_ps(_mm_cmplt_ps(d2, _mm_mul_ps(rsum, rsum)), _mm_cmpge_ps(d2, vmin));
+        int mask = _mm_movemask_ps(in);
+        for (int k = 0; mask != 0; k++, mask >>= 1) {
+            if (mask & 1)
+                hits.push_back(j + k);
+        }
+    }
+#endif
+
+    for (; j < end; j++) {
+        real dx = sorted_x[j] - x;
+        real dy = sorted_y[j] - y;
+        real dz = sorted_z[j] - z;
+        real d2 = dx * dx + dy * dy + dz * dz;
+        real rsum = sorted_r[j] + r;
+        if (d2 < rsum * rsum && d2 >= min_dist2)
+            hits.push_back(j);
+    }
+}
+
+void ChSphereCollider::ProcessContacts() {
+    const shape_container& shape_data = cd_data->shape_data;
+    const std::vector<uint>& id_rigid = shape_data.id_rigid;
+    const std::vector<short2>& fam_data = shape_data.fam_rigid;
+    const std::vector<char>& body_active = *cd_data->state_data.active_rigid;
+    const vec3& cells_per_axis = cd_data->bins_per_axis;
+
+    const uint num_spheres = cell_start[num_cells];
+    const int num_threads = ChOMP::GetMaxThreads();
+
+    thread_pairs.resize(num_threads);
+    for (auto& pairs : thread_pairs)
+        pairs.clear();
+    uint tested = 0;
+    uint filtered = 0;
+
+    // Each thread processes a contiguous range of the cell list, so that the contacts are always produced in cell list
+    // order, independent of the number of threads.
+#pragma omp parallel num_threads(num_threads) reduction(+ : tested, filtered)
+    {
+        int tid = ChOMP::GetThreadNum();
+        int nthreads = ChOMP::GetNumThreads();
+        uint first = (uint)((uint64_t)num_spheres * tid / nthreads);
+        uint last = (uint)((uint64_t)num_spheres * (tid + 1) / nthreads);
+
+        std::vector<long long>& pairs = thread_pairs[tid];
+        std::vector<uint> hits;
+
+        for (uint i = first; i < last; i++) {
+            uint shapeA = cell_order[i];
+            uint bodyA = id_rigid[shapeA];
+            uint cell = (uint)cell_key[shapeA];
+            vec3 cA = Hash_Decode(cell, cells_per_axis);
+
+            // Spheres following this one in the same cell
+            hits.clear();
+            TestRange(i, i + 1, cell_start[cell + 1], hits);
+            tested += cell_start[cell + 1] - i - 1;
+
+            // Spheres in the forward neighbor cells
+            for (const auto& offset : forward_cells) {
+                vec3 cB(cA.x + offset[0], cA.y + offset[1], cA.z + offset[2]);
+                if (cB.x < 0 || cB.y < 0 || cB.z < 0 || cB.x >= cells_per_axis.x || cB.y >= cells_per_axis.y ||
+                    cB.z >= cells_per_axis.z)
+                    continue;
+                uint neighbor = Hash_Index(cB, cells_per_axis);
+                TestRange(i, cell_start[neighbor], cell_start[neighbor + 1], hits);
+                tested += cell_start[neighbor + 1] - cell_start[neighbor];
+            }
+
+            for (auto j : hits) {
+                uint shapeB = cell_order[j];
+                uint bodyB = id_rigid[shapeB];
+                if (bodyA == bodyB)
+                    continue;
+                if (!body_active[bodyA] && !body_active[bodyB])
+                    continue;
+                if (!collide(fam_data[shapeA], fam_data[shapeB])) {
+                    filtered++;
+                    continue;
+                }
+                pairs.push_back((long long)std::min(shapeA, shapeB) << 32 | (long long)std::max(shapeA, shapeB));
+            }
+        }
+    }
+
+    num_tested = tested;
+    num_filtered += filtered;
+
+    // Offsets of the contacts found by each thread (after the contacts already present)
+    std::vector<uint> offsets(num_threads + 1, cd_data->num_rigid_contacts);
+    for (int t = 0; t < num_threads; t++)
+        offsets[t + 1] = offsets[t] + (uint)thread_pairs[t].size();
+    const uint num_contacts = offsets[num_threads];
+    const uint num_sphere_contacts = num_contacts - offsets[0];
+    const uint pair_base = (uint)cd_data->pair_shapeIDs.size();
+
+    std::vector<real3>& norm_data = cd_data->norm_rigid_rigid;
+    std::vector<real3>& cpta_data = cd_data->cpta_rigid_rigid;
+    std::vector<real3>& cptb_data = cd_data->cptb_rigid_rigid;
+    std::vector<real>& dpth_data = cd_data->dpth_rigid_rigid;
+    std::vector<real>& erad_data = cd_data->erad_rigid_rigid;
+    std::vector<vec2>& bids_data = cd_data->bids_rigid_rigid;
+    std::vector<long long>& contact_shapeIDs = cd_data->contact_shapeIDs;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+
+    norm_data.resize(num_contacts);
+    cpta_data.resize(num_contacts);
+    cptb_data.resize(num_contacts);
+    dpth_data.resize(num_contacts);
+    erad_data.resize(num_contacts);
+    bids_data.resize(num_contacts);
+    contact_shapeIDs.resize(num_contacts);
+    pair_shapeIDs.resize(pair_base + num_sphere_contacts);
+
+    // Generate the contact information (same as the sphere-sphere test in ChNarrowphase)
+#pragma omp parallel for schedule(dynamic)
+    for (int t = 0; t < num_threads; t++) {
+        const std::vector<long long>& pairs = thread_pairs[t];
+        for (size_t k = 0; k < pairs.size(); k++) {
+            uint icoll = offsets[t] + (uint)k;
+            int s1 = int(pairs[k] >> 32);
+            int s2 = int(pairs[k] & 0xffffffff);
+            const real3& pos1 = shape_data.obj_data_A_global[s1];
+            const real3& pos2 = shape_data.obj_data_A_global[s2];
+            real r1 = radius[s1];
+            real r2 = radius[s2];
+
+            real3 delta = pos2 - pos1;
+            real dist = Length(delta);
+            real3 norm = delta / dist;
+
+            norm_data[icoll] = norm;
+            cpta_data[icoll] = pos1 + norm * r1;
+            cptb_data[icoll] = pos2 - norm * r2;
+            dpth_data[icoll] = dist - (r1 + r2);
+            erad_data[icoll] = r1 * r2 / (r1 + r2);
+            bids_data[icoll] = I2(id_rigid[s1], id_rigid[s2]);
+            contact_shapeIDs[icoll] = pairs[k];
+            pair_shapeIDs[pair_base + icoll - offsets[0]] = pairs[k];
+        }
+    }
+
+    cd_data->num_possible_collisions = (uint)pair_shapeIDs.size();
+    cd_data->num_rigid_contacts = num_contacts;
+    cd_data->num_rigid_fluid_contacts = 0;
+    cd_data->num_fluid_contacts = 0;
+    cd_data->c_counts_rigid_fluid.clear();
+}
+
+}  // end namespace chrono
@@ -0,0 +1,102 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Description: Specialized collision detection for systems with sphere shapes only
+//
+// =============================================================================
+
+#pragma once
+
+#include "chrono/collision/multicore/ChCollisionData.h"
+
+namespace chrono {
+
+/// @addtogroup collision_mc
+/// @{
+
+/// Class for performing collision detection in systems in which (almost) all collision shapes are spheres.
+/// The sphere centers are sorted in a uniform grid of cells (a cell list) with cells at least as large as the largest
+/// sphere diameter plus the contact separation, so that each sphere only needs to be tested against the spheres in its
+/// own cell and in the 13 neighbor cells which follow it in grid order. The distance tests against all spheres in a
+/// neighbor cell are vectorized (AVX or SSE, if enabled). Sphere-sphere contacts are written directly in the rigid-rigid
+/// contact arrays of the shared collision data, with the same conventions as the sphere-sphere test of the generic
+/// narrowphase (see ChNarrowphase).\n
+/// The few other shapes (e.g., container walls), if any, are not stored in the cell list. Candidate pairs involving
+/// these shapes are found by querying the cell list with their AABBs and must be processed by the generic narrowphase.\n
+/// The broadphase grid bins are not generated; instead, all colliding shapes are listed in ChCollisionData::large_shapes
+/// (the shapes stored outside the grid), so that ray intersection tests remain valid.
+class ChApi ChSphereCollider {
+  public:
+    ChSphereCollider();
+
+    /// Check if the current set of collision shapes can be processed by this class and collect the non-sphere shapes.
+    /// Return true if there are no 3-dof particles, and at least one shape, with spheres making up all but a small
+    /// fraction of the shapes.
+    bool CheckShapes();
+
+    /// Sort the sphere centers in the cell list.
+    /// On input, the shape AABBs must be available (in the global frame). This function sets the overall bounding box,
+    /// offsets the shape AABBs (relative to the grid origin), and sets the sphere positions and orientations in the
+    /// global frame.
+    void ProcessCells();
+
+    /// Find the candidate pairs involving at least one non-sphere shape, based on AABB overlap.
+    /// The candidate pairs are loaded in the shared data object, as done by the broadphase (see ChBroadphase).
+    void ProcessOtherPairs();
+
+    /// Find all pairs of spheres in contact and load the contact information in the shared data object.
+    /// The sphere-sphere contacts are appended to the contacts already present (ChCollisionData::num_rigid_contacts).
+    void ProcessContacts();
+
+  private:
+    /// Test the sphere at the specified position in the cell list against the spheres in the range [start, end) and
+    /// append the positions of all spheres within the contact separation to 'hits'.
+    void TestRange(uint index, uint start, uint end, std::vector<uint>& hits) const;
+
+    /// Find the candidate pairs between the specified non-sphere shape and the spheres or the non-sphere shapes that
+    /// follow it in the list of non-sphere shapes, and append them to 'pairs'.
+    /// Return the number of overlapping pairs culled by collision families.
+    uint OtherShapePairs(uint index, std::vector<long long>& pairs) const;
+
+    std::shared_ptr<ChCollisionData> cd_data;
+
+    real separation;                 ///< contact separation (twice the collision envelope)
+    real max_extent;                 ///< largest half-size of a sphere AABB
+    uint num_cells;                  ///< total number of cells in the cell list
+    uint num_tested;                 ///< number of sphere pairs passed to the distance test
+    uint num_filtered;               ///< number of overlapping pairs culled by collision families
+    uint num_other_pairs;            ///< number of candidate pairs involving non-sphere shapes
+    std::vector<uint> other_shapes;  ///< IDs of non-sphere shapes
+    std::vector<uint64_t> cell_key;  ///< cell index of each shape (num_cells for non-sphere or non-colliding shapes)
+    std::vector<uint> cell_order;    ///< shape IDs sorted by cell index
+    std::vector<uint> cell_start;    ///< start of each cell in the sorted lists [num_cells+1]
+    std::vector<real> sorted_x;      ///< x coordinate of sphere centers, sorted by cell index
+    std::vector<real> sorted_y;      ///< y coordinate of sphere centers, sorted by cell index
+    std::vector<real> sorted_z;      ///< z coordinate of sphere centers, sorted by cell index
+    std::vector<real> sorted_r;      ///< sphere radii, sorted by cell index
+    std::vector<real> radius;        ///< radius of each sphere shape
+
+    /// Contact pairs (encoded shape IDs) found by each thread, in cell list order.
+    std::vector<std::vector<long long>> thread_pairs;
+
+    /// Candidate pairs (encoded shape IDs) found for each non-sphere shape.
+    std::vector<std::vector<long long>> other_pairs;
+
+    friend class ChCollisionSystemMulticore;
+    friend class ChCollisionSystemChronoMulticore;
+};
+
+/// @} collision_mc
+
+}  // end namespace chrono
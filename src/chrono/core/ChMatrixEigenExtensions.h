@@ -96,9 +96,11 @@ void ArchiveOut(chrono::ChArchiveOut& archive_out) {
         double* foo = 0;
         chrono::ChValueSpecific<double*> specVal(foo, "data", 0);
         archive_out.out_array_pre(specVal, tot_elements);
-        for (size_t i = 0; i < tot_elements; i++) {
-            archive_out << chrono::CHNVP(derived()((Eigen::Index)i), std::to_string(i).c_str());
-            archive_out.out_array_between(specVal, tot_elements);
+        if (!ArchiveOutRawData(archive_out, specVal)) {
+            for (size_t i = 0; i < tot_elements; i++) {
+                archive_out << chrono::CHNVP(derived()((Eigen::Index)i), std::to_string(i).c_str());
+                archive_out.out_array_between(specVal, tot_elements);
+            }
         }
         archive_out.out_array_end(specVal, tot_elements);
     }
@@ -121,11 +123,46 @@ void ArchiveIn(chrono::ChArchiveIn& archive_in) {
     // custom input of matrix data as array
     size_t tot_elements = derived().rows() * derived().cols();
     archive_in.in_array_pre("data", tot_elements);
-    for (size_t i = 0; i < tot_elements; i++) {
-        archive_in >> chrono::CHNVP(derived()((Eigen::Index)i), std::to_string(i).c_str());
-        archive_in.in_array_between("data");
+    if (!ArchiveInRawData(archive_in)) {
+        for (size_t i = 0; i < tot_elements; i++) {
+            archive_in >> chrono::CHNVP(derived()((Eigen::Index)i), std::to_string(i).c_str());
+            archive_in.in_array_between("data");
+        }
     }
     archive_in.in_array_end("data");
 }
 
+/// Write the coefficients of a plain matrix as a single raw block, if supported by the archive.
+/// Coefficients are stored contiguously, in the same order as the linear indexing used for per-element output.
+template <typename D = Derived>
+bool ArchiveOutRawData(chrono::ChArchiveOut& archive_out,
+                       chrono::ChValue& specVal,
+                       typename std::enable_if<std::is_base_of<PlainObjectBase<D>, D>::value &&
+                                               chrono::ChArchiveRawTraits<Scalar>::is_raw>::type* = 0) {
+    return archive_out.out_array_raw(specVal, derived().data(), (size_t)derived().size(), sizeof(Scalar));
+}
+
+template <typename D = Derived>
+bool ArchiveOutRawData(chrono::ChArchiveOut& archive_out,
+                       chrono::ChValue& specVal,
+                       typename std::enable_if<!(std::is_base_of<PlainObjectBase<D>, D>::value &&
+                                                 chrono::ChArchiveRawTraits<Scalar>::is_raw)>::type* = 0) {
+    return false;
+}
+
+/// Read the coefficients of a plain matrix as a single raw block, if supported by the archive.
+template <typename D = Derived>
+bool ArchiveInRawData(chrono::ChArchiveIn& archive_in,
+                      typename std::enable_if<std::is_base_of<PlainObjectBase<D>, D>::value &&
+                                              chrono::ChArchiveRawTraits<Scalar>::is_raw>::type* = 0) {
+    return archive_in.in_array_raw("data", derived().data(), (size_t)derived().size(), sizeof(Scalar));
+}
+
+template <typename D = Derived>
+bool ArchiveInRawData(chrono::ChArchiveIn& archive_in,
+                      typename std::enable_if<!(std::is_base_of<PlainObjectBase<D>, D>::value &&
+                                                chrono::ChArchiveRawTraits<Scalar>::is_raw)>::type* = 0) {
+    return false;
+}
+
 #endif
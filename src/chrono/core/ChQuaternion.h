@@ -398,6 +398,14 @@ class ChQuaternion {
 
 CH_CLASS_VERSION(ChQuaternion<double>, 0)
 
+/// Arrays of quaternions can be serialized as raw blocks of coefficients (see ChArchiveRawTraits).
+template <class Real>
+struct ChArchiveRawTraits<ChQuaternion<Real>, typename std::enable_if<std::is_arithmetic<Real>::value>::type> {
+    static const bool is_raw = sizeof(ChQuaternion<Real>) == 4 * sizeof(Real);
+    static const bool is_versioned = true;
+    typedef Real scalar_type;
+};
+
 // -----------------------------------------------------------------------------
 
 /// Alias for double-precision quaternions.
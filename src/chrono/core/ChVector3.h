@@ -269,6 +269,14 @@ class ChVector3 {
 
 CH_CLASS_VERSION(ChVector3<double>, 0)
 
+/// Arrays of vectors can be serialized as raw blocks of coordinates (see ChArchiveRawTraits).
+template <class Real>
+struct ChArchiveRawTraits<ChVector3<Real>, typename std::enable_if<std::is_arithmetic<Real>::value>::type> {
+    static const bool is_raw = sizeof(ChVector3<Real>) == 3 * sizeof(Real);
+    static const bool is_versioned = true;
+    typedef Real scalar_type;
+};
+
 // -----------------------------------------------------------------------------
 
 /// Alias for double-precision vectors.
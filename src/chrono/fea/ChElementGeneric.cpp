@@ -19,33 +19,39 @@
 namespace chrono {
 namespace fea {
 
+// Per-thread scratch vectors and matrices for the element contributions. ChMesh evaluates consecutively elements of the
+// same type, so these are resized only when the element type changes (avoiding a heap allocation per element call).
+static thread_local ChVectorDynamic<> scratch_F;
+static thread_local ChVectorDynamic<> scratch_Fg;
+static thread_local ChVectorDynamic<> scratch_w;
+static thread_local ChMatrixDynamic<> scratch_M;
+
 void ChElementGeneric::EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {
-    ChVectorDynamic<> Fi(GetNumCoordsPosLevel());
+    ChVectorDynamic<>& Fi = scratch_F;
+    Fi.resize(GetNumCoordsPosLevel());
     ComputeInternalForces(Fi);
     Fi *= c;
 
-    //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
+    // Note: this may be called from within a parallel OMP for loop, but ChMesh never processes concurrently elements
+    // which share a node, so the global vector R can be updated directly.
 
     unsigned int stride = 0;
     for (unsigned int in = 0; in < GetNumNodes(); in++) {
         unsigned int node_dofs = GetNodeNumCoordsPosLevelActive(in);
-        if (!GetNode(in)->IsFixed()) {
-            for (unsigned int j = 0; j < node_dofs; j++)
-#pragma omp atomic
-                R(GetNode(in)->NodeGetOffsetVelLevel() + j) += Fi(stride + j);
-        }
+        if (!GetNode(in)->IsFixed())
+            R.segment(GetNode(in)->NodeGetOffsetVelLevel(), node_dofs) += Fi.segment(stride, node_dofs);
         stride += GetNodeNumCoordsPosLevel(in);
     }
     // std::cout << "EleIntLoadResidual_F , R=" << R << std::endl;
 }
 
 void ChElementGeneric::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, const double c) {
-    ChMatrixDynamic<> Mi(GetNumCoordsPosLevel(), GetNumCoordsPosLevel());
+    ChMatrixDynamic<>& Mi = scratch_M;
+    Mi.resize(GetNumCoordsPosLevel(), GetNumCoordsPosLevel());
     ComputeMmatrixGlobal(Mi);
 
-    ChVectorDynamic<> mqi(GetNumCoordsPosLevel());
-    mqi.setZero();
+    ChVectorDynamic<>& mqi = scratch_w;
+    mqi.setZero(GetNumCoordsPosLevel());
     unsigned int stride = 0;
     for (unsigned int in = 0; in < GetNumNodes(); in++) {
         unsigned int node_dofs = GetNodeNumCoordsPosLevelActive(in);
@@ -55,7 +61,9 @@ void ChElementGeneric::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVecto
         stride += GetNodeNumCoordsPosLevel(in);
     }
 
-    ChVectorDynamic<> Fi = c * Mi * mqi;
+    ChVectorDynamic<>& Fi = scratch_F;
+    Fi.resize(GetNumCoordsPosLevel());
+    Fi.noalias() = c * Mi * mqi;
 
     stride = 0;
     for (unsigned int in = 0; in < GetNumNodes(); in++) {
@@ -67,10 +75,13 @@ void ChElementGeneric::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVecto
 }
 
 void ChElementGeneric::EleIntLoadLumpedMass_Md(ChVectorDynamic<>& Md, double& error, const double c) {
-    ChMatrixDynamic<> Mi(GetNumCoordsPosLevel(), GetNumCoordsPosLevel());
+    ChMatrixDynamic<>& Mi = scratch_M;
+    Mi.resize(GetNumCoordsPosLevel(), GetNumCoordsPosLevel());
     ComputeMmatrixGlobal(Mi);
 
-    ChVectorDynamic<> dMi = c * Mi.diagonal();
+    ChVectorDynamic<>& dMi = scratch_w;
+    dMi.resize(GetNumCoordsPosLevel());
+    dMi.noalias() = c * Mi.diagonal();
 
     error = Mi.sum() - Mi.diagonal().sum();
 
@@ -84,21 +95,19 @@ void ChElementGeneric::EleIntLoadLumpedMass_Md(ChVectorDynamic<>& Md, double& er
 }
 
 void ChElementGeneric::EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector3d& G_acc, const double c) {
-    ChVectorDynamic<> Fg(GetNumCoordsPosLevel());
+    ChVectorDynamic<>& Fg = scratch_Fg;
+    Fg.resize(GetNumCoordsPosLevel());
     ComputeGravityForces(Fg, G_acc);
     Fg *= c;
 
-    //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
+    // Note: this may be called from within a parallel OMP for loop, but ChMesh never processes concurrently elements
+    // which share a node, so the global vector R can be updated directly.
 
     unsigned int stride = 0;
     for (unsigned int in = 0; in < GetNumNodes(); in++) {
         unsigned int node_dofs = GetNodeNumCoordsPosLevelActive(in);
-        if (!GetNode(in)->IsFixed()) {
-            for (unsigned int j = 0; j < node_dofs; j++)
-#pragma omp atomic
-                R(GetNode(in)->NodeGetOffsetVelLevel() + j) += Fg(stride + j);
-        }
+        if (!GetNode(in)->IsFixed())
+            R.segment(GetNode(in)->NodeGetOffsetVelLevel(), node_dofs) += Fg.segment(stride, node_dofs);
         stride += GetNodeNumCoordsPosLevel(in);
     }
 }
@@ -1593,6 +1593,11 @@ void ChElementShellANCF_3833::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     // Zero out the Jacobian matrix since the results from each layer will be added to this value
     H.setZero();
 
+    // Workspaces for the strain derivative blocks, allocated once and reused for all layers
+    ChMatrixDynamic<> PE(3 * NSF, 6 * NIP);
+    ChMatrixDynamic<> Scaled_Combined_PE(3 * NSF, 6 * NIP);
+    ChMatrixDynamic<> DScaled_Combined_PE(3 * NSF, 6 * NIP);
+
     // Sum the contribution to the Jacobian matrix layer by layer
     for (int kl = 0; kl < m_numLayers; kl++) {
         // No values from the generalized internal force vector are cached for reuse in the Jacobian.  Instead these
@@ -1635,9 +1640,6 @@ void ChElementShellANCF_3833::ComputeInternalJacobianContIntDamping(ChMatrixRef&
         // The explanation of the calculation above is just too long to write it all on a single line.
         // =============================================================================
 
-        ChMatrixDynamic<> PE;
-        PE.resize(3 * NSF, 6 * NIP);
-
         for (auto i = 0; i < NSF; i++) {
             PE.block<1, NIP>(3 * i, 0 * NIP) = m_SD.block<1, NIP>(i, (3 * kl + 0) * NIP)
                                                    .cwiseProduct(FC.template block<NIP, 1>(0 * NIP, 0).transpose());
@@ -1729,9 +1731,6 @@ void ChElementShellANCF_3833::ComputeInternalJacobianContIntDamping(ChMatrixRef&
         // calculating this matrix.
         // =============================================================================
 
-        ChMatrixDynamic<> Scaled_Combined_PE;
-        Scaled_Combined_PE.resize(3 * NSF, 6 * NIP);
-
         for (auto i = 0; i < NSF; i++) {
             Scaled_Combined_PE.block<1, NIP>(3 * i, 0) =
                 m_SD.block<1, NIP>(i, (3 * kl + 0) * NIP)
@@ -1823,9 +1822,6 @@ void ChElementShellANCF_3833::ComputeInternalJacobianContIntDamping(ChMatrixRef&
         // Gauss quadrature point
         // =============================================================================
 
-        ChMatrixDynamic<> DScaled_Combined_PE;
-        DScaled_Combined_PE.resize(3 * NSF, 6 * NIP);
-
         DScaled_Combined_PE.template block<3 * NSF, NIP>(0, 0) =
             D(0, 0) * Scaled_Combined_PE.block<3 * NSF, NIP>(0, 0) +
             D(0, 1) * Scaled_Combined_PE.block<3 * NSF, NIP>(0, NIP) +
@@ -2061,6 +2057,11 @@ void ChElementShellANCF_3833::ComputeInternalJacobianContIntNoDamping(ChMatrixRe
     // Zero out the Jacobian matrix since the results from each layer will be added to this value
     H.setZero();
 
+    // Workspaces for the strain derivative blocks, allocated once and reused for all layers
+    ChMatrixDynamic<> PE(3 * NSF, 6 * NIP);
+    ChMatrixDynamic<> Scaled_Combined_PE(3 * NSF, 6 * NIP);
+    ChMatrixDynamic<> DScaled_Combined_PE(3 * NSF, 6 * NIP);
+
     // Sum the contribution to the Jacobian matrix layer by layer
     for (int kl = 0; kl < m_numLayers; kl++) {
         // No values from the generalized internal force vector are cached for reuse in the Jacobian.  Instead these
@@ -2102,8 +2103,6 @@ void ChElementShellANCF_3833::ComputeInternalJacobianContIntNoDamping(ChMatrixRe
         // Note that each partial derivative block shown is placed to the left of the previous block.
         // The explanation of the calculation above is just too long to write it all on a single line.
         // =============================================================================
-        ChMatrixDynamic<> PE;
-        PE.resize(3 * NSF, 6 * NIP);
 
         for (auto i = 0; i < NSF; i++) {
             PE.block<1, NIP>(3 * i, 0) =
@@ -2182,9 +2181,6 @@ void ChElementShellANCF_3833::ComputeInternalJacobianContIntNoDamping(ChMatrixRe
         // row major memory layout to align with the access patterns for calculating this matrix.
         // =============================================================================
 
-        ChMatrixDynamic<> Scaled_Combined_PE;
-        Scaled_Combined_PE.resize(3 * NSF, 6 * NIP);
-
         for (auto i = 0; i < NSF; i++) {
             Scaled_Combined_PE.block<1, NIP>(3 * i, 0) =
                 m_SD.block<1, NIP>(i, (3 * kl + 0) * NIP)
@@ -2275,8 +2271,6 @@ void ChElementShellANCF_3833::ComputeInternalJacobianContIntNoDamping(ChMatrixRe
         // Multiply the scaled and combined partial derivative block matrix by the stiffness matrix for each individual
         // Gauss quadrature point
         // =============================================================================
-        ChMatrixDynamic<> DScaled_Combined_PE;
-        DScaled_Combined_PE.resize(3 * NSF, 6 * NIP);
 
         DScaled_Combined_PE.template block<3 * NSF, NIP>(0, 0) =
             D(0, 0) * Scaled_Combined_PE.block<3 * NSF, NIP>(0, 0) +
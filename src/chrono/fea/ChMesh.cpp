@@ -18,6 +18,8 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <typeindex>
+#include <unordered_map>
 
 #include "chrono/core/ChFrame.h"
 #include "chrono/physics/ChLoad.h"
@@ -47,12 +49,16 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
 
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
+
+    coloring_valid = false;
 }
 
 void ChMesh::SetupInitial() {
     n_dofs = 0;
     n_dofs_w = 0;
 
+    coloring_valid = false;
+
     for (unsigned int i = 0; i < vnodes.size(); i++) {
         if (!vnodes[i]->IsFixed()) {
             vnodes[i]->SetupInitial(GetSystem());
@@ -84,6 +90,7 @@ void ChMesh::ForceToRest() {
 }
 
 void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> node) {
+    coloring_valid = false;
     node->SetIndex(static_cast<unsigned int>(vnodes.size()) + 1);
     vnodes.push_back(node);
 
@@ -95,6 +102,7 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> node) {
 }
 
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
+    coloring_valid = false;
     velements.push_back(elem);
 
     // If the mesh is already added to a system, mark the system uninitialized and out-of-date
@@ -105,6 +113,7 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
 }
 
 void ChMesh::ClearElements() {
+    coloring_valid = false;
     velements.clear();
     vcontactsurfaces.clear();
 
@@ -115,6 +124,7 @@ void ChMesh::ClearElements() {
 }
 
 void ChMesh::ClearNodes() {
+    coloring_valid = false;
     velements.clear();
     vnodes.clear();
     vcontactsurfaces.clear();
@@ -125,6 +135,115 @@ void ChMesh::ClearNodes() {
     }
 }
 
+void ChMesh::ColorElements() {
+    const unsigned int nelements = (unsigned int)velements.size();
+
+    // Collect the element-node connectivity (nodes are identified by their address, as elements may also use nodes
+    // not owned by this mesh)
+    std::unordered_map<ChNodeFEAbase*, unsigned int> node_index;
+    std::vector<unsigned int> elem_start(nelements + 1, 0);
+    std::vector<unsigned int> elem_nodes;
+    for (unsigned int ie = 0; ie < nelements; ie++) {
+        for (unsigned int in = 0; in < velements[ie]->GetNumNodes(); in++) {
+            auto node = velements[ie]->GetNode(in).get();
+            if (!node)
+                continue;
+            auto res = node_index.insert({node, (unsigned int)node_index.size()});
+            elem_nodes.push_back(res.first->second);
+        }
+        elem_start[ie + 1] = (unsigned int)elem_nodes.size();
+    }
+
+    // Node-element adjacency (CSR)
+    const unsigned int nnodes = (unsigned int)node_index.size();
+    std::vector<unsigned int> node_start(nnodes + 1, 0);
+    for (auto n : elem_nodes)
+        node_start[n + 1]++;
+    for (unsigned int n = 0; n < nnodes; n++)
+        node_start[n + 1] += node_start[n];
+    std::vector<unsigned int> node_elems(elem_nodes.size());
+    std::vector<unsigned int> pos(node_start.begin(), node_start.end() - 1);
+    for (unsigned int ie = 0; ie < nelements; ie++) {
+        for (unsigned int k = elem_start[ie]; k < elem_start[ie + 1]; k++)
+            node_elems[pos[elem_nodes[k]]++] = ie;
+    }
+
+    // Greedy coloring: assign to each element the smallest color not used by an already colored neighbor
+    const unsigned int uncolored = nelements;
+    std::vector<unsigned int> elem_color(nelements, uncolored);
+    std::vector<unsigned int> forbidden;  // forbidden[c] == ie if color c is used by a neighbor of element ie
+    std::vector<unsigned int> color_count;
+    for (unsigned int ie = 0; ie < nelements; ie++) {
+        for (unsigned int k = elem_start[ie]; k < elem_start[ie + 1]; k++) {
+            unsigned int n = elem_nodes[k];
+            for (unsigned int j = node_start[n]; j < node_start[n + 1]; j++) {
+                unsigned int color = elem_color[node_elems[j]];
+                if (color != uncolored)
+                    forbidden[color] = ie;
+            }
+        }
+        unsigned int color = 0;
+        while (color < forbidden.size() && forbidden[color] == ie)
+            color++;
+        if (color == forbidden.size()) {
+            forbidden.push_back(uncolored);
+            color_count.push_back(0);
+        }
+        elem_color[ie] = color;
+        color_count[color]++;
+    }
+
+    // Identify the concrete element types (in order of first appearance)
+    std::unordered_map<std::type_index, unsigned int> type_index;
+    std::vector<unsigned int> elem_type(nelements);
+    for (unsigned int ie = 0; ie < nelements; ie++) {
+        auto res = type_index.insert({std::type_index(typeid(*velements[ie])), (unsigned int)type_index.size()});
+        elem_type[ie] = res.first->second;
+    }
+    const unsigned int ntypes = (unsigned int)type_index.size();
+
+    // Sort the elements by color and, within each color, by element type (counting sort). Elements of the same type
+    // are thus evaluated in contiguous batches, running the same kernel on same-size data back to back.
+    const unsigned int ncolors = (unsigned int)color_count.size();
+    std::vector<unsigned int> bucket_start(ncolors * ntypes + 1, 0);
+    for (unsigned int ie = 0; ie < nelements; ie++)
+        bucket_start[elem_color[ie] * ntypes + elem_type[ie] + 1]++;
+    for (unsigned int b = 0; b < ncolors * ntypes; b++)
+        bucket_start[b + 1] += bucket_start[b];
+    color_offsets.resize(ncolors + 1);
+    for (unsigned int c = 0; c <= ncolors; c++)
+        color_offsets[c] = bucket_start[c * ntypes];
+    pos.assign(bucket_start.begin(), bucket_start.end() - 1);
+    color_elements.resize(nelements);
+    for (unsigned int ie = 0; ie < nelements; ie++)
+        color_elements[pos[elem_color[ie] * ntypes + elem_type[ie]]++] = ie;
+
+    coloring_valid = true;
+}
+
+// Apply the given operation to all elements of the mesh. With more than one thread, the colors are processed in
+// sequence and all elements of a given color (which do not share nodes) concurrently.
+template <typename Op>
+static void ForEachElement(const std::vector<std::shared_ptr<ChElementBase>>& elements,
+                           const std::vector<unsigned int>& color_offsets,
+                           const std::vector<unsigned int>& color_elements,
+                           int nthreads,
+                           Op op) {
+    if (nthreads <= 1) {
+        for (unsigned int ie = 0; ie < elements.size(); ie++)
+            op(ie);
+        return;
+    }
+
+    for (size_t c = 0; c + 1 < color_offsets.size(); c++) {
+        const int start = (int)color_offsets[c];
+        const int end = (int)color_offsets[c + 1];
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+        for (int i = start; i < end; i++)
+            op(color_elements[i]);
+    }
+}
+
 void ChMesh::AddContactSurface(std::shared_ptr<ChContactSurface> m_surf) {
     m_surf->SetPhysicsItem(this);
     vcontactsurfaces.push_back(m_surf);
@@ -279,53 +398,48 @@ void ChMesh::IntStateGetIncrement(const unsigned int off_x,
 }
 
 void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    int nthreads = GetSystem()->nthreads_chrono;
+    if (nthreads > 1 && !coloring_valid)
+        ColorElements();
+
     // nodes applied forces
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->IsFixed()) {
-            vnodes[j]->NodeIntLoadResidual_F(off + local_off_v, R, c);
-            local_off_v += vnodes[j]->GetNumCoordsVelLevelActive();
-        }
+    // (node offsets, relative to the mesh, were set in Setup; nodes write to disjoint segments of R)
+#pragma omp parallel for num_threads(nthreads)
+    for (int in = 0; in < (int)vnodes.size(); in++) {
+        if (!vnodes[in]->IsFixed())
+            vnodes[in]->NodeIntLoadResidual_F(off + vnodes[in]->NodeGetOffsetVelLevel() - GetOffset_w(), R, c);
     }
 
-    int nthreads = GetSystem()->nthreads_chrono;
-
     // elements internal forces
     timer_internal_forces.start();
-    //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
-    }
+    ForEachElement(velements, color_offsets, color_elements, nthreads,
+                   [&](unsigned int ie) { velements[ie]->EleIntLoadResidual_F(R, c); });
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->GetGravitationalAcceleration(), c);
-        }
+        const ChVector3d& G_acc = GetSystem()->GetGravitationalAcceleration();
+        ForEachElement(velements, color_offsets, color_elements, nthreads,
+                       [&](unsigned int ie) { velements[ie]->EleIntLoadResidual_F_gravity(R, G_acc, c); });
     }
 
     // nodes gravity forces
-    local_off_v = 0;
     if (automatic_gravity_load && system) {
-        // #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        //// PARALLEL FOR, (no need here to use omp atomic to avoid race condition in writing to R)
-        for (int in = 0; in < vnodes.size(); in++) {
+        const ChVector3d& G_acc = system->GetGravitationalAcceleration();
+#pragma omp parallel for num_threads(nthreads)
+        for (int in = 0; in < (int)vnodes.size(); in++) {
             if (!vnodes[in]->IsFixed()) {
+                unsigned int node_off = off + vnodes[in]->NodeGetOffsetVelLevel() - GetOffset_w();
                 if (auto mnode = std::dynamic_pointer_cast<ChNodeFEAxyz>(vnodes[in])) {
-                    ChVector3d fg = c * mnode->GetMass() * system->GetGravitationalAcceleration();
-                    R.segment(off + local_off_v, 3) += fg.eigen();
+                    ChVector3d fg = c * mnode->GetMass() * G_acc;
+                    R.segment(node_off, 3) += fg.eigen();
                 }
                 // ChNodeFEAxyzrot is not inherited from ChNodeFEAxyz, so must deal with it too
                 if (auto mnode = std::dynamic_pointer_cast<ChNodeFEAxyzrot>(vnodes[in])) {
-                    ChVector3d fg = c * mnode->GetMass() * system->GetGravitationalAcceleration();
-                    R.segment(off + local_off_v, 3) += fg.eigen();
+                    ChVector3d fg = c * mnode->GetMass() * G_acc;
+                    R.segment(node_off, 3) += fg.eigen();
                 }
-                local_off_v += vnodes[in]->GetNumCoordsVelLevelActive();
             }
         }
     }
@@ -406,19 +520,20 @@ void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R re
                                 const ChVectorDynamic<>& w,  ///< the w vector
                                 const double c               ///< a scaling factor
 ) {
+    int nthreads = GetSystem()->nthreads_chrono;
+    if (nthreads > 1 && !coloring_valid)
+        ColorElements();
+
     // nodal masses
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->IsFixed()) {
-            vnodes[j]->NodeIntLoadResidual_Mv(off + local_off_v, R, w, c);
-            local_off_v += vnodes[j]->GetNumCoordsVelLevelActive();
-        }
+#pragma omp parallel for num_threads(nthreads)
+    for (int in = 0; in < (int)vnodes.size(); in++) {
+        if (!vnodes[in]->IsFixed())
+            vnodes[in]->NodeIntLoadResidual_Mv(off + vnodes[in]->NodeGetOffsetVelLevel() - GetOffset_w(), R, w, c);
     }
 
     // internal masses
-    for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_Mv(R, w, c);
-    }
+    ForEachElement(velements, color_offsets, color_elements, nthreads,
+                   [&](unsigned int ie) { velements[ie]->EleIntLoadResidual_Mv(R, w, c); });
 }
 
 void ChMesh::IntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, double& err, const double c) {
@@ -431,10 +546,16 @@ void ChMesh::IntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md,
         }
     }
 
-    // internal masses
-    for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadLumpedMass_Md(Md, err, c);
-    }
+    int nthreads = GetSystem()->nthreads_chrono;
+    if (nthreads > 1 && !coloring_valid)
+        ColorElements();
+
+    // internal masses (the lumping errors of all elements are accumulated in element order)
+    std::vector<double> elem_err(velements.size(), 0.0);
+    ForEachElement(velements, color_offsets, color_elements, nthreads,
+                   [&](unsigned int ie) { velements[ie]->EleIntLoadLumpedMass_Md(Md, elem_err[ie], c); });
+    for (auto e : elem_err)
+        err += e;
 }
 
 void ChMesh::IntToDescriptor(const unsigned int off_v,
@@ -35,7 +35,11 @@ namespace fea {
 /// @addtogroup chrono_fea
 /// @{
 
-/// Class which defines a mesh of finite elements of class ChElementBase using nodes of class ChNodeFEAbase.
+/// Class which defines a mesh of finite elements of class ChElementBase using nodes of class ChNodeFEAbase.\n
+/// If the number of Chrono threads is larger than 1 (see ChSystem::SetNumThreads), the loading of element internal
+/// forces, gravity forces, and mass contributions into the global vectors is done in parallel, using a coloring of the
+/// elements such that elements of the same color do not share nodes. The coloring is cached and recomputed only after
+/// a change in the mesh topology (addition or removal of nodes or elements, or a new initial setup).
 class ChApi ChMesh : public ChIndexedNodes {
   public:
     ChMesh()
@@ -44,7 +48,8 @@ class ChApi ChMesh : public ChIndexedNodes {
           automatic_gravity_load(true),
           num_points_gravity(1),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          coloring_valid(false) {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
@@ -84,6 +89,14 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Override default in ChPhysicsItem.
     virtual bool IsCollisionEnabled() const override { return true; }
 
+    /// Get the number of element colors (sets of elements without common nodes) used for parallel assembly.
+    /// Return 0 if the coloring was not computed yet (this is done only when using more than one thread).
+    unsigned int GetNumElementColors() const { return coloring_valid ? (unsigned int)color_offsets.size() - 1 : 0; }
+
+    /// Force a recomputation of the element coloring at the next parallel assembly.
+    /// Only needed if the nodes of existing elements were changed after the mesh initial setup.
+    void ResetElementColoring() { coloring_valid = false; }
+
     /// Reset counters for internal force and Jacobian evaluations.
     void ResetCounters() {
         ncalls_internal_forces = 0;
@@ -276,6 +289,10 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Color the elements so that no two elements of the same color share a node (greedy coloring).
+    /// Elements are sorted by color and, within each color, grouped by type (preserving their relative order).
+    void ColorElements();
+
     std::vector<std::shared_ptr<ChNodeFEAbase>> vnodes;     ///<  nodes
     std::vector<std::shared_ptr<ChElementBase>> velements;  ///<  elements
 
@@ -293,6 +310,10 @@ class ChApi ChMesh : public ChIndexedNodes {
     unsigned int ncalls_internal_forces;
     unsigned int ncalls_KRMload;
 
+    std::vector<unsigned int> color_offsets;   ///< start of each color in color_elements
+    std::vector<unsigned int> color_elements;  ///< element indices, sorted by color and type
+    bool coloring_valid;                       ///< is the cached element coloring up to date?
+
     friend class chrono::ChSystem;
     friend class chrono::ChAssembly;
     friend class chrono::modal::ChModalAssembly;
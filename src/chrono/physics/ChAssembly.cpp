@@ -444,6 +444,10 @@ void ChAssembly::SetSystem(ChSystem* m_system) {
     }
 }
 
+int ChAssembly::GetNumThreadsChrono() const {
+    return system ? (int)system->GetNumThreadsChrono() : 1;
+}
+
 void ChAssembly::AddCollisionModelsToSystem(ChCollisionSystem* coll_sys) const {
     for (const auto& body : bodylist)
         body->AddCollisionModelsToSystem(coll_sys);
@@ -479,8 +483,12 @@ void ChAssembly::RemoveCollisionModelsFromSystem(ChCollisionSystem* coll_sys) co
 }
 
 void ChAssembly::SyncCollisionModels() {
-    for (auto& body : bodylist) {
-        body->SyncCollisionModels();
+    int nthreads = GetNumThreadsChrono();
+
+    // Collision models of different bodies are synchronized concurrently
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        bodylist[ib]->SyncCollisionModels();
     }
     for (auto& shaft : shaftlist) {
         shaft->SyncCollisionModels();
@@ -648,11 +656,18 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
-    for (auto& body : bodylist) {
+    // Bodies and shafts are updated concurrently (see ChSystem::SetNumThreads), except when assets must also be
+    // updated, since visual models and shapes may be shared by several items.
+    int nthreads = update_assets ? 1 : GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->Update(ChTime, update_assets);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->Update(ChTime, update_assets);
     }
     for (auto& mesh : meshlist) {
@@ -663,6 +678,8 @@ void ChAssembly::Update(bool update_assets) {
     }
     // The state of links depends on the bodylist,shaftlist,meshlist,otherphysicslist,
     // thus the update of linklist must be at the end.
+    // Links are always updated sequentially: their update may modify objects shared with other links (e.g., a
+    // ChFunction driving several motors).
     for (auto& link : linklist) {
         link->Update(ChTime, update_assets);
     }
@@ -693,18 +710,28 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
                                 double& T) {
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreadsChrono();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
+        double T_item;  // each item reports its own time (T is set below)
         if (body->IsActive())
-            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
+            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T_item);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
+        double T_item;  // each item reports its own time (T is set below)
         if (shaft->IsActive())
-            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T);
+            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T_item);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
+        double T_item;  // each item reports its own time (T is set below)
         if (link->IsActive())
-            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T);
+            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T_item);
     }
     for (auto& mesh : meshlist) {
         mesh->IntStateGather(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T);
@@ -730,16 +757,24 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     //    - in particular, bodies and meshes must be processed *before* links, so that links can use
     //      up-to-date body and node information
 
+    // 3. Bodies and shafts are processed concurrently, except for a full update (see ChAssembly::Update); links
+    //    are always processed sequentially.
+
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = full_update ? 1 : GetNumThreadsChrono();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
         else
             body->Update(T, full_update);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T,
                                    full_update);
@@ -771,16 +806,23 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
 
 void ChAssembly::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
     unsigned int displ_a = off_a - this->offset_w;
+    int nthreads = GetNumThreadsChrono();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateGatherAcceleration(displ_a + body->GetOffset_w(), a);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateGatherAcceleration(displ_a + shaft->GetOffset_w(), a);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateGatherAcceleration(displ_a + link->GetOffset_w(), a);
     }
@@ -796,12 +838,17 @@ void ChAssembly::IntStateGatherAcceleration(const unsigned int off_a, ChStateDel
 // From state derivative (acceleration) to system, sometimes might be needed
 void ChAssembly::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
     unsigned int displ_a = off_a - this->offset_w;
+    int nthreads = GetNumThreadsChrono();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateScatterAcceleration(displ_a + body->GetOffset_w(), a);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateScatterAcceleration(displ_a + shaft->GetOffset_w(), a);
     }
@@ -812,7 +859,9 @@ void ChAssembly::IntStateScatterAcceleration(const unsigned int off_a, const ChS
         if (item->IsActive())
             item->IntStateScatterAcceleration(displ_a + item->GetOffset_w(), a);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateScatterAcceleration(displ_a + link->GetOffset_w(), a);
     }
@@ -821,16 +870,23 @@ void ChAssembly::IntStateScatterAcceleration(const unsigned int off_a, const ChS
 // From system to reaction forces (last computed) - some timestepper might need this
 void ChAssembly::IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) {
     unsigned int displ_L = off_L - this->offset_L;
+    int nthreads = GetNumThreadsChrono();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateGatherReactions(displ_L + body->GetOffset_L(), L);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateGatherReactions(displ_L + shaft->GetOffset_L(), L);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateGatherReactions(displ_L + link->GetOffset_L(), L);
     }
@@ -846,12 +902,17 @@ void ChAssembly::IntStateGatherReactions(const unsigned int off_L, ChVectorDynam
 // From reaction forces to system, ex. store last computed reactions in ChLinkBase objects for plotting etc.
 void ChAssembly::IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) {
     unsigned int displ_L = off_L - this->offset_L;
+    int nthreads = GetNumThreadsChrono();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateScatterReactions(displ_L + body->GetOffset_L(), L);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateScatterReactions(displ_L + shaft->GetOffset_L(), L);
     }
@@ -863,7 +924,9 @@ void ChAssembly::IntStateScatterReactions(const unsigned int off_L, const ChVect
             item->IntStateScatterReactions(displ_L + item->GetOffset_L(), L);
     }
     // The state scatter of reactions of link depends on Body1 and Body2, thus it must be at the end.
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateScatterReactions(displ_L + link->GetOffset_L(), L);
     }
@@ -876,18 +939,25 @@ void ChAssembly::IntStateIncrement(const unsigned int off_x,
                                    const ChStateDelta& Dv) {
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreadsChrono();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
     }
 
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateIncrement(displ_x + shaft->GetOffset_x(), x_new, x, displ_v + shaft->GetOffset_w(), Dv);
     }
 
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateIncrement(displ_x + link->GetOffset_x(), x_new, x, displ_v + link->GetOffset_w(), Dv);
     }
@@ -909,18 +979,25 @@ void ChAssembly::IntStateGetIncrement(const unsigned int off_x,
                                       ChStateDelta& Dv) {
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreadsChrono();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateGetIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
     }
 
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateGetIncrement(displ_x + shaft->GetOffset_x(), x_new, x, displ_v + shaft->GetOffset_w(), Dv);
     }
 
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateGetIncrement(displ_x + link->GetOffset_x(), x_new, x, displ_v + link->GetOffset_w(), Dv);
     }
@@ -940,12 +1017,17 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
                                    const double c)          ///< a scaling factor
 {
     unsigned int displ_v = off - this->offset_w;
+    int nthreads = GetNumThreadsChrono();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
     }
@@ -968,12 +1050,17 @@ void ChAssembly::IntLoadResidual_Mv(const unsigned int off,      ///< offset in
                                     const double c               ///< a scaling factor
 ) {
     unsigned int displ_v = off - this->offset_w;
+    int nthreads = GetNumThreadsChrono();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntLoadResidual_Mv(displ_v + body->GetOffset_w(), R, w, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntLoadResidual_Mv(displ_v + shaft->GetOffset_w(), R, w, c);
     }
@@ -992,15 +1079,22 @@ void ChAssembly::IntLoadResidual_Mv(const unsigned int off,      ///< offset in
 
 void ChAssembly::IntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, double& err, const double c) {
     unsigned int displ_v = off - this->offset_w;
+    int nthreads = GetNumThreadsChrono();
+    double err_items = 0;
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads) reduction(+ : err_items)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
-            body->IntLoadLumpedMass_Md(displ_v + body->GetOffset_w(), Md, err, c);
+            body->IntLoadLumpedMass_Md(displ_v + body->GetOffset_w(), Md, err_items, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) reduction(+ : err_items)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
-            shaft->IntLoadLumpedMass_Md(displ_v + shaft->GetOffset_w(), Md, err, c);
+            shaft->IntLoadLumpedMass_Md(displ_v + shaft->GetOffset_w(), Md, err_items, c);
     }
+    err += err_items;
     for (auto& link : linklist) {
         if (link->IsActive())
             link->IntLoadLumpedMass_Md(displ_v + link->GetOffset_w(), Md, err, c);
@@ -1049,16 +1143,23 @@ void ChAssembly::IntLoadConstraint_C(const unsigned int off_L,  ///< offset in Q
                                      double recovery_clamp      ///< value for min/max clamping of c*C
 ) {
     unsigned int displ_L = off_L - this->offset_L;
+    int nthreads = GetNumThreadsChrono();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntLoadConstraint_C(displ_L + body->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntLoadConstraint_C(displ_L + shaft->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntLoadConstraint_C(displ_L + link->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
     }
@@ -1076,16 +1177,23 @@ void ChAssembly::IntLoadConstraint_Ct(const unsigned int off_L,  ///< offset in
                                       const double c             ///< a scaling factor
 ) {
     unsigned int displ_L = off_L - this->offset_L;
+    int nthreads = GetNumThreadsChrono();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntLoadConstraint_Ct(displ_L + body->GetOffset_L(), Qc, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntLoadConstraint_Ct(displ_L + shaft->GetOffset_L(), Qc, c);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntLoadConstraint_Ct(displ_L + link->GetOffset_L(), Qc, c);
     }
@@ -1106,18 +1214,25 @@ void ChAssembly::IntToDescriptor(const unsigned int off_v,
                                  const ChVectorDynamic<>& Qc) {
     unsigned int displ_L = off_L - this->offset_L;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreadsChrono();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntToDescriptor(displ_v + body->GetOffset_w(), v, R, displ_L + body->GetOffset_L(), L, Qc);
     }
 
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntToDescriptor(displ_v + shaft->GetOffset_w(), v, R, displ_L + shaft->GetOffset_L(), L, Qc);
     }
 
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntToDescriptor(displ_v + link->GetOffset_w(), v, R, displ_L + link->GetOffset_L(), L, Qc);
     }
@@ -1138,18 +1253,25 @@ void ChAssembly::IntFromDescriptor(const unsigned int off_v,
                                    ChVectorDynamic<>& L) {
     unsigned int displ_L = off_L - this->offset_L;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreadsChrono();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntFromDescriptor(displ_v + body->GetOffset_w(), v, displ_L + body->GetOffset_L(), L);
     }
 
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntFromDescriptor(displ_v + shaft->GetOffset_w(), v, displ_L + shaft->GetOffset_L(), L);
     }
 
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntFromDescriptor(displ_v + link->GetOffset_w(), v, displ_L + link->GetOffset_L(), L);
     }
@@ -1185,10 +1307,16 @@ void ChAssembly::InjectVariables(ChSystemDescriptor& descriptor) {
 }
 
 void ChAssembly::VariablesFbReset() {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->VariablesFbReset();
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->VariablesFbReset();
     }
     for (auto& link : linklist) {
@@ -1203,10 +1331,16 @@ void ChAssembly::VariablesFbReset() {
 }
 
 void ChAssembly::VariablesFbLoadForces(double factor) {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->VariablesFbLoadForces(factor);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->VariablesFbLoadForces(factor);
     }
     for (auto& link : linklist) {
@@ -1221,10 +1355,16 @@ void ChAssembly::VariablesFbLoadForces(double factor) {
 }
 
 void ChAssembly::VariablesFbIncrementMq() {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->VariablesFbIncrementMq();
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->VariablesFbIncrementMq();
     }
     for (auto& link : linklist) {
@@ -1239,10 +1379,16 @@ void ChAssembly::VariablesFbIncrementMq() {
 }
 
 void ChAssembly::VariablesQbLoadSpeed() {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->VariablesQbLoadSpeed();
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->VariablesQbLoadSpeed();
     }
     for (auto& link : linklist) {
@@ -1257,10 +1403,16 @@ void ChAssembly::VariablesQbLoadSpeed() {
 }
 
 void ChAssembly::VariablesQbSetSpeed(double step) {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->VariablesQbSetSpeed(step);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->VariablesQbSetSpeed(step);
     }
     for (auto& link : linklist) {
@@ -1275,10 +1427,16 @@ void ChAssembly::VariablesQbSetSpeed(double step) {
 }
 
 void ChAssembly::VariablesQbIncrementPosition(double dt_step) {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->VariablesQbIncrementPosition(dt_step);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->VariablesQbIncrementPosition(dt_step);
     }
     for (auto& link : linklist) {
@@ -1311,13 +1469,21 @@ void ChAssembly::InjectConstraints(ChSystemDescriptor& descriptor) {
 }
 
 void ChAssembly::ConstraintsBiReset() {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->ConstraintsBiReset();
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->ConstraintsBiReset();
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->ConstraintsBiReset();
     }
     for (auto& mesh : meshlist) {
@@ -1329,13 +1495,21 @@ void ChAssembly::ConstraintsBiReset() {
 }
 
 void ChAssembly::ConstraintsBiLoad_C(double factor, double recovery_clamp, bool do_clamp) {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
     }
     for (auto& mesh : meshlist) {
@@ -1347,13 +1521,21 @@ void ChAssembly::ConstraintsBiLoad_C(double factor, double recovery_clamp, bool
 }
 
 void ChAssembly::ConstraintsBiLoad_Ct(double factor) {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->ConstraintsBiLoad_Ct(factor);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->ConstraintsBiLoad_Ct(factor);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->ConstraintsBiLoad_Ct(factor);
     }
     for (auto& mesh : meshlist) {
@@ -1365,13 +1547,21 @@ void ChAssembly::ConstraintsBiLoad_Ct(double factor) {
 }
 
 void ChAssembly::ConstraintsBiLoad_Qc(double factor) {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->ConstraintsBiLoad_Qc(factor);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->ConstraintsBiLoad_Qc(factor);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->ConstraintsBiLoad_Qc(factor);
     }
     for (auto& mesh : meshlist) {
@@ -1383,10 +1573,16 @@ void ChAssembly::ConstraintsBiLoad_Qc(double factor) {
 }
 
 void ChAssembly::ConstraintsFbLoadForces(double factor) {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->ConstraintsFbLoadForces(factor);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->ConstraintsFbLoadForces(factor);
     }
     for (auto& link : linklist) {
@@ -1401,13 +1597,21 @@ void ChAssembly::ConstraintsFbLoadForces(double factor) {
 }
 
 void ChAssembly::LoadConstraintJacobians() {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->LoadConstraintJacobians();
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->LoadConstraintJacobians();
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->LoadConstraintJacobians();
     }
     for (auto& mesh : meshlist) {
@@ -1419,13 +1623,21 @@ void ChAssembly::LoadConstraintJacobians() {
 }
 
 void ChAssembly::ConstraintsFetch_react(double factor) {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->ConstraintsFetch_react(factor);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->ConstraintsFetch_react(factor);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->ConstraintsFetch_react(factor);
     }
     for (auto& mesh : meshlist) {
@@ -1455,13 +1667,21 @@ void ChAssembly::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
 }
 
 void ChAssembly::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
     for (auto& mesh : meshlist) {
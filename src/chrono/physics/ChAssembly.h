@@ -27,6 +27,13 @@ namespace chrono {
 /// This class is a container of ChPhysicsItems items i.e. rigid bodies, shafts, links, etc.
 /// ChAssembly objects can also contain other ChAssembly objects. Location and rotation of the
 /// contained ChPhysicsItems are assumed to be expressed with respect to the absolute frame.
+/// If the number of Chrono threads is larger than 1 (see ChSystem::SetNumThreads), the per-item loops over bodies,
+/// shafts, and links are executed in parallel whenever the items write to disjoint ranges of the state and residual
+/// vectors. Links, which load forces and reactions on the connected bodies, are always processed serially in the
+/// residual loading functions; links are also updated serially, since their update may modify objects shared by several
+/// links (e.g., a ChFunction driving several motors). Bodies and shafts are updated serially when assets are also
+/// updated, since visual models may be shared. Meshes and other physics items are always processed serially (but may be
+/// internally multithreaded).
 class ChApi ChAssembly : public ChPhysicsItem {
   public:
     ChAssembly();
@@ -323,6 +330,9 @@ class ChApi ChAssembly : public ChPhysicsItem {
   protected:
     virtual void SetupInitial() override;
 
+    /// Return the number of threads for the loops over bodies, shafts, and links (see ChSystem::SetNumThreads).
+    int GetNumThreadsChrono() const;
+
     std::vector<std::shared_ptr<ChBody>> bodylist;                 ///< list of rigid bodies
     std::vector<std::shared_ptr<ChShaft>> shaftlist;               ///< list of 1-D shafts
     std::vector<std::shared_ptr<ChLinkBase>> linklist;             ///< list of joints (links)
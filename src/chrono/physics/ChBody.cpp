@@ -49,6 +49,8 @@ ChBody::ChBody()
     max_speed = 0.5f;
     max_wvel = 2.0f * float(CH_PI);
 
+    ccd_radius = 0;
+
     sleep_time = 0.6f;
     sleep_starttime = 0;
     sleep_minspeed = 0.1f;
@@ -85,6 +87,8 @@ ChBody::ChBody(const ChBody& other) : ChPhysicsItem(other), ChBodyFrame(other) {
     max_speed = other.max_speed;
     max_wvel = other.max_wvel;
 
+    ccd_radius = other.ccd_radius;
+
     sleep_time = other.sleep_time;
     sleep_starttime = other.sleep_starttime;
     sleep_minspeed = other.sleep_minspeed;
@@ -665,6 +669,12 @@ bool ChBody::IsCollisionEnabled() const {
     return collide;
 }
 
+void ChBody::EnableCCD(double radius) {
+    if (radius <= 0)
+        throw std::invalid_argument("ChBody::EnableCCD: the CCD radius must be positive");
+    ccd_radius = radius;
+}
+
 void ChBody::AddCollisionModelsToSystem(ChCollisionSystem* coll_sys) const {
     if (collide && collision_model)
         coll_sys->Add(collision_model);
@@ -74,6 +74,26 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     /// Return true if collision is enabled for this body.
     virtual bool IsCollisionEnabled() const override;
 
+    /// Enable continuous collision detection (CCD) for this body.
+    /// The body is represented by a bounding sphere of specified radius, centered at the body reference frame. If, at
+    /// the beginning of a step, the body would travel more than the collision envelope during the step, the collision
+    /// system sweeps this sphere along the current body velocity and generates speculative contacts (with positive
+    /// distance) with any collision model found ahead of the body (see ChCollisionSystem::ReportSpeculativeContacts).
+    /// This prevents small, fast bodies from tunneling through thin obstacles without reducing the step size for the
+    /// entire system. The radius should be large enough for the sphere to contain the body's collision shapes.
+    /// Speculative contacts are effective only with the NSC contact method and are currently not generated in a
+    /// Chrono::Multicore system.
+    void EnableCCD(double radius);
+
+    /// Disable continuous collision detection for this body (default).
+    void DisableCCD() { ccd_radius = 0; }
+
+    /// Return true if continuous collision detection is enabled for this body.
+    bool IsCCDEnabled() const { return ccd_radius > 0; }
+
+    /// Return the radius of the bounding sphere used for continuous collision detection (0 if disabled).
+    double GetCCDRadius() const { return ccd_radius; }
+
     /// Enable the maximum linear speed limit (default: false).
     void SetLimitSpeed(bool state);
 
@@ -418,6 +438,8 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     float max_speed;  ///< limit on linear speed
     float max_wvel;   ///< limit on angular velocity
 
+    double ccd_radius;  ///< radius of the bounding sphere for continuous collision detection (0 if disabled)
+
     float sleep_time;
     float sleep_minspeed;
     float sleep_minwvel;
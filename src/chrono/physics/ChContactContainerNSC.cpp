@@ -12,6 +12,10 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+
 #include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
@@ -21,32 +25,13 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChContactContainerNSC)
 
-ChContactContainerNSC::ChContactContainerNSC()
-    : n_added_6_6(0),
-      n_added_6_3(0),
-      n_added_3_3(0),
-      n_added_333_3(0),
-      n_added_333_6(0),
-      n_added_333_333(0),
-      n_added_666_3(0),
-      n_added_666_6(0),
-      n_added_666_333(0),
-      n_added_666_666(0),
-      n_added_6_6_rolling(0) {}
-
-ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other) : ChContactContainer(other) {
-    n_added_6_6 = 0;
-    n_added_6_3 = 0;
-    n_added_3_3 = 0;
-    n_added_333_3 = 0;
-    n_added_333_6 = 0;
-    n_added_333_333 = 0;
-    n_added_666_3 = 0;
-    n_added_666_6 = 0;
-    n_added_666_333 = 0;
-    n_added_666_666 = 0;
-    n_added_6_6_rolling = 0;
-}
+ChContactContainerNSC::ChContactContainerNSC() : cache_enabled(true), cache_tolerance(0.01), cache_hits(0) {}
+
+ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other)
+    : ChContactContainer(other),
+      cache_enabled(other.cache_enabled),
+      cache_tolerance(other.cache_tolerance),
+      cache_hits(0) {}
 
 ChContactContainerNSC::~ChContactContainerNSC() {
     RemoveAllContacts();
@@ -57,138 +42,79 @@ void ChContactContainerNSC::Update(double mytime, bool update_assets) {
     ChContactContainer::Update(mytime, update_assets);
 }
 
-template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        delete (*itercontact);
-        (*itercontact) = 0;
-        ++itercontact;
+void ChContactContainerNSC::RemoveAllContacts() {
+    contactlist_6_6.Clear();
+    contactlist_6_3.Clear();
+    contactlist_3_3.Clear();
+    contactlist_333_3.Clear();
+    contactlist_333_6.Clear();
+    contactlist_333_333.Clear();
+    contactlist_666_3.Clear();
+    contactlist_666_6.Clear();
+    contactlist_666_333.Clear();
+    contactlist_666_666.Clear();
+    contactlist_6_6_rolling.Clear();
+
+    cache_prev.clear();
+    cache_curr.clear();
+    cache_hits = 0;
+}
+
+void ChContactContainerNSC::EnableWarmStartCache(bool val) {
+    cache_enabled = val;
+    if (!val) {
+        cache_prev.clear();
+        cache_curr.clear();
     }
-    contactlist.clear();
-    lastcontact = contactlist.begin();
-    n_added = 0;
 }
 
-void ChContactContainerNSC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
-    _RemoveAllContacts(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling);
+bool ChContactContainerNSC::CacheEntryLess(const CacheEntry& a, const CacheEntry& b) {
+    return std::make_tuple((uintptr_t)a.modelA, (uintptr_t)a.shapeA, (uintptr_t)a.modelB, (uintptr_t)a.shapeB) <
+           std::make_tuple((uintptr_t)b.modelA, (uintptr_t)b.shapeA, (uintptr_t)b.modelB, (uintptr_t)b.shapeB);
 }
 
 void ChContactContainerNSC::BeginAddContact() {
-    lastcontact_6_6 = contactlist_6_6.begin();
-    n_added_6_6 = 0;
-
-    lastcontact_6_3 = contactlist_6_3.begin();
-    n_added_6_3 = 0;
-
-    lastcontact_3_3 = contactlist_3_3.begin();
-    n_added_3_3 = 0;
-
-    lastcontact_333_3 = contactlist_333_3.begin();
-    n_added_333_3 = 0;
-
-    lastcontact_333_6 = contactlist_333_6.begin();
-    n_added_333_6 = 0;
-
-    lastcontact_333_333 = contactlist_333_333.begin();
-    n_added_333_333 = 0;
-
-    lastcontact_666_3 = contactlist_666_3.begin();
-    n_added_666_3 = 0;
-
-    lastcontact_666_6 = contactlist_666_6.begin();
-    n_added_666_6 = 0;
-
-    lastcontact_666_333 = contactlist_666_333.begin();
-    n_added_666_333 = 0;
-
-    lastcontact_666_666 = contactlist_666_666.begin();
-    n_added_666_666 = 0;
-
-    lastcontact_6_6_rolling = contactlist_6_6_rolling.begin();
-    n_added_6_6_rolling = 0;
+    contactlist_6_6.Reset();
+    contactlist_6_3.Reset();
+    contactlist_3_3.Reset();
+    contactlist_333_3.Reset();
+    contactlist_333_6.Reset();
+    contactlist_333_333.Reset();
+    contactlist_666_3.Reset();
+    contactlist_666_6.Reset();
+    contactlist_666_333.Reset();
+    contactlist_666_666.Reset();
+    contactlist_6_6_rolling.Reset();
+
+    // The contacts added at the previous pass (with their final reactions) become the reference for matching the new
+    // contacts. Sort them by shape pair for fast lookup.
+    if (cache_enabled) {
+        cache_prev.assign(cache_curr.begin(), cache_curr.end());
+        std::sort(cache_prev.begin(), cache_prev.end(), CacheEntryLess);
+        cache_curr.clear();
+    }
+    cache_hits = 0;
 }
 
 void ChContactContainerNSC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
-    }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
-    }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
-    }
-
-    while (lastcontact_6_6_rolling != contactlist_6_6_rolling.end()) {
-        delete (*lastcontact_6_6_rolling);
-        lastcontact_6_6_rolling = contactlist_6_6_rolling.erase(lastcontact_6_6_rolling);
-    }
+    // Contacts beyond the last added one are kept in the pools, to be reused at the next collision detection pass
 }
 
-template <class Tcont, class Titer, class Ta, class Tb>
-void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact list
-                           Titer& lastcontact,                        // last contact acquired
-                           int& n_added,                              // number of contacts inserted
+template <class Tcont, class Ta, class Tb>
+void _OptimalContactInsert(ChContactPool<Tcont>& contactlist,         // contact pool
                            ChContactContainerNSC* container,          // contact container
                            Ta* objA,                                  // collidable object A
                            Tb* objB,                                  // collidable object B
                            const ChCollisionInfo& cinfo,              // collision information
                            const ChContactMaterialCompositeNSC& cmat  // composite material
 ) {
-    if (lastcontact != contactlist.end()) {
+    if (Tcont* contact = contactlist.Reuse()) {
         // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
-        lastcontact++;
+        contact->Reset(objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
     } else {
-        // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
-        contactlist.push_back(mc);
-        lastcontact = contactlist.end();
+        // construct new contact in the pool
+        contactlist.Emplace(container, objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
     }
-    n_added++;
 }
 
 void ChContactContainerNSC::AddContact(const ChCollisionInfo& cinfo,
@@ -247,7 +173,63 @@ void ChContactContainerNSC::AddContact(const ChCollisionInfo& cinfo) {
     InsertContact(cinfo, cmat);
 }
 
+float* ChContactContainerNSC::CacheContact(const ChCollisionInfo& cinfo) {
+    // Key the entry by the shape pair in a normalized order (lower address first), so that a contact is matched
+    // regardless of the order in which the collision system reports the two shapes
+    bool swapped = std::make_pair((uintptr_t)cinfo.modelB, (uintptr_t)cinfo.shapeB) <
+                   std::make_pair((uintptr_t)cinfo.modelA, (uintptr_t)cinfo.shapeA);
+
+    CacheEntry entry;
+    entry.modelA = swapped ? cinfo.modelB : cinfo.modelA;
+    entry.shapeA = swapped ? cinfo.shapeB : cinfo.shapeA;
+    entry.modelB = swapped ? cinfo.modelA : cinfo.modelB;
+    entry.shapeB = swapped ? cinfo.shapeA : cinfo.shapeB;
+    entry.pos = entry.modelA->GetContactable()->GetCollisionModelFrame().TransformPointParentToLocal(
+        swapped ? cinfo.vpB : cinfo.vpA);
+    entry.swapped = swapped;
+    entry.reactions[0] = entry.reactions[1] = entry.reactions[2] = 0;
+
+    // Find the closest contact between the same two shapes at the previous pass. The match tolerance is relative to
+    // the size of the smaller of the two collision models.
+    auto range = std::equal_range(cache_prev.begin(), cache_prev.end(), entry, CacheEntryLess);
+    const CacheEntry* match = nullptr;
+    if (range.first != range.second) {
+        double size = std::min(entry.modelA->GetBoundingBox().Size().Length(),
+                               entry.modelB->GetBoundingBox().Size().Length());
+        double min_dist2 = (cache_tolerance * size) * (cache_tolerance * size);
+        for (auto it = range.first; it != range.second; ++it) {
+            double dist2 = (it->pos - entry.pos).Length2();
+            if (dist2 <= min_dist2) {
+                min_dist2 = dist2;
+                match = &(*it);
+            }
+        }
+    }
+    if (match) {
+        // The tangential directions of the contact frame depend on the orientation of the contact normal; if the two
+        // shapes were reported in the opposite order, only the normal reaction is carried over.
+        entry.reactions[0] = match->reactions[0];
+        if (match->swapped == swapped) {
+            entry.reactions[1] = match->reactions[1];
+            entry.reactions[2] = match->reactions[2];
+        }
+        cache_hits++;
+    }
+
+    cache_curr.push_back(entry);
+    return cache_curr.back().reactions;
+}
+
 void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat) {
+    // If the collision system does not provide persistent storage for the contact reactions, use the contact cache.
+    // The new contact is initialized with the cached reactions and will store its reactions in the cache.
+    if (cache_enabled && !cinfo.reaction_cache) {
+        ChCollisionInfo cached_cinfo(cinfo);
+        cached_cinfo.reaction_cache = CacheContact(cinfo);
+        InsertContact(cached_cinfo, cmat);
+        return;
+    }
+
     auto contactableA = cinfo.modelA->GetContactable();
     auto contactableB = cinfo.modelB->GetContactable();
 
@@ -268,25 +250,22 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_3_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_6_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -295,28 +274,25 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6    ***NOTE: for body-body one could have rolling friction: ***
                 if (cmat.rolling_friction || cmat.spinning_friction) {
-                    _OptimalContactInsert(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, this,
-                                          objA, objB, cinfo, cmat);
+                    _OptimalContactInsert(contactlist_6_6_rolling, this, objA, objB, cinfo, cmat);
                 } else {
-                    _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                    _OptimalContactInsert(contactlist_6_6, this, objA, objB, cinfo, cmat);
                 }
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -325,24 +301,20 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -351,23 +323,19 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_666, this, objA, objB, cinfo, cmat);
             }
         } break;
 
@@ -410,8 +378,8 @@ ChVector3d ChContactContainerNSC::GetContactableTorque(ChContactable* contactabl
 }
 
 template <class Tcont>
-void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContacts(ChContactPool<Tcont>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -424,8 +392,9 @@ void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::Repo
 }
 
 template <class Tcont>
-void _ReportAllContactsRolling(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContactsRolling(ChContactPool<Tcont>& contactlist,
+                               ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -453,8 +422,9 @@ void ChContactContainerNSC::ReportAllContacts(std::shared_ptr<ReportContactCallb
 }
 
 template <class Tcont>
-void _ReportAllContactsNSC(std::list<Tcont*>& contactlist, ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContactsNSC(ChContactPool<Tcont>& contactlist,
+                           ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -468,9 +438,9 @@ void _ReportAllContactsNSC(std::list<Tcont*>& contactlist, ChContactContainerNSC
 }
 
 template <class Tcont>
-void _ReportAllContactsRollingNSC(std::list<Tcont*>& contactlist,
+void _ReportAllContactsRollingNSC(ChContactPool<Tcont>& contactlist,
                                   ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -501,11 +471,11 @@ void ChContactContainerNSC::ReportAllContactsNSC(std::shared_ptr<ReportContactCa
 
 template <class Tcont>
 void _IntStateGatherReactions(unsigned int& coffset,
-                              std::list<Tcont*>& contactlist,
+                              ChContactPool<Tcont>& contactlist,
                               const unsigned int off_L,
                               ChVectorDynamic<>& L,
                               const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntStateGatherReactions(off_L + coffset, L);
         coffset += stride;
@@ -530,11 +500,11 @@ void ChContactContainerNSC::IntStateGatherReactions(const unsigned int off_L, Ch
 
 template <class Tcont>
 void _IntStateScatterReactions(unsigned int& coffset,
-                               std::list<Tcont*>& contactlist,
+                               ChContactPool<Tcont>& contactlist,
                                const unsigned int off_L,
                                const ChVectorDynamic<>& L,
                                const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntStateScatterReactions(off_L + coffset, L);
         coffset += stride;
@@ -559,14 +529,14 @@ void ChContactContainerNSC::IntStateScatterReactions(const unsigned int off_L, c
 
 template <class Tcont>
 void _IntLoadResidual_CqL(unsigned int& coffset,           // offset of the contacts
-                          std::list<Tcont*>& contactlist,  // list of contacts
+                          ChContactPool<Tcont>& contactlist,  // list of contacts
                           const unsigned int off_L,        // offset in L multipliers
                           ChVectorDynamic<>& R,            // result: the R residual, R += c*Cq'*L
                           const ChVectorDynamic<>& L,      // the L vector
                           const double c,                  // a scaling factor
                           const int stride                 // stride
 ) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadResidual_CqL(off_L + coffset, R, L, c);
         coffset += stride;
@@ -594,7 +564,7 @@ void ChContactContainerNSC::IntLoadResidual_CqL(const unsigned int off_L,
 
 template <class Tcont>
 void _IntLoadConstraint_C(unsigned int& coffset,           // contact offset
-                          std::list<Tcont*>& contactlist,  // contact list
+                          ChContactPool<Tcont>& contactlist,  // contact list
                           const unsigned int off,          // offset in Qc residual
                           ChVectorDynamic<>& Qc,           // result: the Qc residual, Qc += c*C
                           const double c,                  // a scaling factor
@@ -602,7 +572,7 @@ void _IntLoadConstraint_C(unsigned int& coffset,           // contact offset
                           double recovery_clamp,           // value for min/max clamping of c*C
                           const int stride                 // stride
 ) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadConstraint_C(off + coffset, Qc, c, do_clamp, recovery_clamp);
         coffset += stride;
@@ -631,7 +601,7 @@ void ChContactContainerNSC::IntLoadConstraint_C(const unsigned int off,
 
 template <class Tcont>
 void _IntToDescriptor(unsigned int& coffset,
-                      std::list<Tcont*>& contactlist,
+                      ChContactPool<Tcont>& contactlist,
                       const unsigned int off_v,
                       const ChStateDelta& v,
                       const ChVectorDynamic<>& R,
@@ -639,7 +609,7 @@ void _IntToDescriptor(unsigned int& coffset,
                       const ChVectorDynamic<>& L,
                       const ChVectorDynamic<>& Qc,
                       const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntToDescriptor(off_L + coffset, L, Qc);
         coffset += stride;
@@ -669,13 +639,13 @@ void ChContactContainerNSC::IntToDescriptor(const unsigned int off_v,
 
 template <class Tcont>
 void _IntFromDescriptor(unsigned int& coffset,
-                        std::list<Tcont*>& contactlist,
+                        ChContactPool<Tcont>& contactlist,
                         const unsigned int off_v,
                         ChStateDelta& v,
                         const unsigned int off_L,
                         ChVectorDynamic<>& L,
                         const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntFromDescriptor(off_L + coffset, L);
         coffset += stride;
@@ -704,8 +674,8 @@ void ChContactContainerNSC::IntFromDescriptor(const unsigned int off_v,
 // SOLVER INTERFACES
 
 template <class Tcont>
-void _InjectConstraints(std::list<Tcont*>& contactlist, ChSystemDescriptor& descriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _InjectConstraints(ChContactPool<Tcont>& contactlist, ChSystemDescriptor& descriptor) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->InjectConstraints(descriptor);
         ++itercontact;
@@ -727,8 +697,8 @@ void ChContactContainerNSC::InjectConstraints(ChSystemDescriptor& descriptor) {
 }
 
 template <class Tcont>
-void _ConstraintsBiReset(std::list<Tcont*>& contactlist) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ConstraintsBiReset(ChContactPool<Tcont>& contactlist) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsBiReset();
         ++itercontact;
@@ -750,8 +720,8 @@ void ChContactContainerNSC::ConstraintsBiReset() {
 }
 
 template <class Tcont>
-void _ConstraintsBiLoad_C(std::list<Tcont*>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ConstraintsBiLoad_C(ChContactPool<Tcont>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
         ++itercontact;
@@ -777,9 +747,9 @@ void ChContactContainerNSC::LoadConstraintJacobians() {
 }
 
 template <class Tcont>
-void _ConstraintsFetch_react(std::list<Tcont*>& contactlist, double factor) {
+void _ConstraintsFetch_react(ChContactPool<Tcont>& contactlist, double factor) {
     // From constraints to react vector:
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsFetch_react(factor);
         ++itercontact;
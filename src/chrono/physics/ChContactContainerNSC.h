@@ -15,9 +15,11 @@
 #ifndef CH_CONTACTCONTAINER_NSC_H
 #define CH_CONTACTCONTAINER_NSC_H
 
-#include <list>
+#include <deque>
+#include <vector>
 
 #include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChContactPool.h"
 #include "chrono/physics/ChContactNSC.h"
 #include "chrono/physics/ChContactNSCrolling.h"
 #include "chrono/physics/ChContactable.h"
@@ -25,9 +27,17 @@
 namespace chrono {
 
 /// Class representing a container of many non-smooth contacts.
-/// Implemented using linked lists of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
-/// reactions). It might also contain ChContactNSCrolling objects (extended versions of ChContactNSC, with 6 reactions,
-/// that account also for rolling and spinning resistance), but also for '6dof vs 6dof' contactables.
+/// Implemented using pools of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
+/// reactions), one pool per pair of contactable types (see ChContactPool). It might also contain ChContactNSCrolling
+/// objects (extended versions of ChContactNSC, with 6 reactions, that account also for rolling and spinning
+/// resistance), but also for '6dof vs 6dof' contactables.\n
+/// Contact reactions are carried over from one collision detection pass to the next, to warm start the solver (see
+/// ChIterativeSolverVI::EnableWarmStart). Unless the collision system provides its own persistent storage for contact
+/// reactions, the container keeps a contact cache keyed by the pair of colliding shapes (collision model and shape in
+/// each model, independent of the order in which the collision system reports them); a new contact inherits the
+/// reactions of the closest cached contact between the same two shapes, if its contact point on the first shape of the
+/// pair (expressed in the frame of the corresponding collision model) is within a tolerance relative to the size of
+/// the two collision models.
 class ChApi ChContactContainerNSC : public ChContactContainer {
   public:
     typedef ChContactNSC<ChContactable_1vars<6>, ChContactable_1vars<6> > ChContactNSC_6_6;
@@ -53,17 +63,18 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     /// Report the number of added contacts.
     virtual unsigned int GetNumContacts() const override {
-        return n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-               n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666 + n_added_6_6_rolling;
+        return (unsigned int)(contactlist_3_3.size() + contactlist_6_3.size() + contactlist_6_6.size() +
+                              contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +
+                              contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +
+                              contactlist_666_666.size() + contactlist_6_6_rolling.size());
     }
 
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
-    /// allocation/deallocation.
+    /// similar). Instead of deleting the previous contacts, this implementation rewinds the contact pools (an O(1)
+    /// operation) so that the previous contact objects are reused in place, to avoid allocation/deallocation.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
@@ -79,7 +90,7 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). Contact objects that were not reused are kept in the pools, available for subsequent steps.
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -119,14 +130,31 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// Report the number of scalar unilateral constraints.
     /// Note: friction constraints aren't exactly unilaterals, but they are still counted.
     virtual unsigned int GetNumConstraintsUnilateral() override {
-        return 3 * (n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-                    n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666) +
-               6 * (n_added_6_6_rolling);
+        return (unsigned int)(3 * (contactlist_3_3.size() + contactlist_6_3.size() + contactlist_6_6.size() +
+                                   contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +
+                                   contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +
+                                   contactlist_666_666.size()) +
+                              6 * contactlist_6_6_rolling.size());
     }
 
     /// Objects will rebounce only if their relative colliding speed is above this threshold.
     double GetMinBounceSpeed() const { return min_bounce_speed; }
 
+    /// Enable/disable the contact cache used to carry over contact reactions for solver warm starting (default: true).
+    /// The cache is not used for contacts for which the collision system provides persistent storage of reactions.
+    void EnableWarmStartCache(bool val);
+
+    /// Return true if the contact cache is enabled.
+    bool IsWarmStartCacheEnabled() const { return cache_enabled; }
+
+    /// Set the maximum distance between the points of two contacts on the same pair of shapes for which the contacts
+    /// are identified across two consecutive collision detection passes, as a fraction of the size (bounding box
+    /// diagonal) of the smaller of the two collision models (default: 0.01).
+    void SetWarmStartCacheTolerance(double tol) { cache_tolerance = tol; }
+
+    /// Return the number of contacts at the last collision detection pass which inherited cached reactions.
+    unsigned int GetNumWarmStartedContacts() const { return cache_hits; }
+
     /// Update state of this contact container: compute jacobians, violations, etc.
     /// and store results in inner structures of contacts.
     virtual void Update(double mtime, bool update_assets = true) override;
@@ -182,51 +210,51 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   protected:
-    std::list<ChContactNSC_6_6*> contactlist_6_6;
-    std::list<ChContactNSC_6_3*> contactlist_6_3;
-    std::list<ChContactNSC_3_3*> contactlist_3_3;
-    std::list<ChContactNSC_333_3*> contactlist_333_3;
-    std::list<ChContactNSC_333_6*> contactlist_333_6;
-    std::list<ChContactNSC_333_333*> contactlist_333_333;
-    std::list<ChContactNSC_666_3*> contactlist_666_3;
-    std::list<ChContactNSC_666_6*> contactlist_666_6;
-    std::list<ChContactNSC_666_333*> contactlist_666_333;
-    std::list<ChContactNSC_666_666*> contactlist_666_666;
-
-    std::list<ChContactNSCrolling_6_6*> contactlist_6_6_rolling;
-
-    int n_added_6_6;
-    int n_added_6_3;
-    int n_added_3_3;
-    int n_added_333_3;
-    int n_added_333_6;
-    int n_added_333_333;
-    int n_added_666_3;
-    int n_added_666_6;
-    int n_added_666_333;
-    int n_added_666_666;
-    int n_added_6_6_rolling;
-
-    std::list<ChContactNSC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactNSC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactNSC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactNSC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactNSC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactNSC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactNSC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactNSC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactNSC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactNSC_666_666*>::iterator lastcontact_666_666;
-
-    std::list<ChContactNSCrolling_6_6*>::iterator lastcontact_6_6_rolling;
+    ChContactPool<ChContactNSC_6_6> contactlist_6_6;
+    ChContactPool<ChContactNSC_6_3> contactlist_6_3;
+    ChContactPool<ChContactNSC_3_3> contactlist_3_3;
+    ChContactPool<ChContactNSC_333_3> contactlist_333_3;
+    ChContactPool<ChContactNSC_333_6> contactlist_333_6;
+    ChContactPool<ChContactNSC_333_333> contactlist_333_333;
+    ChContactPool<ChContactNSC_666_3> contactlist_666_3;
+    ChContactPool<ChContactNSC_666_6> contactlist_666_6;
+    ChContactPool<ChContactNSC_666_333> contactlist_666_333;
+    ChContactPool<ChContactNSC_666_666> contactlist_666_666;
+
+    ChContactPool<ChContactNSCrolling_6_6> contactlist_6_6_rolling;
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
   private:
+    /// Cached contact: colliding shapes (in normalized order), contact point on shape A (in the frame of collision
+    /// model A), order of the shapes in the contact, and reactions.
+    struct CacheEntry {
+        ChCollisionModel* modelA;
+        ChCollisionShape* shapeA;
+        ChCollisionModel* modelB;
+        ChCollisionShape* shapeB;
+        ChVector3d pos;
+        bool swapped;
+        float reactions[3];
+    };
+
+    /// Ordering of cache entries by shape pair.
+    static bool CacheEntryLess(const CacheEntry& a, const CacheEntry& b);
+
     void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat);
 
+    /// Create the cache entry for a new contact, initialized with the reactions of the matching contact at the previous
+    /// collision detection pass (if any). Return the address of the reactions storage.
+    float* CacheContact(const ChCollisionInfo& cinfo);
+
     double min_bounce_speed;  ///< minimum speed for rebounce after impacts. Lower speeds are clamped to 0
 
+    bool cache_enabled;                  ///< use the contact cache for warm starting
+    double cache_tolerance;              ///< maximum distance between matching contact points (relative)
+    unsigned int cache_hits;             ///< number of contacts which inherited cached reactions
+    std::vector<CacheEntry> cache_prev;  ///< contacts at previous pass, sorted by shape pair
+    std::deque<CacheEntry> cache_curr;   ///< contacts at current pass (stable addresses, referenced by the contacts)
+
     friend class ChSystemNSC;
 };
 
@@ -14,36 +14,17 @@
 
 #include "chrono/physics/ChContactContainerSMC.h"
 #include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChOpenMP.h"
 
 namespace chrono {
 
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChContactContainerSMC)
 
-ChContactContainerSMC::ChContactContainerSMC()
-    : n_added_3_3(0),
-      n_added_6_3(0),
-      n_added_6_6(0),
-      n_added_333_3(0),
-      n_added_333_6(0),
-      n_added_333_333(0),
-      n_added_666_3(0),
-      n_added_666_6(0),
-      n_added_666_333(0),
-      n_added_666_666(0) {}
-
-ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other) : ChContactContainer(other) {
-    n_added_3_3 = 0;
-    n_added_6_3 = 0;
-    n_added_6_6 = 0;
-    n_added_333_3 = 0;
-    n_added_333_6 = 0;
-    n_added_333_333 = 0;
-    n_added_666_3 = 0;
-    n_added_666_6 = 0;
-    n_added_666_333 = 0;
-    n_added_666_666 = 0;
-}
+ChContactContainerSMC::ChContactContainerSMC() : defer_evaluation(false) {}
+
+ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other)
+    : ChContactContainer(other), defer_evaluation(false) {}
 
 ChContactContainerSMC::~ChContactContainerSMC() {
     RemoveAllContacts();
@@ -54,138 +35,82 @@ void ChContactContainerSMC::Update(double mytime, bool update_assets) {
     ChContactContainer::Update(mytime, update_assets);
 }
 
-template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        delete (*itercontact);
-        (*itercontact) = 0;
-        ++itercontact;
-    }
-    contactlist.clear();
-    lastcontact = contactlist.begin();
-    n_added = 0;
-}
-
 void ChContactContainerSMC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
+    contactlist_3_3.Clear();
+    contactlist_6_3.Clear();
+    contactlist_6_6.Clear();
+    contactlist_333_3.Clear();
+    contactlist_333_6.Clear();
+    contactlist_333_333.Clear();
+    contactlist_666_3.Clear();
+    contactlist_666_6.Clear();
+    contactlist_666_333.Clear();
+    contactlist_666_666.Clear();
     //**TODO*** cont. roll.
 }
 
 void ChContactContainerSMC::BeginAddContact() {
-    lastcontact_3_3 = contactlist_3_3.begin();
-    n_added_3_3 = 0;
-
-    lastcontact_6_3 = contactlist_6_3.begin();
-    n_added_6_3 = 0;
-
-    lastcontact_6_6 = contactlist_6_6.begin();
-    n_added_6_6 = 0;
-
-    lastcontact_333_3 = contactlist_333_3.begin();
-    n_added_333_3 = 0;
-
-    lastcontact_333_6 = contactlist_333_6.begin();
-    n_added_333_6 = 0;
-
-    lastcontact_333_333 = contactlist_333_333.begin();
-    n_added_333_333 = 0;
-
-    lastcontact_666_3 = contactlist_666_3.begin();
-    n_added_666_3 = 0;
-
-    lastcontact_666_6 = contactlist_666_6.begin();
-    n_added_666_6 = 0;
-
-    lastcontact_666_333 = contactlist_666_333.begin();
-    n_added_666_333 = 0;
-
-    lastcontact_666_666 = contactlist_666_666.begin();
-    n_added_666_666 = 0;
+    // Defer calculation of contact forces until all contacts were added (see EndAddContact)
+    defer_evaluation = true;
+
+    contactlist_3_3.Reset();
+    contactlist_6_3.Reset();
+    contactlist_6_6.Reset();
+    contactlist_333_3.Reset();
+    contactlist_333_6.Reset();
+    contactlist_333_333.Reset();
+    contactlist_666_3.Reset();
+    contactlist_666_6.Reset();
+    contactlist_666_333.Reset();
+    contactlist_666_666.Reset();
+    // contactlist_roll.Reset();
+}
 
-    // lastcontact_roll = contactlist_roll.begin();
-    // n_added_roll = 0;
+template <class Tcont>
+void _EvaluateForces(ChContactPool<Tcont>& contactlist, int nthreads) {
+    const int ncontacts = (int)contactlist.size();
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < ncontacts; i++)
+        contactlist[i]->EvaluateForce();
 }
 
 void ChContactContainerSMC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
-    }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
-    }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
-    }
-
-    // while (lastcontact_roll != contactlist_roll.end()) {
-    //    delete (*lastcontact_roll);
-    //    lastcontact_roll = contactlist_roll.erase(lastcontact_roll);
-    //}
+    // Contacts beyond the last added one are kept in the pools, to be reused at the next collision detection pass.
+
+    // Calculate the forces (and Jacobians, if needed) of all contacts added since BeginAddContact.
+    // Contacts are independent of each other and are processed concurrently.
+    // Contacts added after this point (e.g., in custom collision callbacks) are evaluated immediately.
+    int nthreads = GetSystem() ? GetSystem()->GetNumThreadsChrono() : 1;
+    _EvaluateForces(contactlist_3_3, nthreads);
+    _EvaluateForces(contactlist_6_3, nthreads);
+    _EvaluateForces(contactlist_6_6, nthreads);
+    _EvaluateForces(contactlist_333_3, nthreads);
+    _EvaluateForces(contactlist_333_6, nthreads);
+    _EvaluateForces(contactlist_333_333, nthreads);
+    _EvaluateForces(contactlist_666_3, nthreads);
+    _EvaluateForces(contactlist_666_6, nthreads);
+    _EvaluateForces(contactlist_666_333, nthreads);
+    _EvaluateForces(contactlist_666_666, nthreads);
+
+    defer_evaluation = false;
 }
 
-template <class Tcont, class Titer, class Ta, class Tb>
-void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact list
-                           Titer& lastcontact,                        // last contact acquired
-                           int& n_added,                              // number of contacts inserted
-                           ChContactContainerSMC* container,          // contact container
-                           Ta* objA,                                  // collidable object A
-                           Tb* objB,                                  // collidable object B
-                           const ChCollisionInfo& cinfo,              // collision information
-                           const ChContactMaterialCompositeSMC& cmat  // composite material
+template <class Tcont, class Ta, class Tb>
+void _OptimalContactInsert(ChContactPool<Tcont>& contactlist,          // contact pool
+                           ChContactContainerSMC* container,           // contact container
+                           Ta* objA,                                   // collidable object A
+                           Tb* objB,                                   // collidable object B
+                           const ChCollisionInfo& cinfo,               // collision information
+                           const ChContactMaterialCompositeSMC& cmat,  // composite material
+                           bool evaluate                               // calculate contact force now?
 ) {
-    if (lastcontact != contactlist.end()) {
+    if (Tcont* contact = contactlist.Reuse()) {
         // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat);
-        lastcontact++;
+        contact->Reset(objA, objB, cinfo, cmat, evaluate);
     } else {
-        // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat);
-        contactlist.push_back(mc);
-        lastcontact = contactlist.end();
+        // construct new contact in the pool
+        contactlist.Emplace(container, objA, objB, cinfo, cmat, evaluate);
     }
-    n_added++;
 }
 
 void ChContactContainerSMC::AddContact(const ChCollisionInfo& cinfo,
@@ -273,25 +198,22 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_3_3, this, objA, objB, cinfo, cmat, !defer_evaluation);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_6_3, this, objB, objA, swapped_cinfo, cmat, !defer_evaluation);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, this, objB, objA, swapped_cinfo, cmat, !defer_evaluation);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, this, objB, objA, swapped_cinfo, cmat, !defer_evaluation);
             }
         } break;
 
@@ -300,23 +222,21 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, this, objA, objB, cinfo, cmat, !defer_evaluation);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6
-                _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_6, this, objA, objB, cinfo, cmat, !defer_evaluation);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, this, objB, objA, swapped_cinfo, cmat, !defer_evaluation);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, this, objB, objA, swapped_cinfo, cmat, !defer_evaluation);
             }
         } break;
 
@@ -325,24 +245,20 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_3, this, objA, objB, cinfo, cmat, !defer_evaluation);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_6, this, objA, objB, cinfo, cmat, !defer_evaluation);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_333, this, objA, objB, cinfo, cmat, !defer_evaluation);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, this, objB, objA, swapped_cinfo, cmat, !defer_evaluation);
             }
         } break;
 
@@ -351,23 +267,19 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_3, this, objA, objB, cinfo, cmat, !defer_evaluation);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_6, this, objA, objB, cinfo, cmat, !defer_evaluation);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, this, objA, objB, cinfo, cmat, !defer_evaluation);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_666, this, objA, objB, cinfo, cmat, !defer_evaluation);
             }
         } break;
 
@@ -409,8 +321,8 @@ ChVector3d ChContactContainerSMC::GetContactableTorque(ChContactable* contactabl
 }
 
 template <class Tcont>
-void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContacts(ChContactPool<Tcont>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -439,52 +351,100 @@ void ChContactContainerSMC::ReportAllContacts(std::shared_ptr<ReportContactCallb
 // STATE INTERFACE
 
 template <class Tcont>
-void _IntLoadResidual_F(std::list<Tcont*>& contactlist, ChVectorDynamic<>& R, const double c) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _IntLoadResidual_F(ChContactPool<Tcont>& contactlist, ChVectorDynamic<>& R, const double c) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadResidual_F(R, c);
         ++itercontact;
     }
 }
 
+// Same as above, but called from within a parallel region: the contacts are statically distributed among the threads
+// of the team, each accumulating in its own residual vector.
+template <class Tcont>
+void _IntLoadResidual_F_team(ChContactPool<Tcont>& contactlist, ChVectorDynamic<>& R, const double c) {
+    const int ncontacts = (int)contactlist.size();
+#pragma omp for schedule(static) nowait
+    for (int i = 0; i < ncontacts; i++)
+        contactlist[i]->ContIntLoadResidual_F(R, c);
+}
+
 void ChContactContainerSMC::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
-    _IntLoadResidual_F(contactlist_3_3, R, c);
-    _IntLoadResidual_F(contactlist_6_3, R, c);
-    _IntLoadResidual_F(contactlist_6_6, R, c);
-    _IntLoadResidual_F(contactlist_333_3, R, c);
-    _IntLoadResidual_F(contactlist_333_6, R, c);
-    _IntLoadResidual_F(contactlist_333_333, R, c);
-    _IntLoadResidual_F(contactlist_666_3, R, c);
-    _IntLoadResidual_F(contactlist_666_6, R, c);
-    _IntLoadResidual_F(contactlist_666_333, R, c);
-    _IntLoadResidual_F(contactlist_666_666, R, c);
+    int nthreads = GetSystem() ? GetSystem()->GetNumThreadsChrono() : 1;
+
+    if (nthreads <= 1) {
+        _IntLoadResidual_F(contactlist_3_3, R, c);
+        _IntLoadResidual_F(contactlist_6_3, R, c);
+        _IntLoadResidual_F(contactlist_6_6, R, c);
+        _IntLoadResidual_F(contactlist_333_3, R, c);
+        _IntLoadResidual_F(contactlist_333_6, R, c);
+        _IntLoadResidual_F(contactlist_333_333, R, c);
+        _IntLoadResidual_F(contactlist_666_3, R, c);
+        _IntLoadResidual_F(contactlist_666_6, R, c);
+        _IntLoadResidual_F(contactlist_666_333, R, c);
+        _IntLoadResidual_F(contactlist_666_666, R, c);
+        return;
+    }
+
+    // Multithreaded assembly. Each thread accumulates the forces of its contacts in a private copy of the residual.
+    // The private residuals are then summed into R, always in the same order, so that the results are deterministic
+    // for a given number of threads.
+    const int n = (int)R.size();
+
+#pragma omp parallel num_threads(nthreads)
+    {
+#pragma omp single
+        thread_residuals.resize(ChOMP::GetNumThreads());
+
+        ChVectorDynamic<>& Rt = thread_residuals[ChOMP::GetThreadNum()];
+        Rt.setZero(n);
+
+        _IntLoadResidual_F_team(contactlist_3_3, Rt, c);
+        _IntLoadResidual_F_team(contactlist_6_3, Rt, c);
+        _IntLoadResidual_F_team(contactlist_6_6, Rt, c);
+        _IntLoadResidual_F_team(contactlist_333_3, Rt, c);
+        _IntLoadResidual_F_team(contactlist_333_6, Rt, c);
+        _IntLoadResidual_F_team(contactlist_333_333, Rt, c);
+        _IntLoadResidual_F_team(contactlist_666_3, Rt, c);
+        _IntLoadResidual_F_team(contactlist_666_6, Rt, c);
+        _IntLoadResidual_F_team(contactlist_666_333, Rt, c);
+        _IntLoadResidual_F_team(contactlist_666_666, Rt, c);
+
+#pragma omp barrier
+
+#pragma omp for schedule(static)
+        for (int i = 0; i < n; i++) {
+            for (const auto& Ri : thread_residuals)
+                R(i) += Ri(i);
+        }
+    }
 }
 
 template <class Tcont>
-void _KRMmatricesLoad(std::list<Tcont*> contactlist, double Kfactor, double Rfactor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContKRMmatricesLoad(Kfactor, Rfactor);
-        ++itercontact;
-    }
+void _KRMmatricesLoad(ChContactPool<Tcont>& contactlist, double Kfactor, double Rfactor, int nthreads) {
+    const int ncontacts = (int)contactlist.size();
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < ncontacts; i++)
+        contactlist[i]->ContKRMmatricesLoad(Kfactor, Rfactor);
 }
 
 void ChContactContainerSMC::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
-    _KRMmatricesLoad(contactlist_3_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_6_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_6_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_333, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_333, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_666, Kfactor, Rfactor);
+    int nthreads = GetSystem() ? GetSystem()->GetNumThreadsChrono() : 1;
+    _KRMmatricesLoad(contactlist_3_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_6_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_6_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_333, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_333, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_666, Kfactor, Rfactor, nthreads);
 }
 
 template <class Tcont>
-void _InjectKRMmatrices(std::list<Tcont*> contactlist, ChSystemDescriptor& descriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _InjectKRMmatrices(ChContactPool<Tcont>& contactlist, ChSystemDescriptor& descriptor) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContInjectKRMmatrices(descriptor);
         ++itercontact;
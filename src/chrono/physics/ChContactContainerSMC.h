@@ -17,16 +17,18 @@
 
 #include <algorithm>
 #include <cmath>
-#include <list>
+#include <vector>
 
 #include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChContactPool.h"
 #include "chrono/physics/ChContactSMC.h"
 #include "chrono/physics/ChContactable.h"
 
 namespace chrono {
 
 /// Class representing a container of many smooth (penalty) contacts.
-/// Implemented using linked lists of ChContactSMC objects (that is, contacts between two ChContactable objects).
+/// Implemented using pools of ChContactSMC objects (that is, contacts between two ChContactable objects), one pool per
+/// pair of contactable types (see ChContactPool).
 class ChApi ChContactContainerSMC : public ChContactContainer {
   public:
     typedef ChContactSMC<ChContactable_1vars<3>, ChContactable_1vars<3> > ChContactSMC_3_3;
@@ -41,38 +43,16 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     typedef ChContactSMC<ChContactable_3vars<6, 6, 6>, ChContactable_3vars<6, 6, 6> > ChContactSMC_666_666;
 
   protected:
-    std::list<ChContactSMC_3_3*> contactlist_3_3;
-    std::list<ChContactSMC_6_3*> contactlist_6_3;
-    std::list<ChContactSMC_6_6*> contactlist_6_6;
-    std::list<ChContactSMC_333_3*> contactlist_333_3;
-    std::list<ChContactSMC_333_6*> contactlist_333_6;
-    std::list<ChContactSMC_333_333*> contactlist_333_333;
-    std::list<ChContactSMC_666_3*> contactlist_666_3;
-    std::list<ChContactSMC_666_6*> contactlist_666_6;
-    std::list<ChContactSMC_666_333*> contactlist_666_333;
-    std::list<ChContactSMC_666_666*> contactlist_666_666;
-
-    int n_added_3_3;
-    int n_added_6_3;
-    int n_added_6_6;
-    int n_added_333_3;
-    int n_added_333_6;
-    int n_added_333_333;
-    int n_added_666_3;
-    int n_added_666_6;
-    int n_added_666_333;
-    int n_added_666_666;
-
-    std::list<ChContactSMC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactSMC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactSMC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactSMC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactSMC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactSMC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactSMC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactSMC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactSMC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactSMC_666_666*>::iterator lastcontact_666_666;
+    ChContactPool<ChContactSMC_3_3> contactlist_3_3;
+    ChContactPool<ChContactSMC_6_3> contactlist_6_3;
+    ChContactPool<ChContactSMC_6_6> contactlist_6_6;
+    ChContactPool<ChContactSMC_333_3> contactlist_333_3;
+    ChContactPool<ChContactSMC_333_6> contactlist_333_6;
+    ChContactPool<ChContactSMC_333_333> contactlist_333_333;
+    ChContactPool<ChContactSMC_666_3> contactlist_666_3;
+    ChContactPool<ChContactSMC_666_6> contactlist_666_6;
+    ChContactPool<ChContactSMC_666_333> contactlist_666_333;
+    ChContactPool<ChContactSMC_666_666> contactlist_666_666;
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
@@ -86,17 +66,18 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
     /// Report the number of added contacts.
     virtual unsigned int GetNumContacts() const override {
-        return n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-               n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666;
+        return (unsigned int)(contactlist_3_3.size() + contactlist_6_3.size() + contactlist_6_6.size() +
+                              contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +
+                              contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +
+                              contactlist_666_666.size());
     }
 
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
-    /// allocation/deallocation.
+    /// similar). Instead of deleting the previous contacts, this implementation rewinds the contact pools (an O(1)
+    /// operation) so that the previous contact objects are reused in place, to avoid allocation/deallocation.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
@@ -112,7 +93,9 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). Contact objects that were not reused are kept in the pools, available for subsequent steps.
+    /// The forces of all contacts added since BeginAddContact() are calculated here, using multiple threads if so
+    /// specified with ChSystem::SetNumThreads.
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -135,6 +118,9 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
     // STATE FUNCTIONS
 
+    /// Add the contact forces to the residual R += c*F.
+    /// If more than one Chrono thread is used (see ChSystem::SetNumThreads), contacts are processed concurrently and
+    /// accumulated in per-thread residual vectors; results are deterministic for a given number of threads.
     virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override;
     virtual void LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) override;
     virtual void InjectKRMMatrices(ChSystemDescriptor& descriptor) override;
@@ -153,6 +139,9 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
   private:
     void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeSMC& cmat);
+
+    bool defer_evaluation;                            ///< defer contact force calculation to EndAddContact
+    std::vector<ChVectorDynamic<>> thread_residuals;  ///< per-thread residuals for multithreaded force assembly
 };
 
 CH_CLASS_VERSION(ChContactContainerSMC, 0)
@@ -0,0 +1,115 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_CONTACT_POOL_H
+#define CH_CONTACT_POOL_H
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace chrono {
+
+/// Pool of contact objects of a given type, used by the contact containers.\n
+/// Contact objects are constructed in place in contiguous chunks of memory which are never moved, so that pointers to
+/// the contacts (and to the constraints they own) remain valid as the pool grows. Contacts are not destroyed when the
+/// pool is rewound with Reset() (an O(1) operation); instead, they are reused (re-initialized in place) during the
+/// next collision detection pass. Memory is released only by Clear() or by the pool destructor.\n
+/// Iteration over the active contacts is a linear scan over a contiguous array of pointers, in allocation order.
+template <class Tcont>
+class ChContactPool {
+  public:
+    typedef typename std::vector<Tcont*>::iterator iterator;
+    typedef typename std::vector<Tcont*>::const_iterator const_iterator;
+
+    ChContactPool() : m_size(0), m_chunk_size(0), m_chunk_used(0) {}
+    ChContactPool(const ChContactPool&) = delete;
+    ChContactPool& operator=(const ChContactPool&) = delete;
+    ~ChContactPool() { Clear(); }
+
+    /// Return the number of active contacts in the pool.
+    size_t size() const { return m_size; }
+
+    /// Return true if there are no active contacts in the pool.
+    bool empty() const { return m_size == 0; }
+
+    /// Return the number of constructed contact objects (active or available for reuse).
+    size_t capacity() const { return m_contacts.size(); }
+
+    /// Access the i-th active contact.
+    Tcont* operator[](size_t i) const { return m_contacts[i]; }
+
+    iterator begin() { return m_contacts.begin(); }
+    iterator end() { return m_contacts.begin() + m_size; }
+    const_iterator begin() const { return m_contacts.begin(); }
+    const_iterator end() const { return m_contacts.begin() + m_size; }
+
+    /// Rewind the pool. All contacts become available for reuse; no memory is released.
+    void Reset() { m_size = 0; }
+
+    /// Return the next available (already constructed) contact and mark it as active.
+    /// Return nullptr if all constructed contacts are in use, in which case Emplace() must be called.
+    Tcont* Reuse() { return (m_size < m_contacts.size()) ? m_contacts[m_size++] : nullptr; }
+
+    /// Construct a new contact with the given arguments and mark it as active.
+    /// Must be called only if all constructed contacts are in use (i.e. Reuse() returned nullptr).
+    template <typename... Args>
+    Tcont* Emplace(Args&&... args) {
+        if (m_chunk_used == m_chunk_size)
+            AddChunk();
+        Tcont* contact = m_chunks.back().get() + m_chunk_used;
+        ::new (static_cast<void*>(contact)) Tcont(std::forward<Args>(args)...);
+        m_chunk_used++;
+        m_contacts.push_back(contact);
+        m_size++;
+        return contact;
+    }
+
+    /// Destroy all contacts and release the allocated memory.
+    void Clear() {
+        for (auto contact : m_contacts)
+            contact->~Tcont();
+        m_contacts.clear();
+        m_chunks.clear();
+        m_chunk_size = 0;
+        m_chunk_used = 0;
+        m_size = 0;
+    }
+
+  private:
+    /// Deleter for a chunk of raw storage (the contained objects are destroyed separately).
+    struct ChunkDeleter {
+        size_t n;
+        void operator()(Tcont* p) const { std::allocator<Tcont>().deallocate(p, n); }
+    };
+
+    /// Allocate a new chunk, doubling the total capacity of the pool.
+    void AddChunk() {
+        m_chunk_size = m_contacts.empty() ? min_chunk_size : m_contacts.size();
+        m_chunks.emplace_back(std::allocator<Tcont>().allocate(m_chunk_size), ChunkDeleter{m_chunk_size});
+        m_chunk_used = 0;
+    }
+
+    static constexpr size_t min_chunk_size = 64;
+
+    std::vector<std::unique_ptr<Tcont, ChunkDeleter>> m_chunks;  ///< raw storage
+    std::vector<Tcont*> m_contacts;                              ///< constructed contacts, in allocation order
+    size_t m_size;                                               ///< number of active contacts
+    size_t m_chunk_size;                                         ///< capacity of the last chunk
+    size_t m_chunk_used;                                         ///< number of constructed objects in last chunk
+};
+
+}  // end namespace chrono
+
+#endif
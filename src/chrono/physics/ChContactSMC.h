@@ -238,21 +238,23 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         ChMatrixDynamic<double> m_R;  ///< R = dQ/dv
     };
 
-    ChVector3d m_force;        ///< contact force on objB
-    ChVector3d m_torque;       ///< contact torque on objB
-    ChContactJacobian* m_Jac;  ///< contact Jacobian data
+    ChVector3d m_force;                   ///< contact force on objB
+    ChVector3d m_torque;                  ///< contact torque on objB
+    ChContactJacobian* m_Jac;             ///< contact Jacobian data
+    ChContactMaterialCompositeSMC m_mat;  ///< composite material for contact pair
 
   public:
     ChContactSMC() : m_Jac(NULL) {}
 
-    ChContactSMC(ChContactContainer* contact_container,    ///< contact container
-                 Ta* obj_A,                                ///< contactable object A
-                 Tb* obj_B,                                ///< contactable object B
-                 const ChCollisionInfo& cinfo,             ///< data for the collision pair
-                 const ChContactMaterialCompositeSMC& mat  ///< composite material
+    ChContactSMC(ChContactContainer* contact_container,     ///< contact container
+                 Ta* obj_A,                                 ///< contactable object A
+                 Tb* obj_B,                                 ///< contactable object B
+                 const ChCollisionInfo& cinfo,              ///< data for the collision pair
+                 const ChContactMaterialCompositeSMC& mat,  ///< composite material
+                 bool evaluate = true                       ///< calculate contact force now
                  )
         : ChContactTuple<Ta, Tb>(contact_container, obj_A, obj_B), m_Jac(NULL) {
-        Reset(obj_A, obj_B, cinfo, mat);
+        Reset(obj_A, obj_B, cinfo, mat, evaluate);
     }
 
     ~ChContactSMC() { delete m_Jac; }
@@ -278,10 +280,13 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     const ChMatrixDynamic<double>* GetJacobianR() const { return m_Jac ? &(m_Jac->m_R) : NULL; }
 
     /// Reinitialize this contact for reuse.
-    void Reset(Ta* obj_A,                                ///< contactable object A
-               Tb* obj_B,                                ///< contactable object B
-               const ChCollisionInfo& cinfo,             ///< data for the collision pair
-               const ChContactMaterialCompositeSMC& mat  ///< composite material
+    /// If 'evaluate' is false, only the contact geometry and material are updated and the contact force must be
+    /// calculated later with EvaluateForce() (this allows the contact container to evaluate contacts in parallel).
+    void Reset(Ta* obj_A,                                 ///< contactable object A
+               Tb* obj_B,                                 ///< contactable object B
+               const ChCollisionInfo& cinfo,              ///< data for the collision pair
+               const ChContactMaterialCompositeSMC& mat,  ///< composite material
+               bool evaluate = true                       ///< calculate contact force now
     ) {
         // Reset geometric information
         this->Reset_cinfo(obj_A, obj_B, cinfo);
@@ -289,13 +294,22 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         // Note: cinfo.distance is the same as this->norm_dist.
         assert(cinfo.distance < 0);
 
+        m_mat = mat;
+
+        if (evaluate)
+            EvaluateForce();
+    }
+
+    /// Calculate the contact force and, if the system uses stiff contacts, the contact force Jacobians.
+    /// This function only modifies data owned by this contact and can be called concurrently for different contacts.
+    void EvaluateForce() {
         // Calculate contact force.
         auto wrench =
             CalculateForceTorque(-this->norm_dist,                            // overlap (here, always positive)
                                  this->normal,                                // normal contact direction
                                  this->objA->GetContactPointSpeed(this->p1),  // velocity of contact point on objA
                                  this->objB->GetContactPointSpeed(this->p2),  // velocity of contact point on objB
-                                 mat                                          // composite material for contact pair
+                                 m_mat                                        // composite material for contact pair
             );
         m_force = wrench.force;
         m_torque = wrench.torque;
@@ -303,7 +317,7 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         // Set up and compute Jacobian matrices.
         if (static_cast<ChSystemSMC*>(this->container->GetSystem())->IsContactStiff()) {
             CreateJacobians();
-            CalculateJacobians(mat);
+            CalculateJacobians(m_mat);
         }
     }
 
@@ -703,8 +703,11 @@ void ChParticleCloud::SyncCollisionModels() {
     if (!particle_collision_model)
         return;
 
-    for (auto particle : particles)
-        particle->GetCollisionModel()->SyncPosition();
+    int nthreads = system ? (int)system->GetNumThreadsChrono() : 1;
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ip = 0; ip < (int)particles.size(); ip++)
+        particles[ip]->GetCollisionModel()->SyncPosition();
 }
 
 void ChParticleCloud::ArchiveOut(ChArchiveOut& archive_out) {
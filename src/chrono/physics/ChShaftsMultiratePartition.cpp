@@ -0,0 +1,103 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <stdexcept>
+
+#include "chrono/physics/ChShaftsMultiratePartition.h"
+
+namespace chrono {
+
+ChShaftsMultiratePartition::ChShaftsMultiratePartition(std::shared_ptr<ChSystem> fast_system) : fast_sys(fast_system) {
+    if (!fast_sys)
+        throw std::invalid_argument("ChShaftsMultiratePartition: invalid fast system");
+}
+
+void ChShaftsMultiratePartition::AddShaftInterface(std::shared_ptr<ChShaft> slow_shaft,
+                                                   std::shared_ptr<ChShaft> proxy_shaft) {
+    if (proxy_shaft->GetSystem() != fast_sys.get())
+        throw std::invalid_argument("ChShaftsMultiratePartition: proxy shaft must belong to the fast system");
+    if (!slow_shaft->GetSystem())
+        throw std::invalid_argument("ChShaftsMultiratePartition: slow shaft must belong to a system");
+    if (slow_shaft->GetSystem() == fast_sys.get())
+        throw std::invalid_argument("ChShaftsMultiratePartition: slow shaft cannot belong to the fast system");
+
+    ShaftInterface iface;
+    iface.slow_shaft = slow_shaft;
+    iface.proxy_shaft = proxy_shaft;
+    iface.acc = 0;
+
+    // Interface torque on the slow shaft, with reaction on a fixed shaft
+    iface.slow_ground = chrono_types::make_shared<ChShaft>();
+    iface.slow_ground->SetFixed(true);
+    slow_shaft->GetSystem()->AddShaft(iface.slow_ground);
+
+    iface.load = chrono_types::make_shared<ChShaftsAppliedTorque>();
+    iface.load->Initialize(slow_shaft, iface.slow_ground);
+    iface.load->SetTorque(0);
+    slow_shaft->GetSystem()->Add(iface.load);
+
+    // Start the proxy shaft in the current state of the slow shaft
+    proxy_shaft->SetPos(slow_shaft->GetPos());
+    proxy_shaft->SetPosDt(slow_shaft->GetPosDt());
+
+    iface.ground = chrono_types::make_shared<ChShaft>();
+    iface.ground->SetFixed(true);
+    fast_sys->AddShaft(iface.ground);
+
+    iface.setpoint = chrono_types::make_shared<ChFunctionSetpoint>();
+    iface.setpoint->SetSetpointAndDerivatives(slow_shaft->GetPos(), slow_shaft->GetPosDt(), 0);
+
+    iface.motor = chrono_types::make_shared<ChShaftsMotorPosition>();
+    iface.motor->Initialize(proxy_shaft, iface.ground);
+    iface.motor->SetPositionFunction(iface.setpoint);
+    fast_sys->Add(iface.motor);
+
+    interfaces.push_back(iface);
+}
+
+void ChShaftsMultiratePartition::GatherInterfaceState(ChVectorDynamic<>& q, ChVectorDynamic<>& u) {
+    for (size_t i = 0; i < interfaces.size(); i++) {
+        q(i) = interfaces[i].slow_shaft->GetPos();
+        u(i) = interfaces[i].slow_shaft->GetPosDt();
+    }
+}
+
+void ChShaftsMultiratePartition::ScatterInterfaceState(const ChVectorDynamic<>& q,
+                                                       const ChVectorDynamic<>& u,
+                                                       const ChVectorDynamic<>& a,
+                                                       double time) {
+    for (size_t i = 0; i < interfaces.size(); i++) {
+        interfaces[i].setpoint->SetSetpointAndDerivatives(q(i), u(i), a(i));
+        interfaces[i].acc = a(i);
+    }
+}
+
+void ChShaftsMultiratePartition::Advance(double h) {
+    fast_sys->DoStepDynamics(h);
+}
+
+void ChShaftsMultiratePartition::GatherInterfaceLoads(ChVectorDynamic<>& f) {
+    // Torque exerted by the fast items on the proxy shaft, from its equation of motion J*a = T_motor + T_items
+    for (size_t i = 0; i < interfaces.size(); i++) {
+        const auto& iface = interfaces[i];
+        f(i) = iface.proxy_shaft->GetInertia() * iface.acc - iface.motor->GetMotorLoad();
+    }
+}
+
+void ChShaftsMultiratePartition::ApplyInterfaceLoads(const ChVectorDynamic<>& f) {
+    for (size_t i = 0; i < interfaces.size(); i++)
+        interfaces[i].load->SetTorque(f(i));
+}
+
+}  // end namespace chrono
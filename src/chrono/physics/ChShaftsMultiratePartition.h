@@ -0,0 +1,80 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_SHAFTS_MULTIRATE_PARTITION_H
+#define CH_SHAFTS_MULTIRATE_PARTITION_H
+
+#include <vector>
+
+#include "chrono/functions/ChFunctionSetpoint.h"
+#include "chrono/physics/ChShaftsAppliedTorque.h"
+#include "chrono/physics/ChShaftsMotorPosition.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/timestepper/ChTimestepperMultirate.h"
+
+namespace chrono {
+
+/// Fast partition of a multirate integration, coupled to the slow system through shafts.
+/// The fast partition consists of the items of a separate ChSystem (with its own timestepper and solver), subcycled
+/// by a ChTimestepperMultirate set on the slow system. Each interface pairs a shaft of the slow system with a proxy
+/// shaft of the fast system, to which the fast items (e.g., the rest of a driveline) are connected. During subcycling,
+/// the proxy shaft follows the interpolated motion of the slow shaft, imposed through a position motor; the torque
+/// exerted by the fast items on the proxy shaft, averaged over the substeps, is applied to the slow shaft during the
+/// next slow step. The inertia of the proxy shaft is accounted for in the interface torque.\n
+/// The interface torque is applied through a ChShaftsAppliedTorque between the slow shaft and a fixed shaft added to
+/// the slow system, so that it does not interfere with loads set by the user through ChShaft::SetAppliedLoad.
+class ChApi ChShaftsMultiratePartition : public ChMultiratePartition {
+  public:
+    /// Construct a fast partition for the items of the given system.
+    ChShaftsMultiratePartition(std::shared_ptr<ChSystem> fast_system);
+
+    /// Couple a shaft of the slow system with a proxy shaft of the fast system.
+    /// The slow shaft must already be added to the slow system.
+    void AddShaftInterface(std::shared_ptr<ChShaft> slow_shaft, std::shared_ptr<ChShaft> proxy_shaft);
+
+    /// Get the system containing the fast items.
+    std::shared_ptr<ChSystem> GetFastSystem() const { return fast_sys; }
+
+    /// Get the torque currently applied by the fast partition on the specified interface shaft.
+    double GetInterfaceTorque(unsigned int i) const { return interfaces[i].load->GetTorque(); }
+
+    virtual unsigned int GetNumInterfaceCoords() const override { return (unsigned int)interfaces.size(); }
+    virtual void GatherInterfaceState(ChVectorDynamic<>& q, ChVectorDynamic<>& u) override;
+    virtual void ScatterInterfaceState(const ChVectorDynamic<>& q,
+                                       const ChVectorDynamic<>& u,
+                                       const ChVectorDynamic<>& a,
+                                       double time) override;
+    virtual void Advance(double h) override;
+    virtual void GatherInterfaceLoads(ChVectorDynamic<>& f) override;
+    virtual void ApplyInterfaceLoads(const ChVectorDynamic<>& f) override;
+
+  private:
+    struct ShaftInterface {
+        std::shared_ptr<ChShaft> slow_shaft;           ///< interface shaft in the slow system
+        std::shared_ptr<ChShaft> slow_ground;          ///< fixed truss shaft in the slow system
+        std::shared_ptr<ChShaftsAppliedTorque> load;   ///< interface torque applied on the slow shaft
+        std::shared_ptr<ChShaft> proxy_shaft;          ///< proxy shaft in the fast system
+        std::shared_ptr<ChShaft> ground;               ///< fixed truss shaft in the fast system
+        std::shared_ptr<ChShaftsMotorPosition> motor;  ///< motor imposing the interface motion on the proxy
+        std::shared_ptr<ChFunctionSetpoint> setpoint;  ///< interface motion imposed by the motor
+        double acc;                                    ///< imposed interface acceleration
+    };
+
+    std::shared_ptr<ChSystem> fast_sys;
+    std::vector<ShaftInterface> interfaces;
+};
+
+}  // end namespace chrono
+
+#endif
@@ -29,6 +29,7 @@
 #include "chrono/solver/ChSolverPMINRES.h"
 #include "chrono/solver/ChSolverPSOR.h"
 #include "chrono/solver/ChSolverPSSOR.h"
+#include "chrono/solver/ChSolverPSORparallel.h"
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChMatrix.h"
@@ -257,6 +258,9 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         case ChSolver::Type::PSOR:
             solver = chrono_types::make_shared<ChSolverPSOR>();
             break;
+        case ChSolver::Type::PSOR_PARALLEL:
+            solver = chrono_types::make_shared<ChSolverPSORparallel>();
+            break;
         case ChSolver::Type::PSSOR:
             solver = chrono_types::make_shared<ChSolverPSSOR>();
             break;
@@ -287,8 +291,10 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         default:
             std::cout << "Unknown solver type. No solver was set." << std::endl;
             std::cout << "Use SetSolver()." << std::endl;
-            break;
+            return;
     }
+
+    solver->SetNumThreads(nthreads_chrono);
 }
 
 void ChSystem::EnableSolverMatrixWrite(bool val, const std::string& out_dir) {
@@ -319,6 +325,7 @@ void ChSystem::SetSystemDescriptor(std::shared_ptr<ChSystemDescriptor> newdescri
 void ChSystem::SetSolver(std::shared_ptr<ChSolver> newsolver) {
     assert(newsolver);
     solver = newsolver;
+    solver->SetNumThreads(nthreads_chrono);
 }
 
 void ChSystem::SetCollisionSystemType(ChCollisionSystem::Type type) {
@@ -375,6 +382,9 @@ void ChSystem::SetNumThreads(int num_threads_chrono, int num_threads_collision,
     nthreads_collision = (num_threads_collision <= 0) ? num_threads_chrono : num_threads_collision;
     nthreads_eigen = (num_threads_eigen <= 0) ? num_threads_chrono : num_threads_eigen;
 
+    if (solver)
+        solver->SetNumThreads(nthreads_chrono);
+
     if (collision_system)
         collision_system->SetNumThreads(nthreads_collision);
 }
@@ -1594,8 +1604,11 @@ bool ChSystem::AdvanceDynamics() {
     // No need to update counts and offsets, as already done by the above call (in ChSystemDescriptor::EndInsertion)
     ////descriptor->UpdateCountsAndOffsets();
 
-    // Set some settings in timestepper object
-    if (timestepper->GetType() == ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED) {
+    // Set some settings in timestepper object (for multirate integration, based on the slow timestepper type)
+    auto timestepper_type = timestepper->GetType();
+    if (auto multirate = std::dynamic_pointer_cast<ChTimestepperMultirate>(timestepper))
+        timestepper_type = multirate->GetSlowTimestepper()->GetType();
+    if (timestepper_type == ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED) {
         timestepper->Qc_do_clamp = true;
         timestepper->Qc_clamping = max_penetration_recovery_speed;
     } else {
@@ -1649,7 +1662,15 @@ bool ChSystem::DoFrameDynamics(double frame_time, double step_size) {
     step = step_size;
     bool success = true;
 
+    // With adaptive step size control, use the step size proposed by the timestepper (if available)
+    auto adaptive = dynamic_cast<ChAdaptiveTimestepper*>(timestepper.get());
+    if (adaptive && !adaptive->GetStepControl())
+        adaptive = nullptr;
+
     while (ch_time < frame_time) {
+        if (adaptive && adaptive->GetNextStepSize() > 0)
+            step = adaptive->GetNextStepSize();
+
         double left_time = frame_time - ch_time;
 
         if (left_time < 1e-12)
@@ -1741,7 +1762,15 @@ bool ChSystem::DoFrameKinematics(double frame_time, double step_size) {
     step = step_size;
     bool success = true;
 
+    // With adaptive step size control, use the step size proposed by the timestepper (if available)
+    auto adaptive = dynamic_cast<ChAdaptiveTimestepper*>(timestepper.get());
+    if (adaptive && !adaptive->GetStepControl())
+        adaptive = nullptr;
+
     while (ch_time < frame_time) {
+        if (adaptive && adaptive->GetNextStepSize() > 0)
+            step = adaptive->GetNextStepSize();
+
         double left_time = frame_time - ch_time;
 
         if (left_time < 1e-12)
@@ -1966,6 +1995,128 @@ bool ChSystem::DoStaticRelaxing(double step_size, int num_iterations) {
 
 // -----------------------------------------------------------------------------
 
+// Identifier and format version of binary state snapshots.
+static const char snapshot_magic[8] = {'C', 'H', 'S', 'T', 'A', 'T', 'E', '\0'};
+static const int snapshot_version = 1;
+
+void ChSystem::SnapshotWrite(std::vector<char>& snapshot, const void* data, size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    snapshot.insert(snapshot.end(), bytes, bytes + size);
+}
+
+void ChSystem::SnapshotRead(const std::vector<char>& snapshot, size_t& pos, void* data, size_t size) {
+    if (pos + size > snapshot.size())
+        throw std::runtime_error("ChSystem::RestoreStateSnapshot: truncated snapshot");
+    if (data)
+        std::memcpy(data, snapshot.data() + pos, size);
+    pos += size;
+}
+
+void ChSystem::SaveStateSnapshot(std::vector<char>& snapshot) {
+    snapshot.clear();
+    SnapshotWrite(snapshot, snapshot_magic, sizeof(snapshot_magic));
+    SnapshotWrite(snapshot, &snapshot_version, sizeof(snapshot_version));
+    SnapshotWrite(snapshot, &ch_time, sizeof(ch_time));
+    SnapshotWrite(snapshot, &step, sizeof(step));
+    StateSnapshotOut(snapshot);
+}
+
+void ChSystem::RestoreStateSnapshot(const std::vector<char>& snapshot) {
+    size_t pos = 0;
+    char magic[sizeof(snapshot_magic)];
+    int version;
+    SnapshotRead(snapshot, pos, magic, sizeof(magic));
+    SnapshotRead(snapshot, pos, &version, sizeof(version));
+    if (std::memcmp(magic, snapshot_magic, sizeof(magic)) != 0 || version != snapshot_version)
+        throw std::runtime_error("ChSystem::RestoreStateSnapshot: not a valid state snapshot");
+
+    SnapshotRead(snapshot, pos, &ch_time, sizeof(ch_time));
+    SnapshotRead(snapshot, pos, &step, sizeof(step));
+    StateSnapshotIn(snapshot, pos);
+
+    if (pos != snapshot.size())
+        throw std::runtime_error("ChSystem::RestoreStateSnapshot: snapshot does not match the system");
+}
+
+bool ChSystem::WriteStateSnapshot(const std::string& filename) {
+    std::vector<char> snapshot;
+    SaveStateSnapshot(snapshot);
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open())
+        return false;
+    file.write(snapshot.data(), snapshot.size());
+
+    return file.good();
+}
+
+bool ChSystem::ReadStateSnapshot(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        return false;
+    std::vector<char> snapshot((size_t)file.tellg());
+    file.seekg(0);
+    if (!file.read(snapshot.data(), snapshot.size()))
+        return false;
+
+    RestoreStateSnapshot(snapshot);
+
+    return true;
+}
+
+void ChSystem::StateSnapshotOut(std::vector<char>& snapshot) {
+    // Compute the offsets of all physics items with the base Setup, also in derived systems which override it
+    // (e.g., Chrono::Multicore, which does not set up the assembly), and use the resulting counts.
+    ChSystem::Setup();
+
+    ChState x(m_num_coords_pos, this);
+    ChStateDelta v(m_num_coords_vel, this);
+    ChStateDelta a(m_num_coords_vel, this);
+    ChVectorDynamic<> L(m_num_constr);
+    double T;
+    StateGather(x, v, T);
+    StateGatherAcceleration(a);
+    StateGatherReactions(L);
+
+    // The reactions of the assembly items and of the contacts (which follow them in L) are sized separately
+    uint64_t sizes[4] = {(uint64_t)x.size(), (uint64_t)v.size(), assembly.GetNumConstraints(),
+                         contact_container->GetNumConstraints()};
+    SnapshotWrite(snapshot, sizes, sizeof(sizes));
+    SnapshotWrite(snapshot, x.data(), x.size() * sizeof(double));
+    SnapshotWrite(snapshot, v.data(), v.size() * sizeof(double));
+    SnapshotWrite(snapshot, a.data(), a.size() * sizeof(double));
+    SnapshotWrite(snapshot, L.data(), L.size() * sizeof(double));
+}
+
+void ChSystem::StateSnapshotIn(const std::vector<char>& snapshot, size_t& pos) {
+    ChSystem::Setup();
+
+    uint64_t sizes[4];
+    SnapshotRead(snapshot, pos, sizes, sizeof(sizes));
+    if (sizes[0] != m_num_coords_pos || sizes[1] != m_num_coords_vel || sizes[2] != assembly.GetNumConstraints())
+        throw std::runtime_error("ChSystem::RestoreStateSnapshot: snapshot does not match the system");
+
+    ChState x(m_num_coords_pos, this);
+    ChStateDelta v(m_num_coords_vel, this);
+    ChStateDelta a(m_num_coords_vel, this);
+    ChVectorDynamic<> L(m_num_constr);
+    SnapshotRead(snapshot, pos, x.data(), x.size() * sizeof(double));
+    SnapshotRead(snapshot, pos, v.data(), v.size() * sizeof(double));
+    SnapshotRead(snapshot, pos, a.data(), a.size() * sizeof(double));
+
+    // Contact reactions are only meaningful if the current contacts match those in the snapshot
+    L.setZero();
+    SnapshotRead(snapshot, pos, L.data(), sizes[2] * sizeof(double));
+    bool contacts_match = (sizes[3] == contact_container->GetNumConstraints());
+    SnapshotRead(snapshot, pos, contacts_match ? L.data() + sizes[2] : nullptr, sizes[3] * sizeof(double));
+
+    StateScatter(x, v, ch_time, true);
+    StateScatterAcceleration(a);
+    StateScatterReactions(L);
+}
+
+// -----------------------------------------------------------------------------
+
 void ChSystem::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChSystem>();
@@ -37,6 +37,7 @@
 #include "chrono/timestepper/ChIntegrable.h"
 #include "chrono/timestepper/ChTimestepper.h"
 #include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/timestepper/ChTimestepperMultirate.h"
 #include "chrono/timestepper/ChStaticAnalysis.h"
 
 namespace chrono {
@@ -171,10 +172,14 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Advance the dynamics simulation by a single time step of given length.
     /// This function is typically called many times in a loop in order to simulate up to a desired end time.
+    /// With adaptive step size control and unilateral constraints, the step actually taken may be shorter (see
+    /// ChAdaptiveTimestepper); use DoFrameDynamics to reach a given time.
     int DoStepDynamics(double step_size);
 
     /// Advance the dynamics simulation until the specified frame end time is reached.
     /// Integration proceeds with the specified time step size which may be adjusted to exactly reach the frame time.
+    /// If the timestepper uses adaptive step size control (see ChAdaptiveTimestepper), the specified step size is only
+    /// used until the timestepper proposes a step size; each step then uses the proposed size.
     bool DoFrameDynamics(double frame_time, double step_size);
 
     // ---- KINEMATICS
@@ -250,8 +255,12 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
-    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
-    ///                           in SCM deformable terrain calculations.
+    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians), in SMC contact
+    ///                           force calculation and assembly, in the per-item loops over bodies, shafts, and links
+    ///                           (state gather/scatter, residual and Jacobian loading), in multithreaded solvers
+    ///                           (e.g., PSOR_PARALLEL), and in SCM deformable terrain calculations.
+    ///                           If larger than 1, user-supplied callbacks invoked during these operations (e.g., force
+    ///                           functors of springs) must be thread-safe.
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
     ///   num_threads_eigen     - used in the Eigen sparse direct solvers and a few linear algebra operations.
@@ -574,6 +583,30 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     // ---- SERIALIZATION
 
+    /// Save a binary snapshot of the dynamic state of the system in the provided buffer.
+    /// The snapshot contains the current time and step size, the state vectors of all physics items (positions,
+    /// velocities, accelerations, and constraint reactions, see StateGather), and any additional state maintained by
+    /// derived system classes. Each vector is stored as a single block of raw values, in native byte order. Unlike
+    /// serialization with ArchiveOut, the snapshot does not describe the system structure and can only be restored in a
+    /// system with the same physics items, in the same order (e.g., the system which produced it, or an identical
+    /// system constructed by the same code). A typical use is to start several simulation branches from a common state.
+    void SaveStateSnapshot(std::vector<char>& snapshot);
+
+    /// Restore the dynamic state of the system from a snapshot created with SaveStateSnapshot.
+    /// The contact reactions are restored only if the current number of contact constraints matches that in the
+    /// snapshot; in any case, contacts are regenerated by the collision detection at the next step. Persistent data of
+    /// the collision system (e.g., Bullet contact manifolds) is not included in the snapshot.
+    /// An exception is thrown if the snapshot is not valid or does not match this system.
+    void RestoreStateSnapshot(const std::vector<char>& snapshot);
+
+    /// Write a binary snapshot of the dynamic state of the system to the specified file (see SaveStateSnapshot).
+    /// The snapshot is written with a single write operation. Return false if the file could not be written.
+    bool WriteStateSnapshot(const std::string& filename);
+
+    /// Restore the dynamic state of the system from a file created with WriteStateSnapshot.
+    /// The file is loaded with a single read operation. Return false if the file could not be read.
+    bool ReadStateSnapshot(const std::string& filename);
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive_out);
 
@@ -656,7 +689,7 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     virtual unsigned int GetNumConstraintsBilateral() { return m_num_constr_bil; }
 
     /// Get the number of unilateral scalar constraints.
-    virtual unsigned int GetNumConstraintsUnilateral() { return m_num_constr_uni; }
+    virtual unsigned int GetNumConstraintsUnilateral() override { return m_num_constr_uni; }
 
     /// From system to state y={x,v}
     virtual void StateGather(ChState& x, ChStateDelta& v, double& T) override;
@@ -788,6 +821,23 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Performs a single dynamics simulation step, advancing the system state by the current step size.
     virtual bool AdvanceDynamics();
 
+    /// Append the state of the system to a binary state snapshot (see SaveStateSnapshot).
+    /// Derived classes which maintain additional state (outside the state vectors of the physics items) must override
+    /// this function and StateSnapshotIn, and call the base class version first. The offsets of the physics items are
+    /// computed with ChSystem::Setup, regardless of any override.
+    virtual void StateSnapshotOut(std::vector<char>& snapshot);
+
+    /// Load the state of the system from a binary state snapshot (see RestoreStateSnapshot).
+    /// Data is read starting at position `pos`, which is advanced past the data read.
+    virtual void StateSnapshotIn(const std::vector<char>& snapshot, size_t& pos);
+
+    /// Append a block of raw data to a binary state snapshot.
+    static void SnapshotWrite(std::vector<char>& snapshot, const void* data, size_t size);
+
+    /// Read a block of raw data from a binary state snapshot at position `pos` and advance the position.
+    /// If `data` is null, the block is skipped. An exception is thrown if the snapshot does not contain enough data.
+    static void SnapshotRead(const std::vector<char>& snapshot, size_t& pos, void* data, size_t size);
+
     ChAssembly assembly;  ///< underlying mechanical assembly
 
     std::shared_ptr<ChContactContainer> contact_container;  ///< the container of contacts
@@ -141,6 +141,8 @@ class ChApi ChSystemSMC : public ChSystem {
     };
 
     /// Change the default SMC contact force calculation (and torque, too, if needed).
+    /// Note that contact forces are calculated concurrently for different contacts if the system uses more than one
+    /// Chrono thread (see ChSystem::SetNumThreads); a custom algorithm must then be thread-safe.
     virtual void SetContactForceTorqueAlgorithm(std::unique_ptr<ChContactForceTorqueSMC>&& algorithm);
 
     /// Accessor for the current SMC contact force calculation.
@@ -763,6 +763,26 @@ class _wrap_pair {
     std::pair<T, Tv>* _wpair;
 };
 
+/// Traits for types whose arrays can be processed by archives as a single block of raw memory.
+/// This is the case for all arithmetic types except bool. A class can also specialize this trait (with is_raw = true)
+/// if its objects are stored as a fixed number of values of a single arithmetic type (scalar_type), with no padding,
+/// and if its ArchiveOut function writes exactly these values, in memory order, after the class version (see ChVector3
+/// and ChQuaternion). For such classes, is_versioned must be set to true.
+template <class T, class Enable = void>
+struct ChArchiveRawTraits {
+    static const bool is_raw = false;        ///< arrays of this type can be processed as raw memory blocks
+    static const bool is_versioned = false;  ///< ArchiveOut writes a class version before the values
+    typedef char scalar_type;                ///< type of the values making up an object
+};
+
+template <class T>
+struct ChArchiveRawTraits<T,
+                          typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>::type> {
+    static const bool is_raw = true;
+    static const bool is_versioned = false;
+    typedef T scalar_type;
+};
+
 /// Base class for archives with pointers to shared objects.
 class ChApi ChArchive {
   protected:
@@ -772,6 +792,20 @@ class ChApi ChArchive {
 
     bool use_versions;
 
+    /// Return the index of the first element of an array of objects of type T from which all remaining elements can be
+    /// processed as a single raw memory block (see ChArchiveRawTraits). With class versions, the first element is
+    /// always processed individually, since it may carry the (clustered) class version; without clustering, each
+    /// element carries its own version and the array cannot be processed as a block. Return `size` if there is no such
+    /// element.
+    template <class T>
+    size_t RawArrayStart(size_t size) const {
+        if (!ChArchiveRawTraits<T>::is_raw)
+            return size;
+        if (!ChArchiveRawTraits<T>::is_versioned || !use_versions)
+            return 0;
+        return cluster_class_versions ? std::min(size, (size_t)1) : size;
+    }
+
   public:
     ChArchive();
 
@@ -888,6 +922,16 @@ class ChApi ChArchiveOut : public ChArchive {
     virtual void out_array_between(ChValue& bVal, size_t msize) = 0;
     virtual void out_array_end(ChValue& bVal, size_t msize) = 0;
 
+    /// Write a block of array elements as raw memory: `num_scalars` contiguous values of size `scalar_size` each.
+    /// Called between out_array_pre and out_array_end, in place of the element-by-element serialization of the
+    /// remaining array elements (see ChArchiveRawTraits). Return false if not supported by this archive (default), in
+    /// which case the elements are serialized individually. An archive supporting raw blocks must write the same
+    /// sequence of values as the element-by-element serialization, so that the resulting archive does not depend on
+    /// the path taken.
+    virtual bool out_array_raw(ChValue& bVal, const void* data, size_t num_scalars, size_t scalar_size) {
+        return false;
+    }
+
     //---------------------------------------------------
 
     // trick to wrap enum mappers:
@@ -919,7 +963,10 @@ class ChApi ChArchiveOut : public ChArchive {
         ChValueSpecific<std::vector<T>> specVal(bVal.value(), bVal.name(), bVal.flags(), bVal.GetCausality(),
                                                 bVal.GetVariability());
         this->out_array_pre(specVal, bVal.value().size());
+        size_t raw_start = RawArrayStart<T>(bVal.value().size());
         for (size_t i = 0; i < bVal.value().size(); ++i) {
+            if (i == raw_start && out_vector_raw(specVal, bVal.value(), i))
+                break;
             ChNameValue<T> array_val(std::to_string(i), bVal.value()[i]);
             this->out(array_val);
             this->out_array_between(specVal, bVal.value().size());
@@ -1082,6 +1129,24 @@ class ChApi ChArchiveOut : public ChArchive {
 
   protected:
     virtual void out_version(int mver, const std::type_index mtypeid);
+
+  private:
+    // Write the elements of a vector, starting at the specified index, as a raw memory block (if supported).
+    template <class T>
+    bool out_vector_raw(ChValue& specVal, std::vector<T>& vec, size_t start) {
+        return out_vector_raw(specVal, vec, start, std::integral_constant<bool, ChArchiveRawTraits<T>::is_raw>());
+    }
+
+    template <class T>
+    bool out_vector_raw(ChValue& specVal, std::vector<T>& vec, size_t start, std::true_type) {
+        typedef typename ChArchiveRawTraits<T>::scalar_type S;
+        return out_array_raw(specVal, vec.data() + start, (vec.size() - start) * (sizeof(T) / sizeof(S)), sizeof(S));
+    }
+
+    template <class T>
+    bool out_vector_raw(ChValue& specVal, std::vector<T>& vec, size_t start, std::false_type) {
+        return false;
+    }
 };
 
 /// Base class for deserializing from archives.
@@ -1175,6 +1240,13 @@ class ChApi ChArchiveIn : public ChArchive {
     virtual void in_array_between(const std::string& name) = 0;
     virtual void in_array_end(const std::string& name) = 0;
 
+    /// Read a block of array elements as raw memory: `num_scalars` contiguous values of size `scalar_size` each.
+    /// Counterpart of ChArchiveOut::out_array_raw. Return false if not supported by this archive (default), in which
+    /// case the elements are deserialized individually.
+    virtual bool in_array_raw(const std::string& name, void* data, size_t num_scalars, size_t scalar_size) {
+        return false;
+    }
+
     //---------------------------------------------------
 
     // trick to wrap enum mappers:
@@ -1214,7 +1286,10 @@ class ChApi ChArchiveIn : public ChArchive {
         if (!this->in_array_pre(bVal.name(), arraysize))  // TODO: DARIOM check why it was commented out
             return false;
         bVal.value().resize(arraysize);
+        size_t raw_start = RawArrayStart<T>(arraysize);
         for (size_t i = 0; i < arraysize; ++i) {
+            if (i == raw_start && in_vector_raw(bVal.name(), bVal.value(), i))
+                break;
             T element;
             ChNameValue<T> array_val(std::to_string(i), element);
             this->in(array_val);
@@ -1397,6 +1472,24 @@ class ChApi ChArchiveIn : public ChArchive {
 
   protected:
     virtual int in_version(const std::type_index mtypeid);
+
+  private:
+    // Read the elements of a vector, starting at the specified index, as a raw memory block (if supported).
+    template <class T>
+    bool in_vector_raw(const std::string& name, std::vector<T>& vec, size_t start) {
+        return in_vector_raw(name, vec, start, std::integral_constant<bool, ChArchiveRawTraits<T>::is_raw>());
+    }
+
+    template <class T>
+    bool in_vector_raw(const std::string& name, std::vector<T>& vec, size_t start, std::true_type) {
+        typedef typename ChArchiveRawTraits<T>::scalar_type S;
+        return in_array_raw(name, vec.data() + start, (vec.size() - start) * (sizeof(T) / sizeof(S)), sizeof(S));
+    }
+
+    template <class T>
+    bool in_vector_raw(const std::string& name, std::vector<T>& vec, size_t start, std::false_type) {
+        return false;
+    }
 };
 
 template <class TClass>
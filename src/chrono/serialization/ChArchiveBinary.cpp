@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "chrono/serialization/ChArchiveBinary.h"
 
 namespace chrono {
@@ -59,6 +61,11 @@ void ChArchiveOutBinary::out_array_between(ChValue& bVal, size_t size) {}
 
 void ChArchiveOutBinary::out_array_end(ChValue& bVal, size_t size) {}
 
+bool ChArchiveOutBinary::out_array_raw(ChValue& bVal, const void* data, size_t num_scalars, size_t scalar_size) {
+    m_ostream.write(reinterpret_cast<const char*>(data), num_scalars * scalar_size);
+    return true;
+}
+
 // for custom c++ objects:
 
 void ChArchiveOutBinary::out(ChValue& bVal, bool tracked, size_t obj_ID) {
@@ -186,6 +193,16 @@ bool ChArchiveInBinary::in_array_pre(const std::string& name, size_t& size) {
     return true;
 }
 
+bool ChArchiveInBinary::in_array_raw(const std::string& name, void* data, size_t num_scalars, size_t scalar_size) {
+    char* bytes = reinterpret_cast<char*>(data);
+    m_istream.read(bytes, num_scalars * scalar_size);
+    if (m_big_endian_machine && scalar_size > 1) {
+        for (size_t i = 0; i < num_scalars; i++, bytes += scalar_size)
+            std::reverse(bytes, bytes + scalar_size);
+    }
+    return true;
+}
+
 bool ChArchiveInBinary::in_ref(ChNameValue<ChFunctorArchiveIn> bVal, void** ptr, std::string& true_classname) {
     void* new_ptr = nullptr;
 
@@ -68,6 +68,9 @@ class ChApi ChArchiveOutBinary : public ChArchiveOut {
     virtual void out_array_between(ChValue& bVal, size_t size);
     virtual void out_array_end(ChValue& bVal, size_t size);
 
+    /// Write a block of contiguous array elements with a single stream write.
+    virtual bool out_array_raw(ChValue& bVal, const void* data, size_t num_scalars, size_t scalar_size) override;
+
     // for custom c++ objects:
     virtual void out(ChValue& bVal, bool tracked, size_t obj_ID);
 
@@ -128,6 +131,9 @@ class ChApi ChArchiveInBinary : public ChArchiveIn {
     virtual void in_array_between(const std::string& name) override {}
     virtual void in_array_end(const std::string& name) override {}
 
+    /// Read a block of contiguous array elements with a single stream read (byte-swapped in place, if needed).
+    virtual bool in_array_raw(const std::string& name, void* data, size_t num_scalars, size_t scalar_size) override;
+
     // for custom c++ objects
     virtual bool in(ChNameValue<ChFunctorArchiveIn> bVal) override;
 
@@ -15,12 +15,16 @@
 #ifndef CHCONSTRAINT_H
 #define CHCONSTRAINT_H
 
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChClassFactory.h"
 #include "chrono/core/ChMatrix.h"
 
 namespace chrono {
 
+class ChVariables;
+
 /// Base class for representing constraints (bilateral or unilateral).
 /// These constraints are used with variational inequality or DAE solvers for problems including equalities,
 /// inequalities, nonlinearities, etc.
@@ -214,6 +218,19 @@ class ChApi ChConstraint {
     ///   For boxed constraints and similar, inherited class *should* override this implementation.
     virtual double Violation(double mc_i);
 
+    /// Append to 'vars' the ChVariables objects referenced by this constraint.
+    /// This information is used by solvers that process several constraints concurrently (e.g., ChSolverPSORparallel)
+    /// in order to identify constraints which act on disjoint sets of variables. Return false if the referenced
+    /// variables cannot be determined (default); such a constraint is then assumed to be coupled to all others.
+    virtual bool CollectVariables(std::vector<ChVariables*>& vars) const { return false; }
+
+    /// Append to 'Cq' and 'Eq' the Jacobian [Cq_i] and the auxiliary vector [Eq_i]=[invM_i]*[Cq_i]' of this constraint.
+    /// Both are written as a sequence of chunks, one for each of the variables objects reported by CollectVariables (in
+    /// the same order), each chunk with as many entries as the number of DOFs of the corresponding variables object.
+    /// [Eq_i] is valid only after a call to Update_auxiliary. Return false if not supported (default).
+    /// Used by ChSystemDescriptor::PackJacobians.
+    virtual bool PackJacobian(std::vector<double>& Cq, std::vector<double>& Eq) { return false; }
+
     /// Write the constraint Jacobian into the specified global matrix at the offsets of the associated variables.
     /// The (start_row, start_col) pair specifies the top-left corner of the system-level constraint Jacobian in the
     /// provided matrix.
@@ -138,6 +138,14 @@ void ChConstraintNgeneric::PasteJacobianTransposedInto(ChSparseMatrix& mat,
     }
 }
 
+bool ChConstraintNgeneric::PackJacobian(std::vector<double>& Cq_packed, std::vector<double>& Eq_packed) {
+    for (size_t i = 0; i < variables.size(); ++i) {
+        Cq_packed.insert(Cq_packed.end(), Cq[i].data(), Cq[i].data() + Cq[i].size());
+        Eq_packed.insert(Eq_packed.end(), Eq[i].data(), Eq[i].data() + Eq[i].size());
+    }
+    return true;
+}
+
 void ChConstraintNgeneric::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChConstraintNgeneric>();
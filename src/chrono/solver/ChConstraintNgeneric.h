@@ -48,6 +48,15 @@ class ChApi ChConstraintNgeneric : public ChConstraint {
     /// Set references to the constrained ChVariables objects,automatically creating/resizing Jacobians as needed.
     void SetVariables(std::vector<ChVariables*> mvars);
 
+    /// Append to 'vars' all constrained variables objects.
+    virtual bool CollectVariables(std::vector<ChVariables*>& vars) const override {
+        vars.insert(vars.end(), variables.begin(), variables.end());
+        return true;
+    }
+
+    /// Append to 'Cq' and 'Eq' the Jacobian and auxiliary vector chunks for all constrained variables objects.
+    virtual bool PackJacobian(std::vector<double>& Cq, std::vector<double>& Eq) override;
+
     /// This function updates the following auxiliary data:
     ///  - the Eq_a and Eq_b matrices
     ///  - the g_i product
@@ -39,6 +39,24 @@ ChConstraintThree& ChConstraintThree::operator=(const ChConstraintThree& other)
     return *this;
 }
 
+bool ChConstraintThree::PackJacobian(std::vector<double>& Cq, std::vector<double>& Eq) {
+    ChRowVectorRef Cq_a = Get_Cq_a();
+    ChRowVectorRef Cq_b = Get_Cq_b();
+    ChRowVectorRef Cq_c = Get_Cq_c();
+    ChVectorRef Eq_a = Get_Eq_a();
+    ChVectorRef Eq_b = Get_Eq_b();
+    ChVectorRef Eq_c = Get_Eq_c();
+
+    Cq.insert(Cq.end(), Cq_a.data(), Cq_a.data() + Cq_a.size());
+    Cq.insert(Cq.end(), Cq_b.data(), Cq_b.data() + Cq_b.size());
+    Cq.insert(Cq.end(), Cq_c.data(), Cq_c.data() + Cq_c.size());
+    Eq.insert(Eq.end(), Eq_a.data(), Eq_a.data() + Eq_a.size());
+    Eq.insert(Eq.end(), Eq_b.data(), Eq_b.data() + Eq_b.size());
+    Eq.insert(Eq.end(), Eq_c.data(), Eq_c.data() + Eq_c.size());
+
+    return true;
+}
+
 void ChConstraintThree::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChConstraintThree>();
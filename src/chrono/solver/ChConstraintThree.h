@@ -73,6 +73,17 @@ class ChApi ChConstraintThree : public ChConstraint {
     /// automatically creating/resizing jacobians if needed.
     virtual void SetVariables(ChVariables* mvariables_a, ChVariables* mvariables_b, ChVariables* mvariables_c) = 0;
 
+    /// Append to 'vars' the three constrained variables objects.
+    virtual bool CollectVariables(std::vector<ChVariables*>& vars) const override {
+        vars.push_back(variables_a);
+        vars.push_back(variables_b);
+        vars.push_back(variables_c);
+        return true;
+    }
+
+    /// Append to 'Cq' and 'Eq' the Jacobian and auxiliary vector chunks for the three constrained variables objects.
+    virtual bool PackJacobian(std::vector<double>& Cq, std::vector<double>& Eq) override;
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive_out) override;
 
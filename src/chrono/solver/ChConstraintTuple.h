@@ -72,6 +72,13 @@ class ChConstraintTuple_1vars {
         variables = m_tuple_carrier.GetVariables1();
     }
 
+    void CollectVariables(std::vector<ChVariables*>& vars) const { vars.push_back(variables); }
+
+    void PackJacobian(std::vector<double>& Cq_packed, std::vector<double>& Eq_packed) const {
+        Cq_packed.insert(Cq_packed.end(), Cq.data(), Cq.data() + Cq.size());
+        Eq_packed.insert(Eq_packed.end(), Eq.data(), Eq.data() + Eq.size());
+    }
+
     void Update_auxiliary(double& g_i) {
         // 1- Assuming jacobians are already computed, now compute
         //   the matrices [Eq]=[invM]*[Cq]' and [Eq]
@@ -187,6 +194,18 @@ class ChConstraintTuple_2vars {
         variables_2 = m_tuple_carrier.GetVariables2();
     }
 
+    void CollectVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+    }
+
+    void PackJacobian(std::vector<double>& Cq_packed, std::vector<double>& Eq_packed) const {
+        Cq_packed.insert(Cq_packed.end(), Cq_1.data(), Cq_1.data() + Cq_1.size());
+        Cq_packed.insert(Cq_packed.end(), Cq_2.data(), Cq_2.data() + Cq_2.size());
+        Eq_packed.insert(Eq_packed.end(), Eq_1.data(), Eq_1.data() + Eq_1.size());
+        Eq_packed.insert(Eq_packed.end(), Eq_2.data(), Eq_2.data() + Eq_2.size());
+    }
+
     void Update_auxiliary(double& g_i) {
         // 1- Assuming jacobians are already computed, now compute
         //   the matrices [Eq_a]=[invM_a]*[Cq_a]' and [Eq_b]
@@ -342,6 +361,21 @@ class ChConstraintTuple_3vars {
         variables_3 = m_tuple_carrier.GetVariables3();
     }
 
+    void CollectVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+        vars.push_back(variables_3);
+    }
+
+    void PackJacobian(std::vector<double>& Cq_packed, std::vector<double>& Eq_packed) const {
+        Cq_packed.insert(Cq_packed.end(), Cq_1.data(), Cq_1.data() + Cq_1.size());
+        Cq_packed.insert(Cq_packed.end(), Cq_2.data(), Cq_2.data() + Cq_2.size());
+        Cq_packed.insert(Cq_packed.end(), Cq_3.data(), Cq_3.data() + Cq_3.size());
+        Eq_packed.insert(Eq_packed.end(), Eq_1.data(), Eq_1.data() + Eq_1.size());
+        Eq_packed.insert(Eq_packed.end(), Eq_2.data(), Eq_2.data() + Eq_2.size());
+        Eq_packed.insert(Eq_packed.end(), Eq_3.data(), Eq_3.data() + Eq_3.size());
+    }
+
     void Update_auxiliary(double& g_i) {
         // 1- Assuming jacobians are already computed, now compute
         //   the matrices [Eq_a]=[invM_a]*[Cq_a]' and [Eq_b]
@@ -538,6 +572,24 @@ class ChConstraintTuple_4vars {
         variables_4 = m_tuple_carrier.GetVariables4();
     }
 
+    void CollectVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+        vars.push_back(variables_3);
+        vars.push_back(variables_4);
+    }
+
+    void PackJacobian(std::vector<double>& Cq_packed, std::vector<double>& Eq_packed) const {
+        Cq_packed.insert(Cq_packed.end(), Cq_1.data(), Cq_1.data() + Cq_1.size());
+        Cq_packed.insert(Cq_packed.end(), Cq_2.data(), Cq_2.data() + Cq_2.size());
+        Cq_packed.insert(Cq_packed.end(), Cq_3.data(), Cq_3.data() + Cq_3.size());
+        Cq_packed.insert(Cq_packed.end(), Cq_4.data(), Cq_4.data() + Cq_4.size());
+        Eq_packed.insert(Eq_packed.end(), Eq_1.data(), Eq_1.data() + Eq_1.size());
+        Eq_packed.insert(Eq_packed.end(), Eq_2.data(), Eq_2.data() + Eq_2.size());
+        Eq_packed.insert(Eq_packed.end(), Eq_3.data(), Eq_3.data() + Eq_3.size());
+        Eq_packed.insert(Eq_packed.end(), Eq_4.data(), Eq_4.data() + Eq_4.size());
+    }
+
     void Update_auxiliary(double& g_i) {
         // 1- Assuming jacobians are already computed, now compute
         //   the matrices [Eq_a]=[invM_a]*[Cq_a]' and [Eq_b]
@@ -37,6 +37,20 @@ ChConstraintTwo& ChConstraintTwo::operator=(const ChConstraintTwo& other) {
     return *this;
 }
 
+bool ChConstraintTwo::PackJacobian(std::vector<double>& Cq, std::vector<double>& Eq) {
+    ChRowVectorRef Cq_a = Get_Cq_a();
+    ChRowVectorRef Cq_b = Get_Cq_b();
+    ChVectorRef Eq_a = Get_Eq_a();
+    ChVectorRef Eq_b = Get_Eq_b();
+
+    Cq.insert(Cq.end(), Cq_a.data(), Cq_a.data() + Cq_a.size());
+    Cq.insert(Cq.end(), Cq_b.data(), Cq_b.data() + Cq_b.size());
+    Eq.insert(Eq.end(), Eq_a.data(), Eq_a.data() + Eq_a.size());
+    Eq.insert(Eq.end(), Eq_b.data(), Eq_b.data() + Eq_b.size());
+
+    return true;
+}
+
 void ChConstraintTwo::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChConstraintTwo>();
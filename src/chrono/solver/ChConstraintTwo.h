@@ -65,6 +65,16 @@ class ChApi ChConstraintTwo : public ChConstraint {
     /// automatically creating/resizing jacobians if needed.
     virtual void SetVariables(ChVariables* mvariables_a, ChVariables* mvariables_b) = 0;
 
+    /// Append to 'vars' the two constrained variables objects.
+    virtual bool CollectVariables(std::vector<ChVariables*>& vars) const override {
+        vars.push_back(variables_a);
+        vars.push_back(variables_b);
+        return true;
+    }
+
+    /// Append to 'Cq' and 'Eq' the Jacobian and auxiliary vector chunks for the two constrained variables objects.
+    virtual bool PackJacobian(std::vector<double>& Cq, std::vector<double>& Eq) override;
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive_out) override;
 
@@ -56,6 +56,20 @@ class ChConstraintTwoTuples : public ChConstraint {
     /// Access tuple b.
     type_constraint_tuple_b& Get_tuple_b() { return tuple_b; }
 
+    /// Append to 'vars' the variables objects of both tuples.
+    virtual bool CollectVariables(std::vector<ChVariables*>& vars) const override {
+        tuple_a.CollectVariables(vars);
+        tuple_b.CollectVariables(vars);
+        return true;
+    }
+
+    /// Append to 'Cq' and 'Eq' the Jacobian and auxiliary vector chunks of both tuples.
+    virtual bool PackJacobian(std::vector<double>& Cq, std::vector<double>& Eq) override {
+        tuple_a.PackJacobian(Cq, Eq);
+        tuple_b.PackJacobian(Cq, Eq);
+        return true;
+    }
+
     virtual void Update_auxiliary() override {
         g_i = 0;
         tuple_a.Update_auxiliary(g_i);
@@ -26,6 +26,7 @@ ChDirectSolverLS::ChDirectSolverLS()
     : m_lock(false),
       m_use_learner(true),
       m_force_update(true),
+      m_use_map(true),
       m_null_pivot_detection(false),
       m_use_rhs_sparsity(false),
       m_use_perm(false),
@@ -33,11 +34,16 @@ ChDirectSolverLS::ChDirectSolverLS()
       m_dim(0),
       m_sparsity(-1),
       m_solve_call(0),
-      m_setup_call(0) {}
+      m_setup_call(0),
+      m_analysis_call(0),
+      m_analyzed(false),
+      m_pattern_hash(0) {}
 
 void ChDirectSolverLS::ResetTimers() {
     m_timer_setup_assembly.reset();
     m_timer_setup_solvercall.reset();
+    m_timer_setup_analysis.reset();
+    m_timer_setup_factorization.reset();
     m_timer_solve_assembly.reset();
     m_timer_solve_solvercall.reset();
 }
@@ -69,22 +75,39 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         std::cout << "  CALL reserve:   " << call_reserve << std::endl;
     }
 
-    if (call_learner) {
-        ChSparsityPatternLearner sparsity_pattern(m_dim, m_dim);
-        sysd.BuildSystemMatrix(&sparsity_pattern, nullptr);
-        sparsity_pattern.Apply(m_mat);
-        m_force_update = false;
-    } else if (call_reserve) {
-        double density = (m_sparsity > 0) ? 1 - m_sparsity : 1 - SPM_DEF_SPARSITY;
-        m_mat.resize(m_dim, m_dim);
-        m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
+    // If the sparsity pattern is locked and no update was requested, assemble the matrix using the assembly map
+    // recorded at a previous call. This fails (and the map is discarded) if the problem structure has changed.
+    bool use_map = m_lock && m_use_map && !call_learner && !call_reserve;
+    bool assembled = use_map && m_map.IsValid() && sysd.BuildSystemMatrix(m_mat, m_map, num_threads);
+
+    if (verbose) {
+        std::cout << "  use map?        " << assembled << std::endl;
     }
 
-    // Let the system descriptor load the current matrix
-    sysd.BuildSystemMatrix(&m_mat, nullptr);
+    if (!assembled) {
+        if (call_learner) {
+            ChSparsityPatternLearner sparsity_pattern(m_dim, m_dim);
+            sysd.BuildSystemMatrix(&sparsity_pattern, nullptr);
+            sparsity_pattern.Apply(m_mat);
+            m_force_update = false;
+        } else if (call_reserve) {
+            double density = (m_sparsity > 0) ? 1 - m_sparsity : 1 - SPM_DEF_SPARSITY;
+            m_mat.resize(m_dim, m_dim);
+            m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
+        }
 
-    // Allow the matrix to be compressed
-    m_mat.makeCompressed();
+        // Let the system descriptor load the current matrix
+        sysd.BuildSystemMatrix(&m_mat, nullptr);
+
+        // Allow the matrix to be compressed
+        m_mat.makeCompressed();
+
+        // Record the assembly map for subsequent calls
+        if (m_lock && m_use_map)
+            sysd.BuildSystemMatrixMap(m_mat, m_map);
+        else
+            m_map.Invalidate();
+    }
 
     m_timer_setup_assembly.stop();
 
@@ -93,7 +116,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
 
     // Let the concrete solver perform the facorization
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = AnalyzeAndFactorize();
     m_timer_setup_solvercall.stop();
 
     if (write_matrix)
@@ -103,8 +126,9 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         std::cout << " Solver setup [" << m_setup_call << "] n = " << m_dim << "  nnz = " << (int)m_mat.nonZeros()
                   << std::endl;
         std::cout << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSeconds() << "s\n"
-                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s"
-                  << std::endl;
+                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s\n"
+                  << "    analyze:         " << m_timer_setup_analysis.GetTimeSeconds() << "s\n"
+                  << "    factorize:       " << m_timer_setup_factorization.GetTimeSeconds() << "s" << std::endl;
     }
 
     m_setup_call++;
@@ -169,15 +193,16 @@ bool ChDirectSolverLS::SetupCurrent() {
 
     // Let the concrete solver perform the factorization
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = AnalyzeAndFactorize();
     m_timer_setup_solvercall.stop();
 
     if (verbose) {
         std::cout << " Solver SetupCurrent() [" << m_setup_call << "] n = " << m_dim
                   << "  nnz = " << (int)m_mat.nonZeros() << std::endl;
         std::cout << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSeconds() << "s\n"
-                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s"
-                  << std::endl;
+                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s\n"
+                  << "    analyze:         " << m_timer_setup_analysis.GetTimeSeconds() << "s\n"
+                  << "    factorize:       " << m_timer_setup_factorization.GetTimeSeconds() << "s" << std::endl;
     }
 
     m_setup_call++;
@@ -222,6 +247,46 @@ double ChDirectSolverLS::SolveCurrent() {
 
 // ---------------------------------------------------------------------------
 
+// Hash of the sparsity pattern (dimensions and CSR index arrays) of a compressed sparse matrix.
+static size_t PatternHash(const ChSparseMatrix& M) {
+    size_t hash = 14695981039346656037ULL;
+    auto combine = [&hash](size_t v) { hash = (hash ^ v) * 1099511628211ULL; };
+    combine((size_t)M.rows());
+    combine((size_t)M.cols());
+    for (int i = 0; i <= M.outerSize(); i++)
+        combine((size_t)M.outerIndexPtr()[i]);
+    for (int k = 0; k < M.nonZeros(); k++)
+        combine((size_t)M.innerIndexPtr()[k]);
+    return hash;
+}
+
+bool ChDirectSolverLS::AnalyzeAndFactorize() {
+    // Check the pattern also if the matrix was assembled with the assembly map, as a safeguard against structural
+    // changes not detected by the map
+    size_t hash = PatternHash(m_mat);
+    bool analyze = !m_analyzed || (hash != m_pattern_hash);
+    m_pattern_hash = hash;
+
+    if (analyze) {
+        m_timer_setup_analysis.start();
+        m_analyzed = AnalyzeMatrix();
+        m_timer_setup_analysis.stop();
+        m_analysis_call++;
+        if (!m_analyzed)
+            return false;
+    }
+
+    m_timer_setup_factorization.start();
+    bool result = FactorizeMatrix();
+    m_timer_setup_factorization.stop();
+
+    // Force a new analysis at the next call after a failed factorization
+    if (!result)
+        m_analyzed = false;
+
+    return result;
+}
+
 void ChDirectSolverLS::WriteMatrix(const std::string& filename, const ChSparseMatrix& M) {
     std::ofstream file(filename);
     file << std::setprecision(12) << std::scientific;
@@ -274,8 +339,14 @@ void ChDirectSolverLS::ArchiveIn(ChArchiveIn& archive_in) {
 
 // ---------------------------------------------------------------------------
 
+bool ChSolverSparseLU::AnalyzeMatrix() {
+    // The symbolic analysis does not report errors (these are detected during factorization)
+    m_engine.analyzePattern(m_mat);
+    return true;
+}
+
 bool ChSolverSparseLU::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
@@ -303,8 +374,14 @@ void ChSolverSparseLU::PrintErrorMessage() {
 
 // ---------------------------------------------------------------------------
 
+bool ChSolverSparseQR::AnalyzeMatrix() {
+    // The symbolic analysis does not report errors (these are detected during factorization)
+    m_engine.analyzePattern(m_mat);
+    return true;
+}
+
 bool ChSolverSparseQR::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
@@ -46,6 +46,10 @@ Setup. This feature is intended for problems where the system matrix sparsity pa
 call to call.\n
 See #LockSparsityPattern();
 
+Whenever the sparsity pattern of the assembled matrix is unchanged from the previous call (as detected from a hash of
+the matrix structure), the symbolic analysis (fill-reducing ordering and symbolic factorization) is reused and only a
+numeric factorization is performed. See GetTimeSetup_Analysis() and GetTimeSetup_Factorization().
+
 The sparsity pattern \e learning feature acquires the sparsity pattern in advance, in order to speed up matrix assembly.
 Enabled by default, the sparsity matrix learner identifies the exact matrix sparsity pattern (without actually setting
 any nonzeros).\n
@@ -92,6 +96,12 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
     void ForceSparsityPatternUpdate() { m_force_update = true; }
 
+    /// Enable/disable use of a cached assembly map when the sparsity pattern is locked (default: enabled).\n
+    /// If enabled, the position in the matrix value array of all elements pasted during assembly is recorded at the
+    /// first call with a locked sparsity pattern. Subsequent assemblies write directly into the matrix value array,
+    /// using the number of threads set through SetNumThreads. See ChSparseAssemblyMap.
+    void UseAssemblyMap(bool val) { m_use_map = val; }
+
     /// Set estimate for matrix sparsity, a value in [0,1], with 0 indicating a fully dense matrix (default: 0.9).\n
     /// Only used if the sparsity pattern learner is disabled.
     void SetSparsityEstimate(double sparsity) { m_sparsity = sparsity; }
@@ -122,11 +132,19 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     double GetTimeSetup_Assembly() const { return m_timer_setup_assembly(); }
     /// Get cumulative time for Pardiso calls in Setup phase.
     double GetTimeSetup_SolverCall() const { return m_timer_setup_solvercall(); }
+    /// Get cumulative time for symbolic analysis (ordering and symbolic factorization) in Setup phase.
+    /// This is a component of the time reported by GetTimeSetup_SolverCall.
+    double GetTimeSetup_Analysis() const { return m_timer_setup_analysis(); }
+    /// Get cumulative time for numeric factorization in Setup phase.
+    /// This is a component of the time reported by GetTimeSetup_SolverCall.
+    double GetTimeSetup_Factorization() const { return m_timer_setup_factorization(); }
 
     /// Return the number of calls to the solver's Setup function.
     unsigned int GetNumSetupCalls() const { return m_setup_call; }
     /// Return the number of calls to the solver's Setup function.
     unsigned int GetNumSolveCalls() const { return m_solve_call; }
+    /// Return the number of symbolic analyses performed during the Setup calls.
+    unsigned int GetNumAnalysisCalls() const { return m_analysis_call; }
 
     /// Get a handle to the underlying matrix.
     ChSparseMatrix& GetMatrix() { return m_mat; }
@@ -176,6 +194,12 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     virtual bool IsDirect() const override { return true; }
     virtual ChDirectSolverLS* AsDirect() override { return this; }
 
+    /// Perform the symbolic analysis (ordering and symbolic factorization) of the current sparse matrix.\n
+    /// This function is called only when the sparsity pattern of the matrix changed since the last analysis. A concrete
+    /// solver which overrides it must implement FactorizeMatrix as a numeric factorization only, reusing the results of
+    /// the last analysis. By default, no separate analysis is performed (FactorizeMatrix does both phases).
+    virtual bool AnalyzeMatrix() { return true; }
+
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() = 0;
 
@@ -198,25 +222,37 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     ChVectorDynamic<double> m_rhs;  ///< right-hand side vector
     ChVectorDynamic<double> m_sol;  ///< solution vector
 
-    unsigned int m_solve_call;  ///< counter for calls to Solve
-    unsigned int m_setup_call;  ///< counter for calls to Setup
+    unsigned int m_solve_call;     ///< counter for calls to Solve
+    unsigned int m_setup_call;     ///< counter for calls to Setup
+    unsigned int m_analysis_call;  ///< counter for symbolic analyses
 
     bool m_lock;          ///< is the matrix sparsity pattern locked?
     bool m_use_learner;   ///< use the sparsity pattern learner?
     bool m_force_update;  ///< force a call to the sparsity pattern learner?
+    bool m_use_map;       ///< use a cached assembly map if the pattern is locked?
+
+    ChSparseAssemblyMap m_map;  ///< cached assembly map
 
     bool m_use_perm;              ///< use of the permutation vector?
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection;  ///< enable detection of zero pivots?
 
-    ChTimer m_timer_setup_assembly;    ///< timer for matrix assembly
-    ChTimer m_timer_setup_solvercall;  ///< timer for factorization
-    ChTimer m_timer_solve_assembly;    ///< timer for RHS assembly
-    ChTimer m_timer_solve_solvercall;  ///< timer for solution
+    ChTimer m_timer_setup_assembly;       ///< timer for matrix assembly
+    ChTimer m_timer_setup_solvercall;     ///< timer for analysis and factorization
+    ChTimer m_timer_setup_analysis;       ///< timer for symbolic analysis
+    ChTimer m_timer_setup_factorization;  ///< timer for numeric factorization
+    ChTimer m_timer_solve_assembly;       ///< timer for RHS assembly
+    ChTimer m_timer_solve_solvercall;     ///< timer for solution
 
   private:
+    /// Analyze (if the sparsity pattern changed since the last analysis) and factorize the current matrix.
+    bool AnalyzeAndFactorize();
+
     void WriteMatrix(const std::string& filename, const ChSparseMatrix& M);
     void WriteVector(const std::string& filename, const ChVectorDynamic<double>& v);
+
+    bool m_analyzed;        ///< is there a valid symbolic analysis?
+    size_t m_pattern_hash;  ///< hash of the sparsity pattern at the last analysis
 };
 
 // ---------------------------------------------------------------------------
@@ -232,7 +268,10 @@ class ChApi ChSolverSparseLU : public ChDirectSolverLS {
     virtual Type GetType() const override { return Type::SPARSE_LU; }
 
   private:
-    /// Factorize the current sparse matrix and return true if successful.
+    /// Perform the symbolic analysis of the current sparse matrix and return true if successful.
+    virtual bool AnalyzeMatrix() override;
+
+    /// Numerically factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
     /// Solve the linear system using the current factorization and right-hand side vector.
@@ -257,7 +296,10 @@ class ChApi ChSolverSparseQR : public ChDirectSolverLS {
     virtual Type GetType() const override { return Type::SPARSE_QR; }
 
   private:
-    /// Factorize the current sparse matrix and return true if successful.
+    /// Perform the symbolic analysis of the current sparse matrix and return true if successful.
+    virtual bool AnalyzeMatrix() override;
+
+    /// Numerically factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
     /// Solve the linear system using the current factorization and right-hand side vector.
@@ -22,6 +22,7 @@ class ChSolver_Type_enum_mapper : public ChSolver {
   public:
     CH_ENUM_MAPPER_BEGIN(Type);
     CH_ENUM_VAL(Type::PSOR);
+    CH_ENUM_VAL(Type::PSOR_PARALLEL);
     CH_ENUM_VAL(Type::PSSOR);
     CH_ENUM_VAL(Type::PJACOBI);
     CH_ENUM_VAL(Type::PMINRES);
@@ -15,6 +15,7 @@
 #ifndef CH_SOLVER_H
 #define CH_SOLVER_H
 
+#include <algorithm>
 #include <vector>
 
 #include "chrono/solver/ChConstraint.h"
@@ -38,6 +39,7 @@ class ChApi ChSolver {
     enum class Type {
         // Iterative VI solvers
         PSOR,             ///< Projected SOR (Successive Over-Relaxation)
+        PSOR_PARALLEL,    ///< Projected SOR with multithreaded sweeps over independent constraint groups
         PSSOR,            ///< Projected symmetric SOR
         PJACOBI,          ///< Projected Jacobi
         PMINRES,          ///< Projected MINRES
@@ -94,6 +96,14 @@ class ChApi ChSolver {
     /// Set verbose output from solver.
     void SetVerbose(bool mv) { verbose = mv; }
 
+    /// Set the number of threads the solver is allowed to use (default: 1).
+    /// This value is set automatically by the owning ChSystem to num_threads_chrono (see ChSystem::SetNumThreads).
+    /// Solvers which do not support multithreading ignore this setting.
+    void SetNumThreads(int nthreads) { num_threads = std::max(1, nthreads); }
+
+    /// Return the number of threads the solver is allowed to use.
+    int GetNumThreads() const { return num_threads; }
+
     /// Enable/disable debug output of matrix, RHS, and solution vector.
     void EnableWrite(bool val, const std::string& frame, const std::string& out_dir = ".");
 
@@ -104,9 +114,10 @@ class ChApi ChSolver {
     virtual void ArchiveIn(ChArchiveIn& archive_in);
 
   protected:
-    ChSolver() : verbose(false) {}
+    ChSolver() : verbose(false), num_threads(1) {}
 
     bool verbose;
+    int num_threads;
     bool write_matrix;
     std::string output_dir;
     std::string frame_id;
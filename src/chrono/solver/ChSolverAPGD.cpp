@@ -82,6 +82,10 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
 
+    // If so requested, pack the constraint Jacobians in contiguous arrays (used in SchurComplementProduct)
+    if (sysd.UsePackedJacobians())
+        sysd.PackJacobians();
+
     double L, t;
     double theta;
     double thetaNew;
@@ -110,6 +114,7 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     // If no constraints, return now. Variables contain M^-1 * f after call to SchurBvectorCompute.
     // This early exit is needed, else we get division by zero and a potential infinite loop.
     if (nc == 0) {
+        sysd.ReleasePackedJacobians();
         return 0;
     }
 
@@ -246,6 +251,8 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
             mconstraints[ic]->IncrementState(mconstraints[ic]->GetLagrangeMultiplier());
     }
 
+    sysd.ReleasePackedJacobians();
+
     return residual;
 }
 
@@ -71,6 +71,10 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
 
+    // If so requested, pack the constraint Jacobians in contiguous arrays (used in SchurComplementProduct)
+    if (sysd.UsePackedJacobians())
+        sysd.PackJacobians();
+
     // Average all g_i for the triplet of contact constraints n,u,v.
     //  Can be used for the fixed point phase and/or by preconditioner.
     int j_friction_comp = 0;
@@ -341,6 +345,8 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
             mconstraints[ic]->IncrementState(mconstraints[ic]->GetLagrangeMultiplier());
     }
 
+    sysd.ReleasePackedJacobians();
+
     if (verbose)
         std::cout << "-----" << std::endl;
 
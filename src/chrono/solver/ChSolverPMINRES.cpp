@@ -59,6 +59,10 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
 
+    // If so requested, pack the constraint Jacobians in contiguous arrays (used in SchurComplementProduct)
+    if (sysd.UsePackedJacobians())
+        sysd.PackJacobians();
+
     // Average all g_i for the triplet of contact constraints n,u,v.
     //  Can be used as diagonal preconditioner.
     int j_friction_comp = 0;
@@ -273,6 +277,8 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
             mconstraints[ic]->IncrementState(mconstraints[ic]->GetLagrangeMultiplier());
     }
 
+    sysd.ReleasePackedJacobians();
+
     if (verbose)
         std::cout << "-----" << std::endl;
 
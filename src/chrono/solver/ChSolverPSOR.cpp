@@ -63,13 +63,28 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
             mvariables[iv]->ComputeMassInverseTimesVector(mvariables[iv]->State(), mvariables[iv]->Force());  // q = [M]'*fb
     }
 
+    // If so requested, pack the constraint Jacobians and the state of the variables in contiguous arrays,
+    // and perform all following operations on the packed data.
+    const bool packed = sysd.UsePackedJacobians() && sysd.PackJacobians();
+
+    auto jacobian_times_state = [&](ChConstraint* constr) {
+        return packed ? sysd.PackedJacobianTimesState(constr->GetOffset()) : constr->ComputeJacobianTimesState();
+    };
+
+    auto increment_state = [&](ChConstraint* constr, double deltal) {
+        if (packed)
+            sysd.PackedIncrementState(constr->GetOffset(), deltal);
+        else
+            constr->IncrementState(deltal);
+    };
+
     // 3)  For all items with variables, add the effect of initial (guessed)
     //     lagrangian reactions of constraints, if a warm start is desired.
     //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
     if (m_warm_start) {
         for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
             if (mconstraints[ic]->IsActive())
-                mconstraints[ic]->IncrementState(mconstraints[ic]->GetLagrangeMultiplier());
+                increment_state(mconstraints[ic], mconstraints[ic]->GetLagrangeMultiplier());
     } else {
         for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
             mconstraints[ic]->SetLagrangeMultiplier(0.);
@@ -90,7 +105,7 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
             // skip computations if constraint not active.
             if (mconstraints[ic]->IsActive()) {
                 // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
-                double mresidual = mconstraints[ic]->ComputeJacobianTimesState() + mconstraints[ic]->GetRightHandSide() +
+                double mresidual = jacobian_times_state(mconstraints[ic]) + mconstraints[ic]->GetRightHandSide() +
                                    mconstraints[ic]->GetComplianceTerm() * mconstraints[ic]->GetLagrangeMultiplier();
 
                 // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
@@ -127,9 +142,9 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
                         double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
                         double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
                         double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
-                        mconstraints[ic - 2]->IncrementState(true_delta_0);
-                        mconstraints[ic - 1]->IncrementState(true_delta_1);
-                        mconstraints[ic - 0]->IncrementState(true_delta_2);
+                        increment_state(mconstraints[ic - 2], true_delta_0);
+                        increment_state(mconstraints[ic - 1], true_delta_1);
+                        increment_state(mconstraints[ic - 0], true_delta_2);
 
                         if (this->record_violation_history) {
                             maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_0));
@@ -152,7 +167,7 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
                     }
 
                     double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
-                    mconstraints[ic]->IncrementState(true_delta_0);
+                    increment_state(mconstraints[ic], true_delta_0);
 
                     if (this->record_violation_history) {
                         maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_0));
@@ -180,7 +195,7 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
 
                     // For all items with variables, add the effect of incremented
                     // (and projected) lagrangian reactions:
-                    mconstraints[ic]->IncrementState(true_delta);
+                    increment_state(mconstraints[ic], true_delta);
 
                     if (this->record_violation_history)
                         maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta));
@@ -204,6 +219,11 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
 
     }  // end iteration loop
 
+    if (packed) {
+        sysd.UnpackState();
+        sysd.ReleasePackedJacobians();
+    }
+
     return maxviolation;
 }
 
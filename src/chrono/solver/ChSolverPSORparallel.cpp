@@ -0,0 +1,284 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <cstdint>
+
+#include "chrono/solver/ChSolverPSORparallel.h"
+#include "chrono/utils/ChOpenMP.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverPSORparallel)
+CH_UPCASTING(ChSolverPSORparallel, ChIterativeSolverVI)
+
+// Maximum number of colors. Blocks which cannot be assigned one of these colors are processed serially.
+static const unsigned int max_colors = 64;
+
+ChSolverPSORparallel::ChSolverPSORparallel() : maxviolation(0), m_num_colors(0) {}
+
+void ChSolverPSORparallel::ColorBlocks(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
+    const unsigned int nConstr = (unsigned int)mconstraints.size();
+
+    // Partition the constraints in blocks, keeping together the N,U,V components of friction contacts
+    m_blocks.clear();
+    for (unsigned int ic = 0; ic < nConstr;) {
+        if (ic + 2 < nConstr && mconstraints[ic]->GetMode() == ChConstraint::Mode::FRICTION &&
+            mconstraints[ic + 1]->GetMode() == ChConstraint::Mode::FRICTION &&
+            mconstraints[ic + 2]->GetMode() == ChConstraint::Mode::FRICTION) {
+            m_blocks.push_back({ic, 3});
+            ic += 3;
+        } else {
+            m_blocks.push_back({ic, 1});
+            ic++;
+        }
+    }
+    const unsigned int nBlocks = (unsigned int)m_blocks.size();
+
+    // Greedy coloring of the blocks. Each active variable keeps a bit mask of the colors already used by blocks acting
+    // on it (indexed by the variable offset in the global state vector). Inactive variables are not modified by the
+    // solver and therefore do not couple blocks.
+    std::vector<uint64_t> var_colors(sysd.CountActiveVariables(), 0);
+    std::vector<unsigned int> block_color(nBlocks);
+    std::vector<unsigned int> color_count(max_colors + 1, 0);
+    std::vector<ChVariables*> vars;
+
+    for (unsigned int ib = 0; ib < nBlocks; ib++) {
+        const Block& block = m_blocks[ib];
+
+        vars.clear();
+        bool known = block.size == 3 || mconstraints[block.first]->GetMode() != ChConstraint::Mode::FRICTION;
+        for (unsigned int k = 0; k < block.size && known; k++)
+            known = mconstraints[block.first + k]->CollectVariables(vars);
+
+        unsigned int color = max_colors;
+        if (known) {
+            uint64_t used = 0;
+            for (auto var : vars) {
+                if (var && var->IsActive())
+                    used |= var_colors[var->GetOffset()];
+            }
+            if (~used) {
+                color = 0;
+                while (used & (uint64_t(1) << color))
+                    color++;
+                for (auto var : vars) {
+                    if (var && var->IsActive())
+                        var_colors[var->GetOffset()] |= (uint64_t(1) << color);
+                }
+            }
+        }
+
+        block_color[ib] = color;
+        color_count[color]++;
+    }
+
+    // First-fit coloring uses consecutive colors, starting at 0.
+    // Sort the blocks by color (counting sort), with the serial set last.
+    m_num_colors = 0;
+    while (m_num_colors < max_colors && color_count[m_num_colors] > 0)
+        m_num_colors++;
+
+    m_color_offsets.assign(m_num_colors + 2, 0);
+    for (unsigned int c = 0; c < m_num_colors; c++)
+        m_color_offsets[c + 1] = m_color_offsets[c] + color_count[c];
+    m_color_offsets[m_num_colors + 1] = m_color_offsets[m_num_colors] + color_count[max_colors];
+
+    std::vector<unsigned int> pos(m_color_offsets.begin(), m_color_offsets.end() - 1);
+    m_color_blocks.resize(nBlocks);
+    for (unsigned int ib = 0; ib < nBlocks; ib++) {
+        unsigned int slot = (block_color[ib] == max_colors) ? m_num_colors : block_color[ib];
+        m_color_blocks[pos[slot]++] = ib;
+    }
+}
+
+double ChSolverPSORparallel::UpdateBlock(std::vector<ChConstraint*>& constraints,
+                                         const Block& block,
+                                         double& maxdeltalambda) {
+    ChConstraint** mconstr = &constraints[block.first];
+
+    // skip computations if constraint not active.
+    for (unsigned int k = 0; k < block.size; k++) {
+        if (!mconstr[k]->IsActive())
+            return 0;
+    }
+
+    double old_lambda[3];
+    double violation = 0;
+
+    for (unsigned int k = 0; k < block.size; k++) {
+        // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+        double mresidual = mconstr[k]->ComputeJacobianTimesState() + mconstr[k]->GetRightHandSide() +
+                           mconstr[k]->GetComplianceTerm() * mconstr[k]->GetLagrangeMultiplier();
+
+        // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+        double deltal = (m_omega / mconstr[k]->GetSchurComplement()) * (-mresidual);
+
+        // update:   lambda += delta_lambda;
+        old_lambda[k] = mconstr[k]->GetLagrangeMultiplier();
+        mconstr[k]->SetLagrangeMultiplier(old_lambda[k] + deltal);
+
+        // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+        if (k == 0) {
+            if (block.size == 3 || mconstr[0]->GetMode() == ChConstraint::Mode::UNILATERAL)
+                violation = fabs(std::min(0.0, mresidual));
+            else
+                violation = fabs(mconstr[0]->Violation(mresidual));
+        }
+    }
+
+    // If new lagrangian multipliers do not satisfy inequalities, project them onto the admissible set
+    // (for a friction triplet, the N normal component will take care of N,U,V)
+    mconstr[0]->Project();
+
+    for (unsigned int k = 0; k < block.size; k++) {
+        double new_lambda = mconstr[k]->GetLagrangeMultiplier();
+
+        // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+        if (m_shlambda != 1.0) {
+            new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda[k];
+            mconstr[k]->SetLagrangeMultiplier(new_lambda);
+        }
+
+        // For all items with variables, add the effect of incremented (and projected) lagrangian reactions
+        double true_delta = new_lambda - old_lambda[k];
+        mconstr[k]->IncrementState(true_delta);
+
+        if (this->record_violation_history)
+            maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta));
+    }
+
+    return violation;
+}
+
+double ChSolverPSORparallel::Solve(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariables();
+    const int nConstr = (int)mconstraints.size();
+    const int nVars = (int)mvariables.size();
+    const int nthreads = num_threads;
+
+    m_iterations = 0;
+    maxviolation = 0;
+    double maxdeltalambda = 0.;
+
+    // 0)  Partition the constraints in blocks and color the blocks such that all blocks of a given color can be
+    //     processed concurrently.
+    ColorBlocks(sysd);
+    const int nBlocks = (int)m_blocks.size();
+
+    // 1)  Update auxiliary data in all constraints before starting,
+    //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
+#pragma omp parallel for num_threads(nthreads)
+    for (int ic = 0; ic < nConstr; ic++)
+        mconstraints[ic]->Update_auxiliary();
+
+    // Average all g_i for the triplet of contact constraints n,u,v.
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < nBlocks; ib++) {
+        const Block& block = m_blocks[ib];
+        if (block.size == 3) {
+            double average_g_i = (mconstraints[block.first + 0]->GetSchurComplement() +
+                                  mconstraints[block.first + 1]->GetSchurComplement() +
+                                  mconstraints[block.first + 2]->GetSchurComplement()) /
+                                 3.0;
+            mconstraints[block.first + 0]->SetSchurComplement(average_g_i);
+            mconstraints[block.first + 1]->SetSchurComplement(average_g_i);
+            mconstraints[block.first + 2]->SetSchurComplement(average_g_i);
+        }
+    }
+
+    // 2)  Compute, for all items with variables, the initial guess for
+    //     still unconstrained system:
+#pragma omp parallel for num_threads(nthreads)
+    for (int iv = 0; iv < nVars; iv++) {
+        if (mvariables[iv]->IsActive())
+            mvariables[iv]->ComputeMassInverseTimesVector(mvariables[iv]->State(), mvariables[iv]->Force());  // q = [M]'*fb
+    }
+
+    // 3)  For all items with variables, add the effect of initial (guessed)
+    //     lagrangian reactions of constraints, if a warm start is desired.
+    //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
+    if (m_warm_start) {
+        for (unsigned int c = 0; c <= m_num_colors; c++) {
+            const int start = (int)m_color_offsets[c];
+            const int end = (int)m_color_offsets[c + 1];
+            const int nt = (c < m_num_colors) ? nthreads : 1;
+#pragma omp parallel for num_threads(nt)
+            for (int i = start; i < end; i++) {
+                const Block& block = m_blocks[m_color_blocks[i]];
+                for (unsigned int k = 0; k < block.size; k++) {
+                    ChConstraint* constr = mconstraints[block.first + k];
+                    if (constr->IsActive())
+                        constr->IncrementState(constr->GetLagrangeMultiplier());
+                }
+            }
+        }
+    } else {
+#pragma omp parallel for num_threads(nthreads)
+        for (int ic = 0; ic < nConstr; ic++)
+            mconstraints[ic]->SetLagrangeMultiplier(0.);
+    }
+
+    // 4)  Perform the iteration loops
+    //
+    std::vector<double> thread_violation(nthreads);
+    std::vector<double> thread_deltalambda(nthreads);
+
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        std::fill(thread_violation.begin(), thread_violation.end(), 0.0);
+        std::fill(thread_deltalambda.begin(), thread_deltalambda.end(), 0.0);
+
+        // Sweep the colors in sequence; blocks of the same color are independent and processed concurrently.
+        // The last set contains the blocks which could not be colored and is processed serially.
+        for (unsigned int c = 0; c <= m_num_colors; c++) {
+            const int start = (int)m_color_offsets[c];
+            const int end = (int)m_color_offsets[c + 1];
+            const int nt = (c < m_num_colors) ? nthreads : 1;
+
+#pragma omp parallel num_threads(nt)
+            {
+                int tid = ChOMP::GetThreadNum();
+                double violation = 0;
+                double deltalambda = 0;
+#pragma omp for
+                for (int i = start; i < end; i++) {
+                    double candidate_violation = UpdateBlock(mconstraints, m_blocks[m_color_blocks[i]], deltalambda);
+                    violation = std::max(violation, candidate_violation);
+                }
+                thread_violation[tid] = std::max(thread_violation[tid], violation);
+                thread_deltalambda[tid] = std::max(thread_deltalambda[tid], deltalambda);
+            }
+        }
+
+        maxviolation = *std::max_element(thread_violation.begin(), thread_violation.end());
+        maxdeltalambda = *std::max_element(thread_deltalambda.begin(), thread_deltalambda.end());
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < m_tolerance)
+            break;
+
+    }  // end iteration loop
+
+    return maxviolation;
+}
+
+}  // end namespace chrono
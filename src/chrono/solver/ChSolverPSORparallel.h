@@ -0,0 +1,81 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHSOLVER_PSOR_PARALLEL_H
+#define CHSOLVER_PSOR_PARALLEL_H
+
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// A multithreaded variant of the projected SOR solver (see ChSolverPSOR).\n
+/// At each solve, the constraints are partitioned in blocks (a friction contact triplet N,U,V forms one block, any
+/// other constraint is a block by itself) and the blocks are colored so that no two blocks with the same color act on
+/// a common active ChVariables object. The SOR sweep then processes the colors in sequence and all blocks of a given
+/// color concurrently. Constraints which do not report their variables (see ChConstraint::CollectVariables) are
+/// processed serially at the end of each sweep.\n
+/// The number of threads is set through ChSolver::SetNumThreads (done automatically by ChSystem::SetNumThreads).
+/// For a given problem, the results do not depend on the number of threads.\n
+/// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
+/// solver.
+class ChApi ChSolverPSORparallel : public ChIterativeSolverVI {
+  public:
+    ChSolverPSORparallel();
+
+    ~ChSolverPSORparallel() {}
+
+    virtual Type GetType() const override { return Type::PSOR_PARALLEL; }
+
+    /// Performs the solution of the problem.
+    /// \return  the maximum constraint violation after termination.
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+    /// Return the tolerance error reached during the last solve.
+    /// For the PSOR solver, this is the maximum constraint violation.
+    virtual double GetError() const override { return maxviolation; }
+
+    /// Return the number of colors (sets of mutually independent constraint blocks) used during the last solve.
+    unsigned int GetNumColors() const { return m_num_colors; }
+
+  private:
+    /// Group of constraints updated together (a friction triplet or a single constraint).
+    struct Block {
+        unsigned int first;  ///< index of the first constraint in the block
+        unsigned int size;   ///< number of constraints in the block (1 or 3)
+    };
+
+    /// Partition the constraints in blocks and color the blocks.
+    void ColorBlocks(ChSystemDescriptor& sysd);
+
+    /// Perform one projected SOR update on the specified block.
+    /// Return the constraint violation and update the maximum change in Lagrange multipliers.
+    double UpdateBlock(std::vector<ChConstraint*>& constraints, const Block& block, double& maxdeltalambda);
+
+    double maxviolation;
+
+    std::vector<Block> m_blocks;                ///< constraint blocks
+    std::vector<unsigned int> m_color_offsets;  ///< start of each color in m_color_blocks (last is the serial set)
+    std::vector<unsigned int> m_color_blocks;   ///< block indices, sorted by color
+    unsigned int m_num_colors;                  ///< number of colors (excluding the serial set)
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,88 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_SPARSE_ASSEMBLY_MAP_H
+#define CH_SPARSE_ASSEMBLY_MAP_H
+
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+class ChVariables;
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Cached assembly plan for the system matrix of a ChSystemDescriptor.\n
+/// When the structure of the problem and the sparsity pattern of the (compressed) system matrix do not change from
+/// call to call, the position in the CSR value array of every element pasted during assembly is also unchanged. An
+/// assembly map records these positions once (see ChSystemDescriptor::BuildSystemMatrixMap) so that subsequent
+/// assemblies (see ChSystemDescriptor::BuildSystemMatrix) write directly into the matrix value array, without any
+/// index search, processing the variables, KRM blocks and constraints in parallel.\n
+/// Before each reuse, the map is checked against the structure of the current problem: the same variables, KRM blocks
+/// and constraints, at the same offsets and referencing the same variables, must be present; otherwise the map is
+/// invalidated.\n
+/// The results are identical to those obtained with the default assembly, regardless of the number of threads.
+class ChApi ChSparseAssemblyMap {
+  public:
+    ChSparseAssemblyMap() : m_valid(false) {}
+
+    /// Return true if the map was recorded and was not invalidated since.
+    bool IsValid() const { return m_valid; }
+
+    /// Invalidate the map (forcing a new recording).
+    void Invalidate() { m_valid = false; }
+
+    /// Return the number of recorded matrix element writes.
+    size_t GetNumEntries() const { return m_index.size(); }
+
+  private:
+    bool m_valid;
+
+    // Problem structure for which the map was recorded
+    size_t m_num_vars;    ///< number of active variables objects
+    size_t m_num_krm;     ///< number of KRM blocks
+    size_t m_num_constr;  ///< number of active constraints
+    unsigned int m_n_q;   ///< number of active DOFs
+    unsigned int m_n_c;   ///< number of active constraints
+    long long m_nnz;      ///< number of nonzeros in the compressed matrix
+
+    // Structural signature (addresses and offsets of the variables, KRM blocks and constraints, in assembly order)
+    std::vector<const void*> m_sig_ptr;     ///< recorded item addresses
+    std::vector<unsigned int> m_sig_off;    ///< recorded item offsets
+    std::vector<const void*> m_check_ptr;   ///< item addresses of the current problem
+    std::vector<unsigned int> m_check_off;  ///< item offsets of the current problem
+    std::vector<ChVariables*> m_sig_vars;   ///< scratch list of the variables of a constraint
+
+    // Write sequence
+    std::vector<int> m_index;          ///< position in the CSR value array of each write, in assembly order
+    std::vector<char> m_overwrite;     ///< overwrite (or accumulate) flag of each write
+    std::vector<size_t> m_item_start;  ///< first write of each item (variables, KRM blocks, Cq rows, Cq' cols, E)
+
+    // Inverse map (writes contributing to each nonzero, in assembly order)
+    std::vector<int> m_nz_start;   ///< start of the writes to each nonzero in m_nz_writes (size nnz+1)
+    std::vector<int> m_nz_writes;  ///< write indices, grouped by nonzero
+
+    std::vector<double> m_values;  ///< staging array for the written values
+
+    friend class ChSystemDescriptor;
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
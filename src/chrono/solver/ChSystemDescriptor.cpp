@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <iomanip>
 
 #include "chrono/solver/ChSystemDescriptor.h"
@@ -27,7 +28,8 @@ CH_FACTORY_REGISTER(ChSystemDescriptor)
 
 #define CH_SPINLOCK_HASHSIZE 203
 
-ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false) {
+ChSystemDescriptor::ChSystemDescriptor()
+    : n_q(0), n_c(0), c_a(1.0), freeze_count(false), m_use_packed(false), m_packed_valid(false) {
     m_constraints.clear();
     m_variables.clear();
     m_KRMblocks.clear();
@@ -181,6 +183,275 @@ void ChSystemDescriptor::BuildSystemMatrix(ChSparseMatrix* Z, ChVectorDynamic<>*
     }
 }
 
+// Sparse matrix proxy used when recording an assembly map. Each element write is located in the CSR arrays of the
+// target (compressed) matrix and its position is appended to the map.
+class ChSparseMapRecorder : public ChSparseMatrix {
+  public:
+    ChSparseMapRecorder(const ChSparseMatrix& target, std::vector<int>& index, std::vector<char>& overwrite)
+        : m_target(target), m_index(index), m_overwrite(overwrite), m_missing(false) {}
+
+    virtual void SetElement(int row, int col, double el, bool overwrite = true) override {
+        if (row < 0 || row >= m_target.rows()) {
+            m_missing = true;
+            return;
+        }
+        const int* inner = m_target.innerIndexPtr();
+        const int* first = inner + m_target.outerIndexPtr()[row];
+        const int* last = inner + m_target.outerIndexPtr()[row + 1];
+        const int* pos = std::lower_bound(first, last, col);
+        if (pos == last || *pos != col) {
+            m_missing = true;
+            return;
+        }
+        m_index.push_back((int)(pos - inner));
+        m_overwrite.push_back(overwrite);
+    }
+
+    bool Missing() const { return m_missing; }
+
+  private:
+    const ChSparseMatrix& m_target;
+    std::vector<int>& m_index;
+    std::vector<char>& m_overwrite;
+    bool m_missing;
+};
+
+// Sparse matrix proxy used when assembling with an assembly map. Element values are streamed, in order, into the
+// segment of the staging array reserved for the current item.
+class ChSparseMapWriter : public ChSparseMatrix {
+  public:
+    ChSparseMapWriter(double* values) : m_values(values), m_next(0), m_end(0), m_overflow(false) {}
+
+    void Rewind(size_t start, size_t end) {
+        m_next = start;
+        m_end = end;
+    }
+
+    bool Done() const { return !m_overflow && m_next == m_end; }
+
+    virtual void SetElement(int row, int col, double el, bool overwrite = true) override {
+        if (m_next < m_end)
+            m_values[m_next++] = el;
+        else
+            m_overflow = true;
+    }
+
+  private:
+    double* m_values;
+    size_t m_next;
+    size_t m_end;
+    bool m_overflow;
+};
+
+// Paste the contribution of the i-th assembly item into Z. The items are, in order: the active variables (mass), the
+// KRM blocks, the active constraints (Cq rows), the active constraints (Cq' columns), and the active constraints
+// (compliance). This is the same sequence of writes as in BuildSystemMatrix.
+static void PasteAssemblyItem(ChSparseMatrix& Z,
+                              size_t i,
+                              const std::vector<ChVariables*>& vars,
+                              const std::vector<ChKRMBlock*>& krm,
+                              const std::vector<ChConstraint*>& constr,
+                              unsigned int n_q,
+                              double c_a) {
+    const size_t nv = vars.size();
+    const size_t nk = krm.size();
+    const size_t nc = constr.size();
+
+    if (i < nv) {
+        vars[i]->PasteMassInto(Z, 0, 0, c_a);
+        return;
+    }
+    i -= nv;
+    if (i < nk) {
+        krm[i]->PasteMatrixInto(Z, 0, 0, false);
+        return;
+    }
+    i -= nk;
+    if (i < nc) {
+        constr[i]->PasteJacobianInto(Z, n_q + constr[i]->GetOffset(), 0);
+        return;
+    }
+    i -= nc;
+    if (i < nc) {
+        constr[i]->PasteJacobianTransposedInto(Z, 0, n_q + constr[i]->GetOffset());
+        return;
+    }
+    i -= nc;
+    Z.SetElement(n_q + constr[i]->GetOffset(), n_q + constr[i]->GetOffset(), constr[i]->GetComplianceTerm());
+}
+
+// Structural signature of the assembly items: address and offset of each active variables object, followed by the
+// address and offset of each KRM block variables object, and the address and offset of each active constraint
+// together with the addresses and offsets of the variables it references. Problems with the same signature paste the
+// same blocks at the same locations. Return false if the variables of a constraint cannot be determined.
+static bool AssemblySignature(const std::vector<ChVariables*>& vars,
+                              const std::vector<ChKRMBlock*>& krm,
+                              const std::vector<ChConstraint*>& constr,
+                              std::vector<const void*>& ptr,
+                              std::vector<unsigned int>& off,
+                              std::vector<ChVariables*>& scratch) {
+    ptr.clear();
+    off.clear();
+    for (const auto& var : vars) {
+        ptr.push_back(var);
+        off.push_back(var->GetOffset());
+    }
+    for (const auto& block : krm) {
+        for (size_t m = 0; m < block->GetNumVariables(); m++) {
+            ptr.push_back(block->GetVariable((unsigned int)m));
+            off.push_back(block->GetVariable((unsigned int)m)->GetOffset());
+        }
+    }
+    for (const auto& c : constr) {
+        ptr.push_back(c);
+        off.push_back(c->GetOffset());
+        scratch.clear();
+        if (!c->CollectVariables(scratch))
+            return false;
+        for (const auto& var : scratch) {
+            ptr.push_back(var);
+            off.push_back(var->GetOffset());
+        }
+    }
+    return true;
+}
+
+bool ChSystemDescriptor::BuildSystemMatrixMap(const ChSparseMatrix& Z, ChSparseAssemblyMap& map) const {
+    map.m_valid = false;
+
+    n_q = CountActiveVariables();
+    n_c = CountActiveConstraints();
+
+    if (!Z.isCompressed() || Z.rows() != n_q + n_c || Z.cols() != n_q + n_c)
+        return false;
+
+    std::vector<ChVariables*> vars;
+    for (const auto& var : m_variables) {
+        if (var->IsActive())
+            vars.push_back(var);
+    }
+    std::vector<ChConstraint*> constr;
+    for (const auto& c : m_constraints) {
+        if (c->IsActive())
+            constr.push_back(c);
+    }
+
+    // Record the structure of the problem
+    if (!AssemblySignature(vars, m_KRMblocks, constr, map.m_sig_ptr, map.m_sig_off, map.m_sig_vars))
+        return false;
+
+    // Record the sequence of element writes, item by item
+    const size_t nitems = vars.size() + m_KRMblocks.size() + 3 * constr.size();
+    map.m_index.clear();
+    map.m_overwrite.clear();
+    map.m_item_start.resize(nitems + 1);
+
+    ChSparseMapRecorder recorder(Z, map.m_index, map.m_overwrite);
+    for (size_t i = 0; i < nitems; i++) {
+        map.m_item_start[i] = map.m_index.size();
+        PasteAssemblyItem(recorder, i, vars, m_KRMblocks, constr, n_q, c_a);
+    }
+    map.m_item_start[nitems] = map.m_index.size();
+
+    if (recorder.Missing())
+        return false;
+
+    // Build the inverse map (counting sort of the writes by nonzero position, preserving the assembly order)
+    const int nnz = (int)Z.nonZeros();
+    const int nwrites = (int)map.m_index.size();
+    map.m_nz_start.assign(nnz + 1, 0);
+    for (int k = 0; k < nwrites; k++)
+        map.m_nz_start[map.m_index[k] + 1]++;
+    for (int j = 0; j < nnz; j++)
+        map.m_nz_start[j + 1] += map.m_nz_start[j];
+
+    std::vector<int> pos(map.m_nz_start.begin(), map.m_nz_start.end() - 1);
+    map.m_nz_writes.resize(nwrites);
+    for (int k = 0; k < nwrites; k++)
+        map.m_nz_writes[pos[map.m_index[k]]++] = k;
+
+    map.m_values.resize(nwrites);
+
+    map.m_num_vars = vars.size();
+    map.m_num_krm = m_KRMblocks.size();
+    map.m_num_constr = constr.size();
+    map.m_n_q = n_q;
+    map.m_n_c = n_c;
+    map.m_nnz = nnz;
+    map.m_valid = true;
+
+    return true;
+}
+
+bool ChSystemDescriptor::BuildSystemMatrix(ChSparseMatrix& Z, ChSparseAssemblyMap& map, int nthreads) const {
+    if (!map.m_valid)
+        return false;
+
+    n_q = CountActiveVariables();
+    n_c = CountActiveConstraints();
+
+    std::vector<ChVariables*> vars;
+    for (const auto& var : m_variables) {
+        if (var->IsActive())
+            vars.push_back(var);
+    }
+    std::vector<ChConstraint*> constr;
+    for (const auto& c : m_constraints) {
+        if (c->IsActive())
+            constr.push_back(c);
+    }
+
+    if (vars.size() != map.m_num_vars || m_KRMblocks.size() != map.m_num_krm || constr.size() != map.m_num_constr ||
+        n_q != map.m_n_q || n_c != map.m_n_c || !Z.isCompressed() || Z.rows() != n_q + n_c ||
+        Z.cols() != n_q + n_c || Z.nonZeros() != map.m_nnz) {
+        map.m_valid = false;
+        return false;
+    }
+
+    // Check that the variables, KRM blocks and constraints are the same as when recording, at the same offsets
+    if (!AssemblySignature(vars, m_KRMblocks, constr, map.m_check_ptr, map.m_check_off, map.m_sig_vars) ||
+        map.m_check_ptr != map.m_sig_ptr || map.m_check_off != map.m_sig_off) {
+        map.m_valid = false;
+        return false;
+    }
+
+    // 1) Stream the element values of all items into the staging array (each item has its own segment)
+    const int nitems = (int)map.m_item_start.size() - 1;
+    bool mismatch = false;
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        ChSparseMapWriter writer(map.m_values.data());
+#pragma omp for schedule(dynamic, 64) reduction(|| : mismatch)
+        for (int i = 0; i < nitems; i++) {
+            writer.Rewind(map.m_item_start[i], map.m_item_start[i + 1]);
+            PasteAssemblyItem(writer, i, vars, m_KRMblocks, constr, n_q, c_a);
+            mismatch = mismatch || !writer.Done();
+        }
+    }
+
+    if (mismatch) {
+        map.m_valid = false;
+        return false;
+    }
+
+    // 2) Reduce the staged values into the CSR value array, in assembly order
+    double* values = Z.valuePtr();
+    const int nnz = (int)map.m_nnz;
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < nnz; j++) {
+        double v = 0;
+        for (int p = map.m_nz_start[j]; p < map.m_nz_start[j + 1]; p++) {
+            int k = map.m_nz_writes[p];
+            v = map.m_overwrite[k] ? map.m_values[k] : v + map.m_values[k];
+        }
+        values[j] = v;
+    }
+
+    return true;
+}
+
 unsigned int ChSystemDescriptor::BuildFbVector(ChVectorDynamic<>& Fvector, unsigned int start_row) const {
     n_q = CountActiveVariables();
     Fvector.setZero(n_q);
@@ -369,6 +640,111 @@ unsigned int ChSystemDescriptor::FromVectorToUnknowns(const ChVectorDynamic<>& m
     return n_q + n_c;
 }
 
+bool ChSystemDescriptor::PackJacobians() {
+    m_packed_valid = false;
+
+    n_q = CountActiveVariables();
+    n_c = CountActiveConstraints();
+
+    m_packed_row_start.resize(n_c + 1);
+    m_packed_chunk_off.clear();
+    m_packed_chunk_size.clear();
+    m_packed_chunk_start.clear();
+    m_packed_Cq.clear();
+    m_packed_Eq.clear();
+    m_packed_cfm.resize(n_c);
+
+    for (const auto& constr : m_constraints) {
+        if (!constr->IsActive())
+            continue;
+
+        // Append the Jacobian values directly to the packed arrays
+        size_t start = m_packed_Cq.size();
+        m_packed_vars.clear();
+        if (!constr->CollectVariables(m_packed_vars) || !constr->PackJacobian(m_packed_Cq, m_packed_Eq)) {
+            m_packed_Cq.clear();
+            m_packed_Eq.clear();
+            return false;
+        }
+
+        // Keep only the chunks of active variables (the others are not modified by the solver), compacting the
+        // packed values in place
+        unsigned int row = constr->GetOffset();
+        m_packed_row_start[row] = (unsigned int)m_packed_chunk_off.size();
+        size_t src = start;
+        size_t dst = start;
+        for (const auto& var : m_packed_vars) {
+            unsigned int dof = var->GetDOF();
+            if (var->IsActive()) {
+                if (dst != src) {
+                    std::copy(m_packed_Cq.begin() + src, m_packed_Cq.begin() + src + dof, m_packed_Cq.begin() + dst);
+                    std::copy(m_packed_Eq.begin() + src, m_packed_Eq.begin() + src + dof, m_packed_Eq.begin() + dst);
+                }
+                m_packed_chunk_off.push_back(var->GetOffset());
+                m_packed_chunk_size.push_back(dof);
+                m_packed_chunk_start.push_back((unsigned int)dst);
+                dst += dof;
+            }
+            src += dof;
+        }
+        m_packed_Cq.resize(dst);
+        m_packed_Eq.resize(dst);
+
+        m_packed_cfm(row) = constr->GetComplianceTerm();
+    }
+    m_packed_row_start[n_c] = (unsigned int)m_packed_chunk_off.size();
+
+    FromVariablesToVector(m_packed_q, true);
+
+    m_packed_valid = true;
+    return true;
+}
+
+double ChSystemDescriptor::PackedJacobianTimesState(unsigned int row) const {
+    double result = 0;
+    for (unsigned int j = m_packed_row_start[row]; j < m_packed_row_start[row + 1]; j++) {
+        const double* Cq = &m_packed_Cq[m_packed_chunk_start[j]];
+        unsigned int off = m_packed_chunk_off[j];
+        unsigned int size = m_packed_chunk_size[j];
+        // Use fixed-size products for the common cases of rigid bodies and 3-DOF nodes
+        switch (size) {
+            case 6:
+                result += Eigen::Map<const ChVectorN<double, 6>>(Cq).dot(m_packed_q.segment<6>(off));
+                break;
+            case 3:
+                result += Eigen::Map<const ChVectorN<double, 3>>(Cq).dot(m_packed_q.segment<3>(off));
+                break;
+            default:
+                result += Eigen::Map<const ChVectorDynamic<>>(Cq, size).dot(m_packed_q.segment(off, size));
+                break;
+        }
+    }
+    return result;
+}
+
+void ChSystemDescriptor::PackedIncrementState(unsigned int row, double deltal) {
+    for (unsigned int j = m_packed_row_start[row]; j < m_packed_row_start[row + 1]; j++) {
+        const double* Eq = &m_packed_Eq[m_packed_chunk_start[j]];
+        unsigned int off = m_packed_chunk_off[j];
+        unsigned int size = m_packed_chunk_size[j];
+        switch (size) {
+            case 6:
+                m_packed_q.segment<6>(off) += deltal * Eigen::Map<const ChVectorN<double, 6>>(Eq);
+                break;
+            case 3:
+                m_packed_q.segment<3>(off) += deltal * Eigen::Map<const ChVectorN<double, 3>>(Eq);
+                break;
+            default:
+                m_packed_q.segment(off, size) += deltal * Eigen::Map<const ChVectorDynamic<>>(Eq, size);
+                break;
+        }
+    }
+}
+
+void ChSystemDescriptor::UnpackState() {
+    FromVectorToVariables(m_packed_q);
+}
+
 void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
                                                 const ChVectorDynamic<>& lvector,
                                                 std::vector<bool>* enabled) {
@@ -378,6 +754,22 @@ void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
 
     result.setZero(n_c);
 
+    // With packed Jacobians, perform the same operations on the packed data and packed state
+    if (m_packed_valid) {
+        m_packed_q.setZero(n_q);
+        for (unsigned int row = 0; row < n_c; row++) {
+            if ((!enabled) || (*enabled)[row]) {
+                PackedIncrementState(row, lvector(row));
+                result(row) = m_packed_cfm(row) * lvector(row);
+            }
+        }
+        for (unsigned int row = 0; row < n_c; row++) {
+            if ((!enabled) || (*enabled)[row])
+                result(row) += PackedJacobianTimesState(row);
+        }
+        return;
+    }
+
     // Performs the sparse product    result = [N]*l = [ [Cq][M^(-1)][Cq'] - [E] ] *l
     // in different phases:
 
@@ -19,6 +19,7 @@
 
 #include "chrono/solver/ChConstraint.h"
 #include "chrono/solver/ChKRMBlock.h"
+#include "chrono/solver/ChSparseAssemblyMap.h"
 #include "chrono/solver/ChVariables.h"
 
 namespace chrono {
@@ -88,6 +89,7 @@ class ChApi ChSystemDescriptor {
         m_constraints.clear();
         m_variables.clear();
         m_KRMblocks.clear();
+        m_packed_valid = false;
     }
 
     /// Insert reference to a ChConstraint object.
@@ -233,6 +235,7 @@ class ChApi ChSystemDescriptor {
     /// length of the l_i reactions vector; constraints with enabled=false are not handled.
     /// NOTE! the 'q' data in the ChVariables of the system descriptor is changed by this
     /// operation, so it may happen that you need to backup them via FromVariablesToVector()
+    /// (if packed Jacobians are available, only the packed state is changed).
     /// NOTE! currently this function does NOT support the cases that use also ChKRMBlock
     /// objects, because it would need to invert the global M+K, that is not diagonal,
     /// for doing = [N]*l = [ [Cq][(M+K)^(-1)][Cq'] - [E] ] * l
@@ -242,6 +245,50 @@ class ChApi ChSystemDescriptor {
         std::vector<bool>* enabled = nullptr  ///< optional: vector of "enabled" flags, one per scalar constraint.
     );
 
+    // PACKED CONSTRAINT JACOBIANS
+
+    /// Enable/disable the use of packed constraint Jacobians by the iterative VI solvers (default: false).
+    /// If enabled, solvers which support this mode (PSOR, APGD, Barzilai-Borwein, PMINRES) copy, at the beginning of
+    /// each solve, the Jacobians [Cq_i] and the auxiliary vectors [Eq_i] of all active constraints into contiguous
+    /// arrays (see PackJacobians) and run their inner loops on these arrays and on a flat vector of variables, instead
+    /// of going through the individual ChConstraint and ChVariables objects. Results are copied back to the
+    /// constraint and variables objects at the end of the solve, and the packed data is released (see
+    /// ReleasePackedJacobians). Other solvers (e.g., ADMM and the direct solvers) ignore this setting.
+    void EnablePackedJacobians(bool val) {
+        m_use_packed = val;
+        m_packed_valid = false;
+    }
+
+    /// Return true if the use of packed constraint Jacobians is enabled.
+    bool UsePackedJacobians() const { return m_use_packed; }
+
+    /// Copy the Jacobians [Cq_i], the auxiliary vectors [Eq_i]=[invM_i]*[Cq_i]', and the compliance terms of all active
+    /// constraints into contiguous arrays, and the state 'q' of all active variables into a flat vector.
+    /// Must be called after the constraint Jacobians have been loaded and Update_auxiliary was called on all
+    /// constraints. Return false if any of the active constraints does not support packing (see
+    /// ChConstraint::PackJacobian), in which case the packed data is not available.
+    bool PackJacobians();
+
+    /// Return true if packed Jacobians are currently available (i.e., PackJacobians succeeded).
+    bool HasPackedJacobians() const { return m_packed_valid; }
+
+    /// Mark the packed data as no longer available.
+    /// Called by the solvers at the end of each solve, since the constraint Jacobians may change afterwards. The
+    /// packed arrays keep their capacity and are overwritten in place by the next call to PackJacobians.
+    void ReleasePackedJacobians() { m_packed_valid = false; }
+
+    /// Access the flat vector of variables 'q' used with packed Jacobians.
+    ChVectorDynamic<>& GetPackedState() { return m_packed_q; }
+
+    /// Return [Cq_i]*q for the active constraint with given offset, using the packed Jacobians and the packed state.
+    double PackedJacobianTimesState(unsigned int row) const;
+
+    /// Perform q += [Eq_i]*deltal for the active constraint with given offset, using the packed data.
+    void PackedIncrementState(unsigned int row, double deltal);
+
+    /// Copy the packed state 'q' back into the ChVariables objects.
+    void UnpackState();
+
     /// Performs the product of the entire system matrix (KKT matrix), by a vector x ={q,l}.
     /// Note that the 'q' data in the ChVariables of the system descriptor is changed by this
     /// operation, so thay may need to be backed up via FromVariablesToVector()
@@ -321,6 +368,17 @@ class ChApi ChSystemDescriptor {
                                    ChVectorDynamic<>* rhs  ///< [out] assembled RHS vector
     ) const;
 
+    /// Record the assembly map of the system matrix into the given matrix.
+    /// Z must be compressed and must already contain all nonzeros of the system matrix (e.g., after a call to
+    /// BuildSystemMatrix followed by makeCompressed). Returns false (and leaves the map invalid) otherwise.
+    bool BuildSystemMatrixMap(const ChSparseMatrix& Z, ChSparseAssemblyMap& map) const;
+
+    /// Assemble the system matrix using a previously recorded assembly map (see BuildSystemMatrixMap).
+    /// Matrix values are written directly in the CSR value array of Z, processing variables, KRM blocks and
+    /// constraints with the specified number of threads. Returns false, without modifying Z, if the current problem
+    /// structure does not match the one for which the map was recorded (in which case the map is invalidated).
+    bool BuildSystemMatrix(ChSparseMatrix& Z, ChSparseAssemblyMap& map, int nthreads = 1) const;
+
     /// Write the current system matrix blocks and right-hand side components.
     /// The system matrix is formed by calling BuildSystemMatrix() as used with direct linear solvers.
     /// The following files are written in the directory specified by [path]:
@@ -375,6 +433,19 @@ class ChApi ChSystemDescriptor {
     mutable unsigned int n_q;  ///< number of active variables
     mutable unsigned int n_c;  ///< number of active constraints
     bool freeze_count;         ///< cache the number of active variables and constraints
+
+    bool m_use_packed;    ///< use packed constraint Jacobians in VI solvers
+    bool m_packed_valid;  ///< packed data currently available
+
+    std::vector<unsigned int> m_packed_row_start;    ///< first chunk of each active constraint (size n_c+1)
+    std::vector<unsigned int> m_packed_chunk_off;    ///< offset of each chunk in the state vector
+    std::vector<unsigned int> m_packed_chunk_size;   ///< size of each chunk (DOFs of the variables object)
+    std::vector<unsigned int> m_packed_chunk_start;  ///< start of each chunk in the Cq and Eq value arrays
+    std::vector<double> m_packed_Cq;                 ///< packed Jacobian values
+    std::vector<double> m_packed_Eq;                 ///< packed [invM]*[Cq]' values
+    ChVectorDynamic<> m_packed_cfm;                  ///< compliance terms of all active constraints
+    ChVectorDynamic<> m_packed_q;                    ///< flat state of all active variables
+    std::vector<ChVariables*> m_packed_vars;         ///< scratch list of the variables of a constraint
 };
 
 CH_CLASS_VERSION(ChSystemDescriptor, 0)
@@ -68,6 +68,9 @@ class ChApi ChIntegrable {
     /// Return the number of lagrangian multipliers i.e. of scalar constraints.
     virtual unsigned int GetNumConstraints() { return 0; }
 
+    /// Return the number of unilateral scalar constraints (e.g., contacts), a subset of all constraints.
+    virtual unsigned int GetNumConstraintsUnilateral() { return 0; }
+
     /// Set up the system state.
     virtual void StateSetup(ChState& y, ChStateDelta& dy) {
         y.resize(GetNumCoordsPosLevel() + GetNumCoordsVelLevel());
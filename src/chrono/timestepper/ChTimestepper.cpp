@@ -12,9 +12,12 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/utils/ChUtils.h"
 
 namespace chrono {
 
@@ -68,6 +71,118 @@ void ChTimestepper::ArchiveIn(ChArchiveIn& archive) {
 
 // -----------------------------------------------------------------------------
 
+bool ChImplicitIterativeTimestepper::NewtonMatrixStale(ChIntegrable* integrable, double h) {
+    if (!matrix_reuse || matrix_h <= 0)
+        return true;
+    if (integrable->GetNumCoordsVelLevel() + integrable->GetNumConstraints() != matrix_size)
+        return true;
+    if (std::abs(h - matrix_h) > 1e-6 * matrix_h)
+        return true;
+    num_reuses++;
+    return false;
+}
+
+void ChImplicitIterativeTimestepper::NewtonMatrixRebuilt(ChIntegrable* integrable, double h) {
+    matrix_h = h;
+    matrix_size = integrable->GetNumCoordsVelLevel() + integrable->GetNumConstraints();
+    num_rebuilds++;
+}
+
+bool ChImplicitIterativeTimestepper::NewtonMatrixDegraded(double update_nrm, double update_nrm_prev) const {
+    return matrix_reuse && update_nrm_prev > 0 && update_nrm > matrix_reuse_rate * update_nrm_prev;
+}
+
+// -----------------------------------------------------------------------------
+
+ChAdaptiveTimestepper::ChAdaptiveTimestepper(int order)
+    : step_control(false),
+      order(order),
+      step_rtol(1e-2),
+      step_atol(1e-5),
+      h_min(1e-8),
+      h_max(std::numeric_limits<double>::max()),
+      safety(0.9),
+      h_next(0),
+      err_prev(1),
+      rejected(false),
+      num_accepted(0),
+      num_rejected(0) {}
+
+void ChAdaptiveTimestepper::SetStepControl(bool enable) {
+    step_control = enable;
+    h_next = 0;
+    err_prev = 1;
+    rejected = false;
+}
+
+void ChAdaptiveTimestepper::SetStepTolerances(double rtol, double atol) {
+    if (rtol < 0 || atol <= 0)
+        throw std::invalid_argument("Step tolerances must be non-negative (rtol) and positive (atol)");
+    step_rtol = rtol;
+    step_atol = atol;
+}
+
+void ChAdaptiveTimestepper::SetStepSizeLimits(double hmin, double hmax) {
+    if (hmin <= 0 || hmax < hmin)
+        throw std::invalid_argument("Invalid step size limits");
+    h_min = hmin;
+    h_max = hmax;
+}
+
+void ChAdaptiveTimestepper::SetStepSafetyFactor(double factor) {
+    if (factor <= 0 || factor > 1)
+        throw std::invalid_argument("Step safety factor must be in (0, 1]");
+    safety = factor;
+}
+
+void ChAdaptiveTimestepper::ResetStepStatistics() {
+    num_accepted = 0;
+    num_rejected = 0;
+    step_history.clear();
+}
+
+double ChAdaptiveTimestepper::InitialStepSize(double dt) const {
+    // Use the proposed step size, if any, but never attempt a step larger than dt
+    double h = (h_next > 0) ? std::min(h_next, dt) : dt;
+    return std::max(std::min(h, h_max), std::min(h_min, dt));
+}
+
+double ChAdaptiveTimestepper::ErrorNorm(const ChVectorDynamic<>& err, const ChVectorDynamic<>& dx) const {
+    return err.wrmsNorm((step_rtol * dx.cwiseAbs().array() + step_atol).inverse().matrix());
+}
+
+// PI step size controller (Gustafsson), with the error estimate of the previous accepted step used in the
+// proportional term. After a rejection, the step size is not allowed to increase at the next accepted step.
+bool ChAdaptiveTimestepper::StepControl(double h, double h_full, double err) {
+    const double fac_min = 0.2;
+    const double fac_max = 5.0;
+    const double kI = 0.7 / order;
+    const double kP = 0.4 / order;
+
+    err = std::max(err, 1e-10);
+
+    if (err > 1 && h > h_min * (1 + 1e-8)) {
+        double fac = std::max(fac_min, safety * std::pow(err, -1.0 / order));
+        h_next = std::max(h * fac, h_min);
+        rejected = true;
+        num_rejected++;
+        return false;
+    }
+
+    double fac = safety * std::pow(err, -kI) * std::pow(err_prev, kP);
+    fac = ChClamp(fac, fac_min, rejected ? 1.0 : fac_max);
+    h_next = ChClamp(h * fac, h_min, h_max);
+    if (h_full > h)
+        h_next = std::max(h_next, std::min(h_full, h_max));
+    err_prev = std::max(err, 1e-4);
+    rejected = false;
+    num_accepted++;
+    step_history.push_back(h);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChTimestepperEulerExpl)
 CH_UPCASTING(ChTimestepperEulerExpl, ChTimestepperIorder)
@@ -445,6 +560,11 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
     numsetups = 0;
     numsolves = 0;
 
+    // Unless reusing the Newton matrix across steps, call the solver's Setup at each iteration
+    bool call_setup = NewtonMatrixStale(mintegrable, dt);
+    bool converged = false;
+    double Dv_nrm_prev = 0;
+
     for (int i = 0; i < this->GetMaxIters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
         R.setZero();
@@ -459,8 +579,13 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             std::cout << " Euler iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
                       << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << std::endl;
 
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
+        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+            converged = true;
             break;
+        }
+
+        if (verbose && matrix_reuse && call_setup)
+            std::cout << " Euler call Setup." << std::endl;
 
         mintegrable->StateSolveCorrection(  //
             Dv, Dl, R, Qc,                  //
@@ -470,12 +595,22 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always call the solver's Setup
+            call_setup                      // call the solver's Setup?
         );
 
         numiters++;
-        numsetups++;
         numsolves++;
+        if (call_setup) {
+            numsetups++;
+            NewtonMatrixRebuilt(mintegrable, dt);
+        }
+
+        // With a reused Newton matrix, force a matrix update only if the iteration converges too slowly
+        if (matrix_reuse) {
+            double Dv_nrm = Dv.norm();
+            call_setup = NewtonMatrixDegraded(Dv_nrm, Dv_nrm_prev);
+            Dv_nrm_prev = Dv_nrm;
+        }
 
         Dl *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
@@ -485,6 +620,10 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
         Xnew = X + Vnew * dt;
     }
 
+    // Do not carry over a Newton matrix with which the iteration did not converge
+    if (!converged)
+        InvalidateNewtonMatrix();
+
     mintegrable->StateScatterAcceleration(
         (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
@@ -541,9 +680,75 @@ void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
     mintegrable->StateGather(X, V, T);  // state <- system
 
     mintegrable->StateGatherReactions(L);  // state <- system (may be needed for warm starting StateSolveCorrection)
-    L *= dt;                               // because reactions = forces, here L = impulses
 
     Vold = V;
+    Lold = L;
+
+    // Advance solution to time T+dt, possibly taking multiple steps if step size control is enabled
+    double tfinal = T + dt;
+    double h = step_control ? InitialStepSize(dt) : dt;
+
+    // Unilateral constraints (e.g., contacts) are only valid near the state at the beginning of the call, so in their
+    // presence a single step is taken, which may end before T+dt.
+    bool substeps = mintegrable->GetNumConstraintsUnilateral() == 0;
+
+    while (true) {
+        // if close to the final time, adjust the step to reach it exactly (avoiding a very short last step)
+        double h_step = h;
+        bool reach = true;  // this step reaches T+dt
+        bool last = true;   // this is the last step of this call
+        if (step_control) {
+            double left = tfinal - T;
+            reach = 1.001 * h >= left;
+            last = reach || !substeps;
+            h_step = reach ? left : (substeps ? std::min(h, 0.5 * left) : h);
+        }
+
+        Solve(mintegrable, h_step);
+
+        if (step_control) {
+            // local error estimate: difference between the Euler and trapezoidal position updates
+            double err = ErrorNorm((V - Vold) * (h_step / 2), V * h_step);
+            bool accepted = StepControl(h_step, h, err);
+            h = std::min(h_next, dt);
+            if (verbose)
+                std::cout << " EulerImplicitLinearized " << (accepted ? "accepted" : "rejected")
+                          << " step h = " << h_step << "  err = " << err << "  next h = " << h << std::endl;
+            if (!accepted) {
+                // discard the step and retry from the same state with a smaller step size
+                V = Vold;
+                L = Lold;
+                continue;
+            }
+        }
+
+        L *= (1.0 / h_step);  // Note it is not -(1.0/h) because we assume StateSolveCorrection flips sign of Dl
+
+        A = (V - Vold) * (1 / h_step);  // acceleration as measure, fits DVI/MDI
+
+        X += V * h_step;
+
+        T = (step_control && reach) ? tfinal : T + h_step;
+
+        if (last)
+            break;
+
+        // scatter state at the end of the accepted step and continue from it
+        mintegrable->StateScatter(X, V, T, false);
+        Vold = V;
+        Lold = L;
+    }
+
+    mintegrable->StateScatterAcceleration(A);  // -> system auxiliary data
+
+    mintegrable->StateScatter(X, V, T, true);  // state -> system
+    mintegrable->StateScatterReactions(L);     // -> system auxiliary data
+}
+
+// Solve for new velocities and constraint impulses over a step of size h.
+// Reactions are loaded in L on input (used for warm starting); constraint impulses are returned in L.
+void ChTimestepperEulerImplicitLinearized::Solve(ChIntegrableIIorder* integrable, double h) {
+    L *= h;  // because reactions = forces, here L = impulses
 
     // solve only 1st NR step, using v_new = 0, so  Dv = v_new , therefore
     //
@@ -555,34 +760,25 @@ void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
     // [ M - dt*dF/dv - dt^2*dF/dx    Cq' ] [ v_new  ] = [ M*(v_old) + dt*f]
     // [ Cq                           0   ] [ -dt*l  ] = [ -C/dt - Ct ]
 
-    mintegrable->LoadResidual_F(R, dt);       // R  = df*f
-    mintegrable->LoadResidual_Mv(R, V, 1.0);  // R += M*(v_old)
-    mintegrable->LoadConstraint_C(Qc, 1.0 / dt, Qc_do_clamp,
-                                  Qc_clamping);  // Qc = C/dt  (sign will be flipped later in StateSolveCorrection)
-    mintegrable->LoadConstraint_Ct(Qc, 1.0);     // // Qc += Ct  (sign will be flipped later in StateSolveCorrection)
+    R.setZero();
+    Qc.setZero();
 
-    mintegrable->StateSolveCorrection(  //
-        V, L, R, Qc,                    //
-        1.0,                            // factor for  M
-        -dt,                            // factor for  dF/dv
-        -dt * dt,                       // factor for  dF/dx
-        X, V, T + dt,                   // not needed
-        false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
-        false,                          // full update? (not used, since no scatter)
-        true                            // force a call to the solver's Setup() function
+    integrable->LoadResidual_F(R, h);          // R  = dt*f
+    integrable->LoadResidual_Mv(R, Vold, 1.0);  // R += M*(v_old)
+    integrable->LoadConstraint_C(Qc, 1.0 / h, Qc_do_clamp,
+                                 Qc_clamping);  // Qc = C/dt  (sign will be flipped later in StateSolveCorrection)
+    integrable->LoadConstraint_Ct(Qc, 1.0);     // // Qc += Ct  (sign will be flipped later in StateSolveCorrection)
+
+    integrable->StateSolveCorrection(  //
+        V, L, R, Qc,                   //
+        1.0,                           // factor for  M
+        -h,                            // factor for  dF/dv
+        -h * h,                        // factor for  dF/dx
+        X, V, T + h,                   // not needed
+        false,                         // do not scatter update to Xnew Vnew T+dt before computing correction
+        false,                         // full update? (not used, since no scatter)
+        true                           // force a call to the solver's Setup() function
     );
-
-    L *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
-
-    mintegrable->StateScatterAcceleration(
-        (V - Vold) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
-
-    X += V * dt;
-
-    T += dt;
-
-    mintegrable->StateScatter(X, V, T, true);  // state -> system
-    mintegrable->StateScatterReactions(L);     // -> system auxiliary data
 }
 
 void ChTimestepperEulerImplicitLinearized::ArchiveOut(ChArchiveOut& archive) {
@@ -1063,10 +1259,73 @@ void ChTimestepperNewmark::Advance(const double dt) {
     mintegrable->StateGather(X, V, T);  // state <- system
     mintegrable->StateGatherAcceleration(A);
 
+    numiters = 0;
+    numsetups = 0;
+    numsolves = 0;
+
+    // Advance solution to time T+dt, possibly taking multiple steps if step size control is enabled
+    double tfinal = T + dt;
+    double h = step_control ? InitialStepSize(dt) : dt;
+
+    // Unilateral constraints (e.g., contacts) are only valid near the state at the beginning of the call, so in their
+    // presence a single step is taken, which may end before T+dt.
+    bool substeps = mintegrable->GetNumConstraintsUnilateral() == 0;
+
+    while (true) {
+        // if close to the final time, adjust the step to reach it exactly (avoiding a very short last step)
+        double h_step = h;
+        bool reach = true;  // this step reaches T+dt
+        bool last = true;   // this is the last step of this call
+        if (step_control) {
+            double left = tfinal - T;
+            reach = 1.001 * h >= left;
+            last = reach || !substeps;
+            h_step = reach ? left : (substeps ? std::min(h, 0.5 * left) : h);
+        }
+
+        Solve(mintegrable, h_step);
+
+        if (step_control) {
+            // local error estimate (Zienkiewicz and Xie)
+            double err = ErrorNorm((Anew - A) * ((beta - 1.0 / 6) * h_step * h_step), Vnew * h_step);
+            bool accepted = StepControl(h_step, h, err);
+            h = std::min(h_next, dt);
+            if (verbose)
+                std::cout << " Newmark " << (accepted ? "accepted" : "rejected") << " step h = " << h_step
+                          << "  err = " << err << "  next h = " << h << std::endl;
+            if (!accepted) {
+                // discard the step and retry from the same state with a smaller step size
+                mintegrable->StateScatter(X, V, T, false);
+                continue;
+            }
+        }
+
+        X = Xnew;
+        V = Vnew;
+        A = Anew;
+        T = (step_control && reach) ? tfinal : T + h_step;
+
+        if (last)
+            break;
+
+        // scatter state at the end of the accepted step and continue from it
+        mintegrable->StateScatter(X, V, T, false);
+    }
+
+    mintegrable->StateScatter(X, V, T, true);  // state -> system
+    mintegrable->StateScatterAcceleration(A);  // -> system auxiliary data
+    mintegrable->StateScatterReactions(L);     // -> system auxiliary data
+}
+
+// Solve the Newmark nonlinear system for a step of size h, starting from the state (X, V, A) at time T.
+// The new state is returned in (Xnew, Vnew, Anew) and the Lagrange multipliers in L.
+void ChTimestepperNewmark::Solve(ChIntegrableIIorder* integrable, double h) {
     // extrapolate a prediction as a warm start
 
+    L.setZero();
+    Anew.setZero(integrable->GetNumCoordsVelLevel(), integrable);
     Vnew = V;
-    Xnew = X + Vnew * dt;
+    Xnew = X + Vnew * h;
 
     // use Newton Raphson iteration to solve implicit Newmark for a_new
 
@@ -1074,21 +1333,18 @@ void ChTimestepperNewmark::Advance(const double dt) {
     // [ M - dt*gamma*dF/dv - dt^2*beta*dF/dx    Cq' ] [ Da   ] = [ -M*(a_new) + f_new + Cq*l_new ]
     // [ Cq                                      0   ] [ -Dl  ] = [ -1/(beta*dt^2)*C              ]
 
-    numiters = 0;
-    numsetups = 0;
-    numsolves = 0;
     bool call_setup = true;
 
     for (int i = 0; i < this->GetMaxIters(); ++i) {
-        mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
-
-        R.setZero(mintegrable->GetNumCoordsVelLevel());
-        Qc.setZero(mintegrable->GetNumConstraints());
-        mintegrable->LoadResidual_F(R, 1.0);          //  f_new
-        mintegrable->LoadResidual_CqL(R, L, 1.0);     //   Cq'*l_new
-        mintegrable->LoadResidual_Mv(R, Anew, -1.0);  //  - M*a_new
-        mintegrable->LoadConstraint_C(
-            Qc, (1.0 / (beta * dt * dt)), Qc_do_clamp,
+        integrable->StateScatter(Xnew, Vnew, T + h, false);  // state -> system
+
+        R.setZero(integrable->GetNumCoordsVelLevel());
+        Qc.setZero(integrable->GetNumConstraints());
+        integrable->LoadResidual_F(R, 1.0);          //  f_new
+        integrable->LoadResidual_CqL(R, L, 1.0);     //   Cq'*l_new
+        integrable->LoadResidual_Mv(R, Anew, -1.0);  //  - M*a_new
+        integrable->LoadConstraint_C(
+            Qc, (1.0 / (beta * h * h)), Qc_do_clamp,
             Qc_clamping);  //  Qc = 1/(beta*dt^2)*C  (sign will be flipped later in StateSolveCorrection)
 
         if (verbose)
@@ -1098,7 +1354,7 @@ void ChTimestepperNewmark::Advance(const double dt) {
         if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
             if (verbose) {
                 std::cout << " Newmark NR converged (" << i << ")."
-                          << "  T = " << T + dt << "  h = " << dt << std::endl;
+                          << "  T = " << T + h << "  h = " << h << std::endl;
             }
             break;
         }
@@ -1106,15 +1362,15 @@ void ChTimestepperNewmark::Advance(const double dt) {
         if (verbose && modified_Newton && call_setup)
             std::cout << " Newmark call Setup." << std::endl;
 
-        mintegrable->StateSolveCorrection(  //
-            Da, Dl, R, Qc,                  //
-            1.0,                            // factor for  M
-            -dt * gamma,                    // factor for  dF/dv
-            -dt * dt * beta,                // factor for  dF/dx
-            Xnew, Vnew, T + dt,             // not used here (scatter = false)
-            false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
-            false,                          // full update? (not used, since no scatter)
-            call_setup                      // force a call to the solver's Setup() function
+        integrable->StateSolveCorrection(  //
+            Da, Dl, R, Qc,                 //
+            1.0,                           // factor for  M
+            -h * gamma,                    // factor for  dF/dv
+            -h * h * beta,                 // factor for  dF/dx
+            Xnew, Vnew, T + h,             // not used here (scatter = false)
+            false,                         // do not scatter update to Xnew Vnew T+dt before computing correction
+            false,                         // full update? (not used, since no scatter)
+            call_setup                     // force a call to the solver's Setup() function
         );
 
         numiters++;
@@ -1129,19 +1385,10 @@ void ChTimestepperNewmark::Advance(const double dt) {
         L += Dl;  // Note it is not -= Dl because we assume StateSolveCorrection flips sign of Dl
         Anew += Da;
 
-        Xnew = X + V * dt + A * (dt * dt * (0.5 - beta)) + Anew * (dt * dt * beta);
+        Xnew = X + V * h + A * (h * h * (0.5 - beta)) + Anew * (h * h * beta);
 
-        Vnew = V + A * (dt * (1.0 - gamma)) + Anew * (dt * gamma);
+        Vnew = V + A * (h * (1.0 - gamma)) + Anew * (h * gamma);
     }
-
-    X = Xnew;
-    V = Vnew;
-    A = Anew;
-    T += dt;
-
-    mintegrable->StateScatter(X, V, T, true);  // state -> system
-    mintegrable->StateScatterAcceleration(A);  // -> system auxiliary data
-    mintegrable->StateScatterReactions(L);     // -> system auxiliary data
 }
 
 void ChTimestepperNewmark::ArchiveOut(ChArchiveOut& archive) {
@@ -16,6 +16,8 @@
 #define CHTIMESTEPPER_H
 
 #include <cstdlib>
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChFrame.h"
 #include "chrono/serialization/ChArchive.h"
@@ -98,6 +100,7 @@ class ChApi ChTimestepper {
     double Qc_clamping;
 
     friend class ChSystem;
+    friend class ChTimestepperMultirate;
 };
 
 /// Base class for 1st order timesteppers, that is a time integrator for a ChIntegrable.
@@ -242,9 +245,43 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     unsigned int numsetups;  ///< number of calls to the solver's Setup function
     unsigned int numsolves;  ///< number of calls to the solver's Solve function
 
+    bool matrix_reuse;          ///< reuse the Newton matrix across steps?
+    double matrix_reuse_rate;   ///< maximum Newton contraction rate with a reused matrix
+    double matrix_h;            ///< step size used for the current Newton matrix (0 if no valid matrix)
+    unsigned int matrix_size;   ///< problem size for the current Newton matrix
+    unsigned int num_rebuilds;  ///< number of Newton matrix rebuilds since the last statistics reset
+    unsigned int num_reuses;    ///< number of steps started with a Newton matrix from a previous step
+
+    /// Return true if the Newton matrix must be rebuilt at the beginning of a step of size h.
+    /// Always true if matrix reuse is disabled. Otherwise, true if there is no valid matrix or if the step size or the
+    /// problem size changed since the matrix was last built.
+    bool NewtonMatrixStale(ChIntegrable* integrable, double h);
+
+    /// Record a rebuild of the Newton matrix (a call to the solver's Setup) for a step of size h.
+    void NewtonMatrixRebuilt(ChIntegrable* integrable, double h);
+
+    /// Return true if matrix reuse is enabled and the Newton iteration converges too slowly with the current matrix,
+    /// given the norms of the last two Newton updates.
+    bool NewtonMatrixDegraded(double update_nrm, double update_nrm_prev) const;
+
+    /// Discard the current Newton matrix, forcing a rebuild at the beginning of the next step.
+    void InvalidateNewtonMatrix() { matrix_h = 0; }
+
   public:
     ChImplicitIterativeTimestepper()
-        : maxiters(6), reltol(1e-4), abstolS(1e-10), abstolL(1e-10), numiters(0), numsetups(0), numsolves(0) {}
+        : maxiters(6),
+          reltol(1e-4),
+          abstolS(1e-10),
+          abstolL(1e-10),
+          numiters(0),
+          numsetups(0),
+          numsolves(0),
+          matrix_reuse(false),
+          matrix_reuse_rate(0.5),
+          matrix_h(0),
+          matrix_size(0),
+          num_rebuilds(0),
+          num_reuses(0) {}
     virtual ~ChImplicitIterativeTimestepper() {}
 
     /// Set the max number of iterations using the Newton Raphson procedure
@@ -284,6 +321,34 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     /// Return the number of calls to the solver's Solve function.
     unsigned int GetNumSolveCalls() const { return numsolves; }
 
+    /// Enable/disable reuse of the Newton matrix across steps (currently supported by HHT and Euler implicit).
+    /// If enabled, the Newton matrix evaluated, assembled, and factorized in a previous step is kept for as long as the
+    /// Newton iteration converges fast enough with it. The matrix is rebuilt at the beginning of a step if the step
+    /// size or the problem size changed, and during the Newton iteration if the contraction rate of the updates (the
+    /// ratio of successive update norms) exceeds the threshold set with SetNewtonMatrixReuseRate. For HHT, this
+    /// requires modified Newton.
+    /// Default: false.
+    void SetNewtonMatrixReuse(bool enable) {
+        matrix_reuse = enable;
+        matrix_h = 0;
+    }
+
+    /// Set the maximum Newton contraction rate for which a reused Newton matrix is kept (in (0, 1)).
+    /// Default: 0.5.
+    void SetNewtonMatrixReuseRate(double rate) { matrix_reuse_rate = rate; }
+
+    /// Return the number of Newton matrix rebuilds (calls to the solver's Setup function) since the last reset.
+    unsigned int GetNumMatrixRebuilds() const { return num_rebuilds; }
+
+    /// Return the number of steps which started with a Newton matrix from a previous step since the last reset.
+    unsigned int GetNumMatrixReuses() const { return num_reuses; }
+
+    /// Reset the counters of Newton matrix rebuilds and reuses.
+    void ResetMatrixStatistics() {
+        num_rebuilds = 0;
+        num_reuses = 0;
+    }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive) {
         // version number
@@ -307,6 +372,88 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     }
 };
 
+/// Base properties for timesteppers with adaptive step size control.
+/// Such integrators compute an embedded estimate of the local error of each step and use a PI step size controller
+/// to accept or reject the step and to propose the size of the next step. With step size control enabled, a call to
+/// Advance(dt) may take several internal steps to reach T+dt, but never attempts a step larger than dt; the step
+/// size proposed at the end of a call can be used by the caller as the size of the next call (this is done by
+/// ChSystem::DoFrameDynamics). If the integrable object has unilateral constraints (e.g., contacts, which are
+/// detected only once per call), a call takes a single step instead, which ends before T+dt if the step size had to
+/// be reduced; the caller must then check the time reached (ChSystem::DoFrameDynamics loops until the frame time).
+class ChApi ChAdaptiveTimestepper {
+  public:
+    /// Construct the step size controller for an error estimate of the given order.
+    /// The local error estimate is assumed to scale as h^order.
+    ChAdaptiveTimestepper(int order);
+    virtual ~ChAdaptiveTimestepper() {}
+
+    /// Turn on/off the adaptive step size control.
+    /// Default: false (fixed step size).
+    void SetStepControl(bool enable);
+
+    /// Return true if adaptive step size control is enabled.
+    bool GetStepControl() const { return step_control; }
+
+    /// Set the relative and absolute tolerances for the local error estimate.
+    /// The error of each coordinate is weighted by 1/(rtol*|dx| + atol), where dx is the coordinate increment over
+    /// the step, and a step is accepted if the WRMS norm of the weighted error is at most 1.
+    /// Default: rtol = 1e-2, atol = 1e-5.
+    void SetStepTolerances(double rtol, double atol);
+
+    /// Set the minimum and maximum step sizes.
+    /// A step of minimum size is always accepted, regardless of its error estimate.
+    /// Default: 1e-8 and no upper limit.
+    void SetStepSizeLimits(double h_min, double h_max);
+
+    /// Set the safety factor applied to the step size predicted by the controller (in (0, 1]).
+    /// Default: 0.9.
+    void SetStepSafetyFactor(double safety);
+
+    /// Get the step size proposed by the controller for the next step.
+    /// Return 0 if step size control is disabled or no step was taken yet.
+    double GetNextStepSize() const { return step_control ? h_next : 0; }
+
+    /// Return the number of accepted steps since the last statistics reset.
+    unsigned int GetNumAcceptedSteps() const { return num_accepted; }
+
+    /// Return the number of rejected steps since the last statistics reset.
+    unsigned int GetNumRejectedSteps() const { return num_rejected; }
+
+    /// Return the sizes of the accepted steps since the last statistics reset.
+    const std::vector<double>& GetStepSizeHistory() const { return step_history; }
+
+    /// Reset the step counters and the step size history.
+    void ResetStepStatistics();
+
+  protected:
+    /// Return the initial size of the next step attempted in a call to Advance(dt).
+    double InitialStepSize(double dt) const;
+
+    /// Return the WRMS norm of the specified error vector, with error weights based on the step increment dx.
+    double ErrorNorm(const ChVectorDynamic<>& err, const ChVectorDynamic<>& dx) const;
+
+    /// Process the error norm of a step of size h.
+    /// Return true if the step is accepted. In either case, set the size of the next step to attempt (h_next). If the
+    /// step was shortened to reach the end of the current Advance call, h_full is the size initially proposed and is
+    /// used as a lower bound for the next step, if accepted.
+    bool StepControl(double h, double h_full, double err);
+
+    bool step_control;  ///< adaptive step size control enabled?
+    int order;          ///< order of the local error estimate
+    double step_rtol;   ///< relative tolerance for the local error
+    double step_atol;   ///< absolute tolerance for the local error
+    double h_min;       ///< minimum step size
+    double h_max;       ///< maximum step size
+    double safety;      ///< safety factor for the predicted step size
+    double h_next;      ///< proposed size for the next step
+    double err_prev;    ///< error norm of the previous accepted step
+    bool rejected;      ///< was the last attempted step rejected?
+
+    unsigned int num_accepted;         ///< number of accepted steps
+    unsigned int num_rejected;         ///< number of rejected steps
+    std::vector<double> step_history;  ///< sizes of accepted steps
+};
+
 /// Euler explicit timestepper.
 /// This performs the typical  y_new = y+ dy/dt * dt integration with Euler formula.
 class ChApi ChTimestepperEulerExpl : public ChTimestepperIorder, public ChExplicitTimestepper {
@@ -481,17 +628,22 @@ class ChApi ChTimestepperEulerImplicit : public ChTimestepperIIorder, public ChI
 /// first Newton corrector iteration.
 /// If using an underlying CCP complementarity solver, this is the typical Anitescu stabilized
 /// timestepper for DVIs.
-class ChApi ChTimestepperEulerImplicitLinearized : public ChTimestepperIIorder, public ChImplicitTimestepper {
+/// If step size control is enabled, the local error is estimated by comparing the position update with the update
+/// of the (second order) trapezoidal rule, i.e. err = h/2 * (v_new - v_old).
+class ChApi ChTimestepperEulerImplicitLinearized : public ChTimestepperIIorder,
+                                                   public ChImplicitTimestepper,
+                                                   public ChAdaptiveTimestepper {
   protected:
     ChStateDelta Vold;
     ChVectorDynamic<> Dl;
     ChVectorDynamic<> R;
     ChVectorDynamic<> Qc;
+    ChVectorDynamic<> Lold;
 
   public:
     /// Constructors (default empty)
     ChTimestepperEulerImplicitLinearized(ChIntegrableIIorder* intgr = nullptr)
-        : ChTimestepperIIorder(intgr), ChImplicitTimestepper() {}
+        : ChTimestepperIIorder(intgr), ChImplicitTimestepper(), ChAdaptiveTimestepper(2) {}
 
     virtual Type GetType() const override { return Type::EULER_IMPLICIT_LINEARIZED; }
 
@@ -504,6 +656,9 @@ class ChApi ChTimestepperEulerImplicitLinearized : public ChTimestepperIIorder,
 
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& archive) override;
+
+  private:
+    void Solve(ChIntegrableIIorder* integrable, double h);
 };
 
 /// Performs a step of Euler implicit for II order systems using a semi implicit Euler without
@@ -625,7 +780,11 @@ class ChApi ChTimestepperTrapezoidalLinearized2 : public ChTimestepperIIorder, p
 
 /// Performs a step of Newmark constrained implicit for II order DAE systems.
 /// See Negrut et al. 2007.
-class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplicitIterativeTimestepper {
+/// If step size control is enabled, the local error is estimated as err = (beta - 1/6) * h^2 * (a_new - a_old), see
+/// Zienkiewicz and Xie 1991.
+class ChApi ChTimestepperNewmark : public ChTimestepperIIorder,
+                                   public ChImplicitIterativeTimestepper,
+                                   public ChAdaptiveTimestepper {
   private:
     double gamma;
     double beta;
@@ -642,7 +801,7 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
   public:
     /// Constructors (default empty)
     ChTimestepperNewmark(ChIntegrableIIorder* intgr = nullptr)
-        : ChTimestepperIIorder(intgr), ChImplicitIterativeTimestepper() {
+        : ChTimestepperIIorder(intgr), ChImplicitIterativeTimestepper(), ChAdaptiveTimestepper(3) {
         SetGammaBeta(0.6, 0.3);  // default values with some damping, and that works also with DAE constraints
         modified_Newton = true;  // default use modified Newton with jacobian factorization only at beginning
     }
@@ -678,6 +837,9 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
 
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& archive) override;
+
+  private:
+    void Solve(ChIntegrableIIorder* integrable, double h);
 };
 
 /// @} chrono_timestepper
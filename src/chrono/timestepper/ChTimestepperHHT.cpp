@@ -99,12 +99,13 @@ void ChTimestepperHHT::Advance(const double dt) {
 
     // Monitor flags controlling whther or not the Newton matrix must be updated.
     // If using modified Newton, a matrix update occurs:
-    //   - at the beginning of a step
+    //   - at the beginning of a step (unless reusing the matrix from a previous step)
     //   - on a stepsize decrease
     //   - if the Newton iteration does not converge with an out-of-date matrix
+    //   - if reusing the Newton matrix and the Newton iteration converges too slowly
     // Otherwise, the matrix is updated at each iteration.
     matrix_is_current = false;
-    call_setup = true;
+    call_setup = !modified_Newton || NewtonMatrixStale(mintegrable, h);
 
     // Loop until reaching final time
     while (true) {
@@ -114,6 +115,7 @@ void ChTimestepperHHT::Advance(const double dt) {
         Da_nrm_hist.fill(0.0);
         Dl_nrm_hist.fill(0.0);
         bool converged = false;
+        bool setup_done = false;
         unsigned int it;
 
         for (it = 0; it < maxiters; it++) {
@@ -128,6 +130,8 @@ void ChTimestepperHHT::Advance(const double dt) {
             numsolves++;
             if (call_setup) {
                 numsetups++;
+                setup_done = true;
+                NewtonMatrixRebuilt(mintegrable, h);
             }
 
             // If using modified Newton, do not call Setup again
@@ -137,6 +141,10 @@ void ChTimestepperHHT::Advance(const double dt) {
             converged = CheckConvergence(it);
             if (converged)
                 break;
+
+            // With a reused Newton matrix, force a matrix update if the iteration converges too slowly
+            if (it > 0 && NewtonMatrixDegraded(Da_nrm_hist[it % 3], Da_nrm_hist[(it - 1) % 3]))
+                call_setup = true;
         }
 
         if (converged) {
@@ -181,6 +189,19 @@ void ChTimestepperHHT::Advance(const double dt) {
                 call_setup = true;
             */
 
+        } else if (modified_Newton && matrix_reuse && !setup_done) {
+            // ------ NR did not converge with a Newton matrix from a previous step
+
+            // reset the count of successive successful steps
+            num_successful_steps = 0;
+
+            // re-attempt step with updated matrix
+            if (verbose) {
+                std::cout << " HHT re-attempt step with updated matrix." << std::endl;
+            }
+
+            call_setup = true;
+
         } else if (!step_control) {
             // ------ NR did not converge and we do not control stepsize
 
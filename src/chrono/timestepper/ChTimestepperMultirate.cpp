@@ -0,0 +1,123 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <stdexcept>
+
+#include "chrono/timestepper/ChTimestepperMultirate.h"
+
+namespace chrono {
+
+CH_UPCASTING(ChTimestepperMultirate, ChTimestepperIIorder)
+
+ChTimestepperMultirate::ChTimestepperMultirate(std::shared_ptr<ChTimestepperIIorder> slow_stepper)
+    : ChTimestepperIIorder(), slow(slow_stepper), num_substeps_taken(0) {
+    if (!slow)
+        throw std::invalid_argument("ChTimestepperMultirate: invalid slow timestepper");
+    ChTimestepperIIorder::SetIntegrable(dynamic_cast<ChIntegrableIIorder*>(slow->GetIntegrable()));
+    T = slow->GetTime();
+}
+
+void ChTimestepperMultirate::AddFastPartition(std::shared_ptr<ChMultiratePartition> partition, int num_substeps) {
+    if (!partition || num_substeps < 1)
+        throw std::invalid_argument("ChTimestepperMultirate: invalid fast partition or number of substeps");
+
+    FastPartition fast;
+    fast.partition = partition;
+    fast.num_substeps = num_substeps;
+    fast.initialized = false;
+    partitions.push_back(fast);
+}
+
+void ChTimestepperMultirate::SetIntegrable(ChIntegrableIIorder* intgr) {
+    ChTimestepperIIorder::SetIntegrable(intgr);
+    if (slow)
+        slow->SetIntegrable(intgr);
+}
+
+void ChTimestepperMultirate::SetTime(double mt) {
+    ChTimestepperIIorder::SetTime(mt);
+    slow->SetTime(mt);
+}
+
+// Cubic Hermite interpolation of the interface motion over a slow step of size H, at s = (t - t0) / H in [0, 1].
+static void InterpolateInterface(double s,
+                                 double H,
+                                 const ChVectorDynamic<>& q0,
+                                 const ChVectorDynamic<>& u0,
+                                 const ChVectorDynamic<>& q1,
+                                 const ChVectorDynamic<>& u1,
+                                 ChVectorDynamic<>& q,
+                                 ChVectorDynamic<>& u,
+                                 ChVectorDynamic<>& a) {
+    double s2 = s * s;
+    double s3 = s2 * s;
+
+    q = (2 * s3 - 3 * s2 + 1) * q0 + (s3 - 2 * s2 + s) * H * u0 + (-2 * s3 + 3 * s2) * q1 + (s3 - s2) * H * u1;
+    u = ((6 * s2 - 6 * s) / H) * (q0 - q1) + (3 * s2 - 4 * s + 1) * u0 + (3 * s2 - 2 * s) * u1;
+    a = ((12 * s - 6) / (H * H)) * (q0 - q1) + ((6 * s - 4) / H) * u0 + ((6 * s - 2) / H) * u1;
+}
+
+void ChTimestepperMultirate::Advance(const double dt) {
+    // Forward the constraint stabilization settings to the slow timestepper
+    slow->Qc_do_clamp = Qc_do_clamp;
+    slow->Qc_clamping = Qc_clamping;
+    slow->SetVerbose(verbose);
+
+    double t0 = slow->GetTime();
+
+    // Apply the averaged interface loads from the previous step and cache the interface state at the step beginning
+    for (auto& fast : partitions) {
+        unsigned int n = fast.partition->GetNumInterfaceCoords();
+        if (!fast.initialized) {
+            fast.load_avg.setZero(n);
+            fast.partition->GatherInterfaceLoads(fast.load_avg);
+            fast.initialized = true;
+        }
+        fast.partition->ApplyInterfaceLoads(fast.load_avg);
+
+        fast.q0.setZero(n);
+        fast.u0.setZero(n);
+        fast.partition->GatherInterfaceState(fast.q0, fast.u0);
+    }
+
+    // Advance the slow system
+    slow->Advance(dt);
+    T = slow->GetTime();
+
+    // Subcycle the fast partitions, following the interpolated interface motion
+    for (auto& fast : partitions) {
+        unsigned int n = fast.partition->GetNumInterfaceCoords();
+        fast.q1.setZero(n);
+        fast.u1.setZero(n);
+        fast.partition->GatherInterfaceState(fast.q1, fast.u1);
+
+        double h = dt / fast.num_substeps;
+        fast.load.setZero(n);
+        fast.load_avg.setZero(n);
+
+        for (int k = 1; k <= fast.num_substeps; k++) {
+            double s = (double)k / fast.num_substeps;
+            InterpolateInterface(s, dt, fast.q0, fast.u0, fast.q1, fast.u1, fast.q, fast.u, fast.a);
+            fast.partition->ScatterInterfaceState(fast.q, fast.u, fast.a, t0 + s * dt);
+            fast.partition->Advance(h);
+            fast.partition->GatherInterfaceLoads(fast.load);
+            fast.load_avg += fast.load;
+        }
+
+        fast.load_avg /= fast.num_substeps;
+        num_substeps_taken += fast.num_substeps;
+    }
+}
+
+}  // end namespace chrono
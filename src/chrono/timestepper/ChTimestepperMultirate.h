@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHTIMESTEPPER_MULTIRATE_H
+#define CHTIMESTEPPER_MULTIRATE_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/timestepper/ChTimestepper.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_timestepper
+/// @{
+
+/// Interface for a fast partition of a multirate integration (see ChTimestepperMultirate).
+/// A fast partition is a subsystem integrated separately from the (slow) integrable object, with a step size which is
+/// a fraction of the slow step. The two are coupled through a set of interface coordinates: the slow system imposes
+/// the interface motion on the fast partition, while the fast partition exerts generalized loads on the interface
+/// coordinates of the slow system.
+class ChApi ChMultiratePartition {
+  public:
+    virtual ~ChMultiratePartition() {}
+
+    /// Return the number of interface coordinates.
+    virtual unsigned int GetNumInterfaceCoords() const = 0;
+
+    /// Load the interface positions and velocities from the current state of the slow system.
+    virtual void GatherInterfaceState(ChVectorDynamic<>& q, ChVectorDynamic<>& u) = 0;
+
+    /// Impose the specified interface positions, velocities, and accelerations on the fast partition.
+    /// This function is called before each fast substep, with the interface motion at the end of the substep.
+    virtual void ScatterInterfaceState(const ChVectorDynamic<>& q,
+                                       const ChVectorDynamic<>& u,
+                                       const ChVectorDynamic<>& a,
+                                       double time) = 0;
+
+    /// Advance the state of the fast partition by one substep of the given size.
+    virtual void Advance(double h) = 0;
+
+    /// Load the generalized loads currently exerted by the fast partition on the interface coordinates.
+    virtual void GatherInterfaceLoads(ChVectorDynamic<>& f) = 0;
+
+    /// Apply the specified generalized loads to the interface coordinates of the slow system.
+    /// The loads must persist (i.e., be included in the slow system's forces) until the next call.
+    virtual void ApplyInterfaceLoads(const ChVectorDynamic<>& f) = 0;
+};
+
+/// Multirate timestepper for II order systems.
+/// This timestepper advances the integrable object with a given (slow) timestepper and subcycles one or more fast
+/// partitions, each with its own number of substeps per slow step. Each slow step of size H proceeds as follows:
+/// - the interface loads of each fast partition, averaged over the substeps of the previous step, are applied to the
+///   slow system;
+/// - the slow system is advanced by H;
+/// - each fast partition takes n substeps of size H/n, following the interface motion obtained by cubic Hermite
+///   interpolation of the interface positions and velocities at the beginning and end of the slow step.
+///
+/// The coupling is explicit: the interface loads seen by the slow system lag by one slow step. This is appropriate
+/// when the fast partition has small inertia relative to the slow system at the interface (e.g., a driveline or tire
+/// force elements attached to a vehicle).
+class ChApi ChTimestepperMultirate : public ChTimestepperIIorder {
+  public:
+    /// Construct a multirate timestepper using the given timestepper for the slow system.
+    /// The integrable object of this timestepper is the one of the slow timestepper.
+    ChTimestepperMultirate(std::shared_ptr<ChTimestepperIIorder> slow_stepper);
+
+    /// Add a fast partition, integrated with the specified number of substeps per slow step.
+    void AddFastPartition(std::shared_ptr<ChMultiratePartition> partition, int num_substeps);
+
+    /// Return the timestepper used for the slow system.
+    std::shared_ptr<ChTimestepperIIorder> GetSlowTimestepper() const { return slow; }
+
+    /// Return the total number of fast substeps taken so far.
+    unsigned int GetNumFastSubsteps() const { return num_substeps_taken; }
+
+    /// Set the integrable object (for both this and the slow timestepper).
+    virtual void SetIntegrable(ChIntegrableIIorder* intgr) override;
+
+    /// Access the state, position part, at current time.
+    virtual ChState& GetStatePos() override { return slow->GetStatePos(); }
+
+    /// Access the state, speed part, at current time.
+    virtual ChStateDelta& GetStateVel() override { return slow->GetStateVel(); }
+
+    /// Access the acceleration, at current time.
+    virtual ChStateDelta& GetStateAcc() override { return slow->GetStateAcc(); }
+
+    /// Access the Lagrange multipliers, if any.
+    virtual ChVectorDynamic<>& GetLagrangeMultipliers() override { return slow->GetLagrangeMultipliers(); }
+
+    /// Set the time (for both this and the slow timestepper).
+    virtual void SetTime(double mt) override;
+
+    /// Perform an integration timestep, by advancing the slow system and subcycling all fast partitions.
+    virtual void Advance(const double dt) override;
+
+  private:
+    struct FastPartition {
+        std::shared_ptr<ChMultiratePartition> partition;
+        int num_substeps;
+        bool initialized;
+        ChVectorDynamic<> q0, u0;    ///< interface state at beginning of slow step
+        ChVectorDynamic<> q1, u1;    ///< interface state at end of slow step
+        ChVectorDynamic<> q, u, a;   ///< interpolated interface state
+        ChVectorDynamic<> load;      ///< interface loads after a substep
+        ChVectorDynamic<> load_avg;  ///< interface loads averaged over the substeps of the last slow step
+    };
+
+    std::shared_ptr<ChTimestepperIIorder> slow;  ///< timestepper for the slow system
+    std::vector<FastPartition> partitions;       ///< fast partitions
+    unsigned int num_substeps_taken;             ///< total number of fast substeps
+};
+
+/// @} chrono_timestepper
+
+}  // end namespace chrono
+
+#endif
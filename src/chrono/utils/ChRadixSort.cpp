@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Parallel stable radix sort of 64-bit integer keys
+//
+// =============================================================================
+
+#include <algorithm>
+#include <numeric>
+
+#include "chrono/utils/ChRadixSort.h"
+
+namespace chrono {
+namespace utils {
+
+// Minimum number of keys processed by a thread (below this, spawning threads costs more than it saves).
+static const size_t radix_min_chunk = 4096;
+
+// Number of bits and number of buckets for each radix digit.
+static const int radix_bits = 8;
+static const int radix_buckets = 1 << radix_bits;
+
+void RadixSort(const std::vector<uint64_t>& keys, std::vector<unsigned int>& order, int num_threads) {
+    const size_t n = keys.size();
+    if (order.size() != n) {
+        order.resize(n);
+        std::iota(order.begin(), order.end(), 0);
+    }
+    if (n < 2)
+        return;
+
+    // Split the input in contiguous chunks, one per thread
+    int nt = (int)std::min<size_t>(std::max(num_threads, 1), (n + radix_min_chunk - 1) / radix_min_chunk);
+    size_t chunk = (n + nt - 1) / nt;
+
+    // Gather the keys in the current order and find the bits which differ between keys
+    std::vector<uint64_t> cur_keys(n);
+    std::vector<uint64_t> tmp_keys(n);
+    std::vector<unsigned int> tmp_order(n);
+
+    uint64_t diff = 0;
+#pragma omp parallel for num_threads(nt) reduction(| : diff)
+    for (int i = 0; i < (int)n; i++) {
+        cur_keys[i] = keys[order[i]];
+        diff |= cur_keys[i] ^ keys[order[0]];
+    }
+
+    std::vector<size_t> hist(nt * radix_buckets);
+
+    for (int shift = 0; shift < 64; shift += radix_bits) {
+        // Skip digits which are identical for all keys
+        if (((diff >> shift) & (radix_buckets - 1)) == 0)
+            continue;
+
+        // Per-chunk histograms of the current digit
+        std::fill(hist.begin(), hist.end(), 0);
+#pragma omp parallel for num_threads(nt) schedule(static, 1)
+        for (int t = 0; t < nt; t++) {
+            size_t* h = &hist[t * radix_buckets];
+            size_t end = std::min(n, (t + 1) * chunk);
+            for (size_t i = t * chunk; i < end; i++)
+                h[(cur_keys[i] >> shift) & (radix_buckets - 1)]++;
+        }
+
+        // Exclusive scan over (digit, chunk), so that each chunk writes its entries after those of previous chunks
+        size_t offset = 0;
+        for (int d = 0; d < radix_buckets; d++) {
+            for (int t = 0; t < nt; t++) {
+                size_t count = hist[t * radix_buckets + d];
+                hist[t * radix_buckets + d] = offset;
+                offset += count;
+            }
+        }
+
+        // Scatter (each chunk in order, which makes the sort stable)
+#pragma omp parallel for num_threads(nt) schedule(static, 1)
+        for (int t = 0; t < nt; t++) {
+            size_t* h = &hist[t * radix_buckets];
+            size_t end = std::min(n, (t + 1) * chunk);
+            for (size_t i = t * chunk; i < end; i++) {
+                size_t j = h[(cur_keys[i] >> shift) & (radix_buckets - 1)]++;
+                tmp_keys[j] = cur_keys[i];
+                tmp_order[j] = order[i];
+            }
+        }
+
+        cur_keys.swap(tmp_keys);
+        order.swap(tmp_order);
+    }
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,48 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Parallel stable radix sort of 64-bit integer keys
+//
+// =============================================================================
+
+#ifndef CH_RADIX_SORT_H
+#define CH_RADIX_SORT_H
+
+#include <cstdint>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Sort an index permutation by the associated 64-bit keys, using a stable least-significant-digit radix sort.
+/// On input, 'order' is either empty (in which case the identity permutation is assumed) or a permutation of the key
+/// indices. On output, 'order' is rearranged so that the sequence keys[order[i]] is non-decreasing, with the relative
+/// input order of entries with equal keys preserved. Because the sort is stable, a pair of keys can be sorted in
+/// lexicographic order with two calls: first with the secondary keys and then with the primary keys.\n
+/// The sort processes the keys one byte at a time, skipping bytes which are identical for all keys (so that small key
+/// values are cheap to sort). Large inputs are split in contiguous chunks processed by up to 'num_threads' OpenMP
+/// threads; the result does not depend on the number of threads.
+ChApi void RadixSort(const std::vector<uint64_t>& keys, std::vector<unsigned int>& order, int num_threads = 1);
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
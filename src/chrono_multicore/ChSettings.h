@@ -42,8 +42,14 @@ class collision_settings {
           bins_per_axis(vec3(10, 10, 10)),
           bin_size(real3(1, 1, 1)),
           grid_density(5),
+          large_shape_bins(4),
+          coarse_factor(8),
+          broadphase_incremental(false),
+          broadphase_margin(0),
+          broadphase_motion_steps(4),
           broadphase_grid(ChBroadphase::GridType::FIXED_RESOLUTION),
-          narrowphase_algorithm(ChNarrowphase::Algorithm::HYBRID) {}
+          narrowphase_algorithm(ChNarrowphase::Algorithm::HYBRID),
+          use_sphere_collider(false) {}
 
     /// For stability of NSC contact, the envelope should be set to 5-10% of the smallest collision shape size (too
     /// large a value will slow down the narrowphase collision detection). The envelope is the amount by which each
@@ -76,14 +82,38 @@ class collision_settings {
     real3 bin_size;
 
     /// Broadphase collision grid density. This value is used for dynamic tuning of the number of collision bins if the
-    /// `broadphase_grid` type is set to FIXED_DENSITY.
+    /// `broadphase_grid` type is set to FIXED_DENSITY or TWO_LEVEL.
     real grid_density;
 
+    /// Number of fine grid bins (in any direction) above which a shape is binned in the coarse grid.
+    /// This value is used only if the `broadphase_grid` type is set to TWO_LEVEL.
+    int large_shape_bins;
+
+    /// Ratio of coarse to fine grid bin size. This value is used only if the `broadphase_grid` type is set to
+    /// TWO_LEVEL.
+    int coarse_factor;
+
+    /// Flag controlling the use of the incremental (temporal coherence) broadphase.
+    /// If enabled, candidate pairs are kept across steps and only the shapes which leave their inflated AABB are
+    /// re-binned. Used only with a single-level grid and in the absence of fluid particles.
+    bool broadphase_incremental;
+
+    /// Minimum inflation margin of shape AABBs for the incremental broadphase.
+    real broadphase_margin;
+
+    /// Number of steps of current shape motion covered by the AABB inflation margin (incremental broadphase).
+    real broadphase_motion_steps;
+
     /// Algorithm for narrowphase collision detection phase.
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     ChNarrowphase::Algorithm narrowphase_algorithm;
+
+    /// Flag controlling the use of the specialized collision detection for systems with sphere shapes (default: false).
+    /// If enabled, this is used automatically whenever all but a small fraction of the collision shapes are spheres,
+    /// there are no 3-dof particles, and the narrowphase algorithm is not MPR (see ChSphereCollider).
+    bool use_sphere_collider;
 };
 
 /// Chrono::Multicore solver_settings.
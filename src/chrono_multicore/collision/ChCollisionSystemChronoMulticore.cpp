@@ -29,6 +29,7 @@ ChCollisionSystemChronoMulticore::ChCollisionSystemChronoMulticore(ChMulticoreDa
 
     broadphase.cd_data = cd_data;
     narrowphase.cd_data = cd_data;
+    spheres.cd_data = cd_data;
 
     // Store a pointer to the shared data structure in the data manager.
     data_manager->cd_data = cd_data;
@@ -74,7 +75,13 @@ void ChCollisionSystemChronoMulticore::PreProcess() {
     broadphase.grid_resolution = settings.bins_per_axis;
     broadphase.bin_size = settings.bin_size;
     broadphase.grid_density = settings.grid_density;
+    broadphase.large_shape_bins = settings.large_shape_bins;
+    broadphase.coarse_factor = settings.coarse_factor;
+    broadphase.incremental = settings.broadphase_incremental;
+    broadphase.fat_margin = settings.broadphase_margin;
+    broadphase.fat_steps = settings.broadphase_motion_steps;
     narrowphase.algorithm = settings.narrowphase_algorithm;
+    use_sphere_collider = settings.use_sphere_collider;
 }
 
 void ChCollisionSystemChronoMulticore::PostProcess() {
@@ -32,6 +32,7 @@
 #include "chrono_multicore/solver/ChSolverMulticore.h"
 #include "chrono_multicore/solver/ChSystemDescriptorMulticore.h"
 
+#include <algorithm>
 #include <numeric>
 
 namespace chrono {
@@ -579,6 +580,32 @@ void ChSystemMulticore::Setup() {
     assembly.m_num_bodies_fixed = 0;
 }
 
+void ChSystemMulticore::StateSnapshotOut(std::vector<char>& snapshot) {
+    // Between steps, the states of bodies and shafts are available in the Chrono objects, and are stored by the base
+    // class. Restore the counters of the Multicore system, overwritten by the base class setup.
+    ChSystem::StateSnapshotOut(snapshot);
+    Setup();
+
+    // Impulses of all constraints (contacts and bilaterals) from the last step
+    const DynamicVector<real>& gamma = data_manager->host_data.gamma;
+    uint64_t size = gamma.size();
+    SnapshotWrite(snapshot, &size, sizeof(size));
+    SnapshotWrite(snapshot, gamma.data(), size * sizeof(real));
+}
+
+void ChSystemMulticore::StateSnapshotIn(const std::vector<char>& snapshot, size_t& pos) {
+    // The data manager is loaded from the Chrono objects at the beginning of the next step (see Update).
+    ChSystem::StateSnapshotIn(snapshot, pos);
+    Setup();
+
+    // The impulses are only meaningful if the current constraints match those in the snapshot
+    DynamicVector<real>& gamma = data_manager->host_data.gamma;
+    uint64_t size;
+    SnapshotRead(snapshot, pos, &size, sizeof(size));
+    bool gamma_match = (size == gamma.size());
+    SnapshotRead(snapshot, pos, gamma_match ? gamma.data() : nullptr, size * sizeof(real));
+}
+
 void ChSystemMulticore::RecomputeThreads() {
 #ifdef _OPENMP
     timer_accumulator.insert(timer_accumulator.begin(), data_manager->system_timer.GetTime("step"));
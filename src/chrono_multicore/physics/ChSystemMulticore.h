@@ -193,6 +193,17 @@ class CH_MULTICORE_API ChSystemMulticore : public ChSystem {
     int current_threads;
 
   protected:
+    /// Append the state of the system to a binary state snapshot.
+    /// The state vectors of the bodies, shafts, and links are stored as in the base class, followed by the constraint
+    /// impulses (host_data.gamma) from the last step. Not included: 3-DOF particle and fluid nodes (node containers),
+    /// the collision detection data (contacts are regenerated at the next step), and any solver data derived in the
+    /// data manager. The impulses are not used to warm start the solver, which resets them at each step.
+    virtual void StateSnapshotOut(std::vector<char>& snapshot) override;
+
+    /// Load the state of the system from a binary state snapshot.
+    /// The constraint impulses are restored only if their number matches the current one.
+    virtual void StateSnapshotIn(const std::vector<char>& snapshot, size_t& pos) override;
+
     double old_timer, old_timer_cd;
     bool detect_optimal_threads;
 
@@ -264,6 +275,13 @@ class CH_MULTICORE_API ChSystemMulticoreSMC : public ChSystemMulticore {
     double GetTimerProcessContact() const {
         return data_manager->system_timer.GetTime("ChIterativeSolverMulticoreSMC_ProcessContact");
     }
+
+  protected:
+    /// Append the state of the system, including the contact shear history, to a binary state snapshot.
+    virtual void StateSnapshotOut(std::vector<char>& snapshot) override;
+
+    /// Load the state of the system, including the contact shear history, from a binary state snapshot.
+    virtual void StateSnapshotIn(const std::vector<char>& snapshot, size_t& pos) override;
 };
 
 /// @} multicore_physics
@@ -89,6 +89,35 @@ real3 ChSystemMulticoreSMC::GetBodyContactTorque(std::shared_ptr<ChBody> body) c
     return data_manager->host_data.ct_body_torque[index];
 }
 
+void ChSystemMulticoreSMC::StateSnapshotOut(std::vector<char>& snapshot) {
+    ChSystemMulticore::StateSnapshotOut(snapshot);
+
+    // Contact shear history (empty, unless using the MultiStep tangential displacement model)
+    const auto& hdata = data_manager->host_data;
+    uint64_t sizes[4] = {hdata.shear_neigh.size(), hdata.shear_disp.size(), hdata.contact_relvel_init.size(),
+                         hdata.contact_duration.size()};
+    SnapshotWrite(snapshot, sizes, sizeof(sizes));
+    SnapshotWrite(snapshot, hdata.shear_neigh.data(), sizes[0] * sizeof(vec3));
+    SnapshotWrite(snapshot, hdata.shear_disp.data(), sizes[1] * sizeof(real3));
+    SnapshotWrite(snapshot, hdata.contact_relvel_init.data(), sizes[2] * sizeof(real));
+    SnapshotWrite(snapshot, hdata.contact_duration.data(), sizes[3] * sizeof(real));
+}
+
+void ChSystemMulticoreSMC::StateSnapshotIn(const std::vector<char>& snapshot, size_t& pos) {
+    ChSystemMulticore::StateSnapshotIn(snapshot, pos);
+
+    auto& hdata = data_manager->host_data;
+    uint64_t sizes[4];
+    SnapshotRead(snapshot, pos, sizes, sizeof(sizes));
+    if (sizes[0] != hdata.shear_neigh.size() || sizes[1] != hdata.shear_disp.size() ||
+        sizes[2] != hdata.contact_relvel_init.size() || sizes[3] != hdata.contact_duration.size())
+        throw std::runtime_error("ChSystemMulticoreSMC::RestoreStateSnapshot: snapshot does not match the system");
+    SnapshotRead(snapshot, pos, hdata.shear_neigh.data(), sizes[0] * sizeof(vec3));
+    SnapshotRead(snapshot, pos, hdata.shear_disp.data(), sizes[1] * sizeof(real3));
+    SnapshotRead(snapshot, pos, hdata.contact_relvel_init.data(), sizes[2] * sizeof(real));
+    SnapshotRead(snapshot, pos, hdata.contact_duration.data(), sizes[3] * sizeof(real));
+}
+
 void ChSystemMulticoreSMC::PrintStepStats() {
     double timer_solver_stab = data_manager->system_timer.GetTime("ChIterativeSolverMulticore_Stab");
 
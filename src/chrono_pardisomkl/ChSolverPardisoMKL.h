@@ -65,7 +65,10 @@ class ChApiPardisoMKL ChSolverPardisoMKL : public ChDirectSolverLS {
     Eigen::PardisoLU<ChSparseMatrix>& GetMklEngine() { return m_engine; }
 
   private:
-    /// Factorize the current sparse matrix and return true if successful.
+    /// Perform the symbolic analysis of the current sparse matrix and return true if successful.
+    virtual bool AnalyzeMatrix() override;
+
+    /// Numerically factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
     /// Solve the linear system using the current factorization and right-hand side vector.
@@ -90,6 +90,7 @@ using namespace chrono;
 %shared_ptr(chrono::ChImplicitIterativeTimestepper)
 %shared_ptr(chrono::ChImplicitTimestepper)
 %shared_ptr(chrono::ChExplicitTimestepper)  
+%shared_ptr(chrono::ChAdaptiveTimestepper)
 
 %include "../../../chrono/timestepper/ChState.h"
 %include "../../../chrono/timestepper/ChIntegrable.h"
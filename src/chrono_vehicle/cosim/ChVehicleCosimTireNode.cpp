@@ -255,6 +255,7 @@ void ChVehicleCosimTireNode::InitializeSystem() {
             break;
         }
         case ChSolver::Type::PSOR:
+        case ChSolver::Type::PSOR_PARALLEL:
         case ChSolver::Type::PSSOR:
         case ChSolver::Type::PJACOBI:
         case ChSolver::Type::PMINRES:
@@ -196,6 +196,7 @@ void ChVehicleCosimTrackedMBSNode::InitializeSystem() {
             break;
         }
         case ChSolver::Type::PSOR:
+        case ChSolver::Type::PSOR_PARALLEL:
         case ChSolver::Type::PSSOR:
         case ChSolver::Type::PJACOBI:
         case ChSolver::Type::PMINRES:
@@ -220,6 +220,7 @@ void ChVehicleCosimWheeledMBSNode::InitializeSystem() {
             break;
         }
         case ChSolver::Type::PSOR:
+        case ChSolver::Type::PSOR_PARALLEL:
         case ChSolver::Type::PSSOR:
         case ChSolver::Type::PJACOBI:
         case ChSolver::Type::PMINRES:
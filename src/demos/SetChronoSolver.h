@@ -103,7 +103,8 @@ bool SetChronoSolver(chrono::ChSystem& sys,
             }
             case chrono::ChSolver::Type::BARZILAIBORWEIN:
             case chrono::ChSolver::Type::APGD:
-            case chrono::ChSolver::Type::PSOR: {
+            case chrono::ChSolver::Type::PSOR:
+            case chrono::ChSolver::Type::PSOR_PARALLEL: {
                 auto solver = std::static_pointer_cast<chrono::ChIterativeSolverVI>(sys.GetSolver());
                 solver->SetMaxIterations(100);
                 solver->SetOmega(0.8);
@@ -38,6 +38,8 @@
 
 using namespace chrono;
 
+// Settling test, with or without the specialized sphere collision detection (see ChSphereCollider).
+template <bool SPHERE_COLLIDER>
 class SettlingSMC : public utils::ChBenchmarkTest {
   public:
     SettlingSMC();
@@ -56,7 +58,8 @@ class SettlingSMC : public utils::ChBenchmarkTest {
     unsigned int m_num_particles;
 };
 
-SettlingSMC::SettlingSMC() : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
+template <bool SPHERE_COLLIDER>
+SettlingSMC<SPHERE_COLLIDER>::SettlingSMC() : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
     // Simulation parameters
     double gravity = 9.81;
 
@@ -72,6 +75,7 @@ SettlingSMC::SettlingSMC() : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
 
     m_system->GetSettings()->collision.narrowphase_algorithm = ChNarrowphase::Algorithm::HYBRID;
     m_system->GetSettings()->collision.bins_per_axis = vec3(10, 10, 1);
+    m_system->GetSettings()->collision.use_sphere_collider = SPHERE_COLLIDER;
 
     // The following two lines are optional, since they are the default options.
     m_system->GetSettings()->solver.contact_force_model = ChSystemSMC::ContactForceModel::Hertz;
@@ -131,7 +135,8 @@ SettlingSMC::SettlingSMC() : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
 }
 
 // Run settling simulation with visualization
-void SettlingSMC::SimulateVis() {
+template <bool SPHERE_COLLIDER>
+void SettlingSMC<SPHERE_COLLIDER>::SimulateVis() {
 #ifdef CHRONO_OPENGL
     opengl::ChVisualSystemOpenGL vis;
     vis.AttachSystem(m_system);
@@ -154,19 +159,24 @@ void SettlingSMC::SimulateVis() {
 #define NUM_SKIP_STEPS 500  // number of steps for hot start
 #define NUM_SIM_STEPS 500  // number of simulation steps for benchmarking
 
-using TEST_NAME = chrono::utils::ChBenchmarkFixture<SettlingSMC, 0>;
-BENCHMARK_DEFINE_F(TEST_NAME, Settle)(benchmark::State& st) {
-    Reset(NUM_SKIP_STEPS);
-    m_test->SetNumthreads((int)st.range(0));
+template <typename FIXTURE>
+void RunSettle(FIXTURE& fixture, benchmark::State& st) {
+    fixture.Reset(NUM_SKIP_STEPS);
+    fixture.m_test->SetNumthreads((int)st.range(0));
     while (st.KeepRunning()) {
-        m_test->Simulate(NUM_SIM_STEPS);
+        fixture.m_test->Simulate(NUM_SIM_STEPS);
     }
-    Report(st);
-    std::cout << "Simulated " << m_test->GetNumParticles() << " particles ";
+    fixture.Report(st);
+    std::cout << "Simulated " << fixture.m_test->GetNumParticles() << " particles ";
 #pragma omp parallel
 #pragma omp master
     std::cout << "using " << ChOMP::GetNumThreads() << " threads." << std::endl;
 }
+
+using TEST_NAME = chrono::utils::ChBenchmarkFixture<SettlingSMC<false>, 0>;
+BENCHMARK_DEFINE_F(TEST_NAME, Settle)(benchmark::State& st) {
+    RunSettle(*this, st);
+}
 BENCHMARK_REGISTER_F(TEST_NAME, Settle)
     ->Unit(benchmark::kMillisecond)
     ->Iterations(1)
@@ -174,6 +184,17 @@ BENCHMARK_REGISTER_F(TEST_NAME, Settle)
     ->UseRealTime()
     ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
 
+using TEST_NAME_SPHERES = chrono::utils::ChBenchmarkFixture<SettlingSMC<true>, 0>;
+BENCHMARK_DEFINE_F(TEST_NAME_SPHERES, Settle)(benchmark::State& st) {
+    RunSettle(*this, st);
+}
+BENCHMARK_REGISTER_F(TEST_NAME_SPHERES, Settle)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1)
+    ->Repetitions(1)
+    ->UseRealTime()
+    ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
@@ -181,7 +202,7 @@ int main(int argc, char* argv[]) {
 
 #ifdef CHRONO_IRRLICHT
     if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
-        SettlingSMC test;
+        SettlingSMC<true> test;
         test.SetNumthreads(8);
         test.SimulateVis();
         return 0;
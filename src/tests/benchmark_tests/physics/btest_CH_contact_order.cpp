@@ -0,0 +1,109 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark test for the cost of deterministic contact reporting.
+// A granular mixture settles in a box with multithreaded collision detection,
+// with and without sorting of the contacts reported by the collision system.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/core/ChRandom.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+template <ChCollisionSystem::Type CD_TYPE, bool DETERMINISTIC>
+class ContactOrderTest : public utils::ChBenchmarkTest {
+  public:
+    ContactOrderTest();
+    ~ContactOrderTest() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(m_step); }
+
+  private:
+    ChSystemNSC* m_system;
+    double m_step;
+};
+
+template <ChCollisionSystem::Type CD_TYPE, bool DETERMINISTIC>
+ContactOrderTest<CD_TYPE, DETERMINISTIC>::ContactOrderTest() : m_system(new ChSystemNSC()), m_step(1e-3) {
+    m_system->SetCollisionSystemType(CD_TYPE);
+    m_system->GetCollisionSystem()->SetDeterministic(DETERMINISTIC);
+    m_system->SetNumThreads(1, 4, 1);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    ChRandom::SetSeed(42);
+    for (int ix = 0; ix < 12; ix++) {
+        for (int iy = 0; iy < 12; iy++) {
+            for (int iz = 0; iz < 12; iz++) {
+                ChVector3d pos(-3.3 + 0.6 * ix, 0.5 + 0.6 * iy, -3.3 + 0.6 * iz);
+                pos += ChVector3d(ChRandom::Get(), ChRandom::Get(), ChRandom::Get()) * 0.05;
+                std::shared_ptr<ChBody> body;
+                if ((ix + iy + iz) % 2 == 0)
+                    body = chrono_types::make_shared<ChBodyEasySphere>(0.25, 1000, false, true, mat);
+                else
+                    body = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.4, 0.4, 1000, false, true, mat);
+                body->SetPos(pos);
+                m_system->AddBody(body);
+            }
+        }
+    }
+
+    auto floorBody = chrono_types::make_shared<ChBodyEasyBox>(8, 1, 8, 1000, false, true, mat);
+    floorBody->SetPos(ChVector3d(0, -0.5, 0));
+    floorBody->SetFixed(true);
+    m_system->AddBody(floorBody);
+
+    ChVector3d wall_size[] = {{1, 10, 8}, {1, 10, 8}, {8, 10, 1}, {8, 10, 1}};
+    ChVector3d wall_pos[] = {{-4.5, 5, 0}, {4.5, 5, 0}, {0, 5, -4.5}, {0, 5, 4.5}};
+    for (int i = 0; i < 4; i++) {
+        const auto& size = wall_size[i];
+        auto wallBody = chrono_types::make_shared<ChBodyEasyBox>(size.x(), size.y(), size.z(), 1000, false, true, mat);
+        wallBody->SetPos(wall_pos[i]);
+        wallBody->SetFixed(true);
+        m_system->AddBody(wallBody);
+    }
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 500  // number of steps for hot start
+#define NUM_SIM_STEPS 200   // number of simulation steps for each benchmark
+
+using BulletDefault = ContactOrderTest<ChCollisionSystem::Type::BULLET, false>;
+using BulletDeterministic = ContactOrderTest<ChCollisionSystem::Type::BULLET, true>;
+CH_BM_SIMULATION_LOOP(ContactOrder_Bullet_Default, BulletDefault, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ContactOrder_Bullet_Deterministic, BulletDeterministic, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
+#ifdef CHRONO_COLLISION
+using MulticoreDefault = ContactOrderTest<ChCollisionSystem::Type::MULTICORE, false>;
+using MulticoreDeterministic = ContactOrderTest<ChCollisionSystem::Type::MULTICORE, true>;
+CH_BM_SIMULATION_LOOP(ContactOrder_Multicore_Default, MulticoreDefault, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ContactOrder_Multicore_Deterministic, MulticoreDeterministic, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+#endif
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
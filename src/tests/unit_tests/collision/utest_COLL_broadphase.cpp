@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Chrono unit test for the broadphase grid of the multicore collision system.
+// Many small spheres and a few large spheres are placed at random. The pairs of overlapping spheres reported by the
+// collision system with single-level and two-level broadphase grids are compared with those found by brute force.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <random>
+#include <set>
+
+#include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+typedef std::set<std::pair<int, int>> PairSet;
+
+// Collect the pairs of bodies (identified by their index) in contact.
+class PairCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        int a = index.at(contactobjA);
+        int b = index.at(contactobjB);
+        pairs.insert(std::make_pair(std::min(a, b), std::max(a, b)));
+        return true;
+    }
+
+    std::map<ChContactable*, int> index;
+    PairSet pairs;
+};
+
+struct Sphere {
+    ChVector3d pos;
+    double radius;
+};
+
+static std::vector<Sphere> CreateSpheres() {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> pos(-2, 2);
+
+    std::vector<Sphere> spheres;
+    for (int i = 0; i < 1000; i++)
+        spheres.push_back({ChVector3d(pos(rng), pos(rng), pos(rng)), 0.08});
+    for (int i = 0; i < 4; i++)
+        spheres.push_back({ChVector3d(pos(rng), pos(rng), pos(rng)), 1.0});
+    return spheres;
+}
+
+static PairSet BruteForcePairs(const std::vector<Sphere>& spheres) {
+    PairSet pairs;
+    for (int i = 0; i < (int)spheres.size(); i++) {
+        for (int j = i + 1; j < (int)spheres.size(); j++) {
+            if ((spheres[i].pos - spheres[j].pos).Length() < spheres[i].radius + spheres[j].radius)
+                pairs.insert(std::make_pair(i, j));
+        }
+    }
+    return pairs;
+}
+
+// Find the pairs of overlapping spheres with the multicore collision system. The broadphase grid is configured by
+// the provided function.
+static PairSet CollisionPairs(const std::vector<Sphere>& spheres,
+                              std::function<void(ChCollisionSystemMulticore&)> configure,
+                              ChCollisionSystemMulticore::BroadphaseStats& stats) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, 0));
+    auto cs = std::static_pointer_cast<ChCollisionSystemMulticore>(sys.GetCollisionSystem());
+    cs->SetEnvelope(0);
+    configure(*cs);
+
+    auto collector = chrono_types::make_shared<PairCollector>();
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    for (int i = 0; i < (int)spheres.size(); i++) {
+        auto body = chrono_types::make_shared<ChBodyEasySphere>(spheres[i].radius, 1000, false, true, mat);
+        body->SetPos(spheres[i].pos);
+        sys.AddBody(body);
+        collector->index[body.get()] = i;
+    }
+
+    // Take a very small step to initialize the system and run the collision detection
+    sys.DoStepDynamics(1e-9);
+    sys.GetContactContainer()->ReportAllContacts(collector);
+    stats = cs->GetBroadphaseStats();
+
+    return collector->pairs;
+}
+
+TEST(ChCollisionSystemMulticore, broadphase_grid) {
+    auto spheres = CreateSpheres();
+    auto expected = BruteForcePairs(spheres);
+    ASSERT_GT(expected.size(), 100u);
+
+    ChCollisionSystemMulticore::BroadphaseStats stats;
+
+    // Single-level grid with fixed resolution
+    auto fixed_res = CollisionPairs(
+        spheres, [](ChCollisionSystemMulticore& cs) { cs.SetBroadphaseGridResolution(ChVector3i(20, 20, 20)); }, stats);
+    EXPECT_EQ(fixed_res, expected);
+    EXPECT_EQ(stats.num_bins, 8000u);
+    EXPECT_EQ(stats.num_large_shapes, 0u);
+    EXPECT_GE(stats.num_candidate_pairs, (unsigned int)expected.size());
+
+    // Single-level grid with fixed density
+    auto fixed_density = CollisionPairs(
+        spheres, [](ChCollisionSystemMulticore& cs) { cs.SetBroadphaseGridDensity(2); }, stats);
+    EXPECT_EQ(fixed_density, expected);
+    EXPECT_EQ(stats.num_large_shapes, 0u);
+    unsigned int single_level_intersections = stats.num_intersections;
+
+    // Two-level grid (the large spheres are binned in the coarse grid)
+    auto two_level = CollisionPairs(
+        spheres, [](ChCollisionSystemMulticore& cs) { cs.SetBroadphaseGridTwoLevel(2, 4, 8); }, stats);
+    EXPECT_EQ(two_level, expected);
+    EXPECT_EQ(stats.num_large_shapes, 4u);
+    EXPECT_GT(stats.num_coarse_active, 0u);
+    EXPECT_LT(stats.num_intersections, single_level_intersections);
+
+    // Two-level grid with most spheres binned in the coarse grid
+    auto two_level_coarse = CollisionPairs(
+        spheres, [](ChCollisionSystemMulticore& cs) { cs.SetBroadphaseGridTwoLevel(2, 1, 2); }, stats);
+    EXPECT_EQ(two_level_coarse, expected);
+    EXPECT_GT(stats.num_large_shapes, 4u);
+}
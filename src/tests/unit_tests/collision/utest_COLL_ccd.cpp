@@ -0,0 +1,97 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for continuous collision detection (speculative contacts).
+// A small sphere is shot at a thin fixed box with a velocity such that it travels many times the box thickness in one
+// step, and never overlaps the box at the end of a step. Without CCD, the sphere tunnels through the box; with CCD
+// enabled, the speculative contacts stop it in front of the box (NSC contact method).
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const double wall_thickness = 0.02;
+static const double radius = 0.05;
+static const double speed = 50;
+static const double step_size = 1e-2;
+static const int num_steps = 10;
+
+struct ShotResult {
+    double x;                  // final sphere position along the shot direction
+    double vx;                 // final sphere velocity along the shot direction
+    unsigned int speculative;  // total number of speculative contacts
+};
+
+static ShotResult Shoot(ChCollisionSystem::Type type, bool ccd, double offset) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(type);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, 0));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetRestitution(0);
+
+    auto wall = chrono_types::make_shared<ChBodyEasyBox>(wall_thickness, 2, 2, 1000, false, true, mat);
+    wall->SetFixed(true);
+    sys.AddBody(wall);
+
+    auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+    ball->SetPos(ChVector3d(-1.25, offset, 0));
+    ball->SetPosDt(ChVector3d(speed, 0, 0));
+    if (ccd)
+        ball->EnableCCD(radius);
+    sys.AddBody(ball);
+
+    ShotResult result;
+    result.speculative = 0;
+    for (int i = 0; i < num_steps; i++) {
+        sys.DoStepDynamics(step_size);
+        result.speculative += sys.GetCollisionSystem()->GetNumSpeculativeContacts();
+    }
+    result.x = ball->GetPos().x();
+    result.vx = ball->GetPosDt().x();
+
+    return result;
+}
+
+static void CheckTunneling(ChCollisionSystem::Type type) {
+    for (double offset : {0.0, 0.5}) {
+        // Without CCD, the sphere passes through the box
+        auto no_ccd = Shoot(type, false, offset);
+        EXPECT_GT(no_ccd.x, wall_thickness / 2 + radius);
+        EXPECT_EQ(no_ccd.speculative, 0u);
+
+        // With CCD, the sphere is stopped in front of the box
+        auto with_ccd = Shoot(type, true, offset);
+        EXPECT_GT(with_ccd.speculative, 0u);
+        EXPECT_LT(with_ccd.x, -wall_thickness / 2);
+        EXPECT_GT(with_ccd.x, -wall_thickness / 2 - radius - 1e-2);
+        EXPECT_LT(with_ccd.vx, 1e-3);
+    }
+}
+
+TEST(ChCollisionSystemBullet, ccd_tunneling) {
+    CheckTunneling(ChCollisionSystem::Type::BULLET);
+}
+
+#ifdef CHRONO_COLLISION
+TEST(ChCollisionSystemMulticore, ccd_tunneling) {
+    CheckTunneling(ChCollisionSystem::Type::MULTICORE);
+}
+#endif
@@ -0,0 +1,134 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for deterministic contact reporting (ChCollisionSystem::SetDeterministic).
+// A pile of boxes and spheres is simulated with different numbers of collision detection threads. With deterministic
+// contact reporting, the contacts must be reported in the same order and the simulation results must be identical
+// (bit by bit) for any number of threads.
+//
+// =============================================================================
+
+#include <map>
+
+#include "chrono/ChConfig.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Contact data, as reported by the contact container
+struct ContactRecord {
+    int bodyA;
+    int bodyB;
+    ChVector3d pA;
+    ChVector3d pB;
+    double distance;
+
+    bool operator==(const ContactRecord& other) const {
+        return bodyA == other.bodyA && bodyB == other.bodyB && pA == other.pA && pB == other.pB &&
+               distance == other.distance;
+    }
+};
+
+class ContactRecorder : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        contacts.push_back({index.at(contactobjA), index.at(contactobjB), pA, pB, distance});
+        return true;
+    }
+
+    std::map<ChContactable*, int> index;
+    std::vector<ContactRecord> contacts;
+};
+
+struct OrderResult {
+    std::vector<ContactRecord> contacts;  // contacts at the end of the simulation, in reporting order
+    std::vector<ChVector3d> positions;    // final body positions
+};
+
+static OrderResult Simulate(ChCollisionSystem::Type type, int num_threads) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(type);
+    sys.GetCollisionSystem()->SetDeterministic(true);
+    sys.SetNumThreads(1, num_threads, 1);
+
+    auto recorder = chrono_types::make_shared<ContactRecorder>();
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(6, 1, 6, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+    recorder->index[ground.get()] = 0;
+
+    for (int ix = 0; ix < 6; ix++) {
+        for (int iy = 0; iy < 4; iy++) {
+            for (int iz = 0; iz < 6; iz++) {
+                std::shared_ptr<ChBody> body;
+                if ((ix + iy + iz) % 2)
+                    body = chrono_types::make_shared<ChBodyEasySphere>(0.25, 1000, false, true, mat);
+                else
+                    body = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.4, 0.4, 1000, false, true, mat);
+                body->SetPos(ChVector3d(-1.5 + 0.6 * ix + 0.01 * iy, 0.3 + 0.55 * iy, -1.5 + 0.6 * iz + 0.01 * ix));
+                sys.AddBody(body);
+                recorder->index[body.get()] = (int)sys.GetBodies().size() - 1;
+            }
+        }
+    }
+
+    for (int i = 0; i < 100; i++)
+        sys.DoStepDynamics(2e-3);
+
+    OrderResult result;
+    sys.GetContactContainer()->ReportAllContacts(recorder);
+    result.contacts = recorder->contacts;
+    for (const auto& body : sys.GetBodies())
+        result.positions.push_back(body->GetPos());
+
+    return result;
+}
+
+static void CheckOrder(ChCollisionSystem::Type type) {
+    auto reference = Simulate(type, 1);
+    ASSERT_GT(reference.contacts.size(), 100u);
+
+    for (int num_threads : {2, 4}) {
+        auto result = Simulate(type, num_threads);
+        ASSERT_EQ(result.contacts.size(), reference.contacts.size());
+        for (size_t i = 0; i < reference.contacts.size(); i++)
+            ASSERT_TRUE(result.contacts[i] == reference.contacts[i]) << "contact " << i << " threads " << num_threads;
+        for (size_t i = 0; i < reference.positions.size(); i++)
+            ASSERT_EQ(result.positions[i], reference.positions[i]) << "body " << i << " threads " << num_threads;
+    }
+}
+
+TEST(ChCollisionSystemBullet, deterministic_contact_order) {
+    CheckOrder(ChCollisionSystem::Type::BULLET);
+}
+
+#ifdef CHRONO_COLLISION
+TEST(ChCollisionSystemMulticore, deterministic_contact_order) {
+    CheckOrder(ChCollisionSystem::Type::MULTICORE);
+}
+#endif
@@ -0,0 +1,140 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Chrono unit test for the triangle mesh BVH of the multicore collision system.
+// The triangles returned by BVH queries are compared with those found by brute force (testing the AABB of every
+// triangle), for random triangle soups and random query boxes.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <random>
+
+#include "chrono/collision/multicore/ChCollisionData.h"
+#include "chrono/collision/multicore/ChCollisionUtils.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::mc_utils;
+
+// Create a triangle soup with triangles of random size and orientation in the box [-10,10]^3.
+static std::vector<real3> CreateTriangles(int num_triangles, std::mt19937& rng) {
+    std::uniform_real_distribution<double> center(-10, 10);
+    std::uniform_real_distribution<double> offset(-1, 1);
+
+    std::vector<real3> triangles;
+    for (int i = 0; i < num_triangles; i++) {
+        real3 c(center(rng), center(rng), center(rng));
+        for (int k = 0; k < 3; k++)
+            triangles.push_back(c + real3(offset(rng), offset(rng), offset(rng)));
+    }
+    return triangles;
+}
+
+// Find the triangles with an AABB overlapping the given box by testing all triangles.
+static std::vector<int> BruteForceQuery(const std::vector<real3>& triangles,
+                                        const real3& aabb_min,
+                                        const real3& aabb_max) {
+    std::vector<int> list;
+    for (int i = 0; i < (int)triangles.size() / 3; i++) {
+        const real3& A = triangles[3 * i + 0];
+        const real3& B = triangles[3 * i + 1];
+        const real3& C = triangles[3 * i + 2];
+        real3 tmin = Min(Min(A, B), C);
+        real3 tmax = Max(Max(A, B), C);
+        if (tmin.x <= aabb_max.x && tmin.y <= aabb_max.y && tmin.z <= aabb_max.z && tmax.x >= aabb_min.x &&
+            tmax.y >= aabb_min.y && tmax.z >= aabb_min.z)
+            list.push_back(i);
+    }
+    return list;
+}
+
+static void CheckBVH(int num_triangles, int max_leaf_size) {
+    std::mt19937 rng(42 + num_triangles + max_leaf_size);
+    auto triangles = CreateTriangles(num_triangles, rng);
+    auto original = triangles;
+
+    std::vector<bvh_node> nodes;
+    BuildTriangleMeshBVH(triangles, nodes, max_leaf_size);
+    ASSERT_EQ(triangles.size(), original.size());
+    ASSERT_FALSE(nodes.empty());
+
+    // The leaves cover every triangle exactly once, and each node AABB contains its triangles
+    std::vector<int> leaf_count(num_triangles, 0);
+    for (const auto& node : nodes) {
+        if (node.count == 0)
+            continue;
+        ASSERT_LE(node.count, max_leaf_size);
+        for (int i = node.left; i < node.left + node.count; i++) {
+            leaf_count[i]++;
+            for (int k = 0; k < 3; k++) {
+                const real3& v = triangles[3 * i + k];
+                ASSERT_TRUE(v.x >= node.aabb_min.x && v.y >= node.aabb_min.y && v.z >= node.aabb_min.z);
+                ASSERT_TRUE(v.x <= node.aabb_max.x && v.y <= node.aabb_max.y && v.z <= node.aabb_max.z);
+            }
+        }
+    }
+    for (int i = 0; i < num_triangles; i++)
+        ASSERT_EQ(leaf_count[i], 1);
+
+    // The triangles are only reordered
+    auto less = [](const real3& a, const real3& b) {
+        return a.x < b.x || (a.x == b.x && (a.y < b.y || (a.y == b.y && a.z < b.z)));
+    };
+    auto sorted = triangles;
+    std::sort(sorted.begin(), sorted.end(), less);
+    std::sort(original.begin(), original.end(), less);
+    ASSERT_TRUE(sorted == original);
+
+    // Queries with boxes of various sizes (including boxes containing all or none of the triangles)
+    std::uniform_real_distribution<double> center(-12, 12);
+    std::uniform_real_distribution<double> size(0, 4);
+    std::vector<int> list(num_triangles);
+    for (int q = 0; q < 200; q++) {
+        real3 c(center(rng), center(rng), center(rng));
+        real3 h(size(rng), size(rng), size(rng));
+        if (q == 0)
+            h = real3(100);
+        real3 aabb_min = c - h;
+        real3 aabb_max = c + h;
+
+        auto expected = BruteForceQuery(triangles, aabb_min, aabb_max);
+        int count = QueryTriangleMeshBVH(nodes.data(), triangles.data(), aabb_min, aabb_max, list.data());
+        ASSERT_EQ(count, (int)expected.size());
+        ASSERT_EQ(QueryTriangleMeshBVH(nodes.data(), triangles.data(), aabb_min, aabb_max, nullptr), count);
+
+        std::vector<int> found(list.begin(), list.begin() + count);
+        std::sort(found.begin(), found.end());
+        ASSERT_EQ(found, expected);
+    }
+}
+
+TEST(ChCollisionUtilsBVH, single_triangle) {
+    CheckBVH(1, 4);
+}
+
+TEST(ChCollisionUtilsBVH, brute_force) {
+    for (int max_leaf_size : {1, 4, 8}) {
+        CheckBVH(100, max_leaf_size);
+        CheckBVH(1000, max_leaf_size);
+    }
+}
+
+TEST(ChCollisionUtilsBVH, empty) {
+    std::vector<real3> triangles;
+    std::vector<bvh_node> nodes;
+    BuildTriangleMeshBVH(triangles, nodes);
+    ASSERT_TRUE(nodes.empty());
+}
@@ -0,0 +1,263 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for signed distance field collision shapes (ChSignedDistanceField and ChCollisionShapeSDF).
+// The distance fields of box and sphere meshes are compared with the analytical signed distance functions, and the
+// contacts between a distance field shape and a sphere are compared with the analytical penetration depth.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+#include "chrono/ChConfig.h"
+#include "chrono/collision/ChCollisionShapeSDF.h"
+#include "chrono/collision/ChSignedDistanceField.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const ChVector3d box_hdims(0.5, 0.3, 0.2);
+static const double sphere_radius = 0.4;
+
+// Closed box mesh (outward normals).
+static ChTriangleMeshConnected CreateBoxMesh(const ChVector3d& hdims) {
+    ChTriangleMeshConnected mesh;
+    auto& vertices = mesh.GetCoordsVertices();
+    for (int i = 0; i < 8; i++)
+        vertices.push_back(ChVector3d((i & 1) ? hdims.x() : -hdims.x(), (i & 2) ? hdims.y() : -hdims.y(),
+                                      (i & 4) ? hdims.z() : -hdims.z()));
+    mesh.GetIndicesVertexes() = {{0, 2, 3}, {0, 3, 1}, {4, 5, 7}, {4, 7, 6}, {0, 1, 5}, {0, 5, 4},
+                                 {2, 6, 7}, {2, 7, 3}, {0, 4, 6}, {0, 6, 2}, {1, 3, 7}, {1, 7, 5}};
+    return mesh;
+}
+
+// Closed UV sphere mesh (outward normals).
+static ChTriangleMeshConnected CreateSphereMesh(double radius, int num_slices, int num_stacks) {
+    ChTriangleMeshConnected mesh;
+    auto& vertices = mesh.GetCoordsVertices();
+    auto& faces = mesh.GetIndicesVertexes();
+    vertices.push_back(ChVector3d(0, 0, radius));
+    for (int j = 1; j < num_stacks; j++) {
+        double theta = CH_PI * j / num_stacks;
+        for (int i = 0; i < num_slices; i++) {
+            double phi = CH_2PI * i / num_slices;
+            vertices.push_back(radius * ChVector3d(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi),
+                                                   std::cos(theta)));
+        }
+    }
+    vertices.push_back(ChVector3d(0, 0, -radius));
+    int south = (int)vertices.size() - 1;
+
+    auto ring = [num_slices](int j, int i) { return 1 + (j - 1) * num_slices + (i % num_slices); };
+    for (int i = 0; i < num_slices; i++) {
+        faces.push_back(ChVector3i(0, ring(1, i), ring(1, i + 1)));
+        for (int j = 1; j < num_stacks - 1; j++) {
+            faces.push_back(ChVector3i(ring(j, i), ring(j + 1, i), ring(j + 1, i + 1)));
+            faces.push_back(ChVector3i(ring(j, i), ring(j + 1, i + 1), ring(j, i + 1)));
+        }
+        faces.push_back(ChVector3i(south, ring(num_stacks - 1, i + 1), ring(num_stacks - 1, i)));
+    }
+    return mesh;
+}
+
+// Analytical signed distance to a box.
+static double BoxDistance(const ChVector3d& p, const ChVector3d& hdims) {
+    ChVector3d q(std::abs(p.x()) - hdims.x(), std::abs(p.y()) - hdims.y(), std::abs(p.z()) - hdims.z());
+    ChVector3d outside(std::max(q.x(), 0.0), std::max(q.y(), 0.0), std::max(q.z(), 0.0));
+    return outside.Length() + std::min(std::max(q.x(), std::max(q.y(), q.z())), 0.0);
+}
+
+// Compare the distance field with the analytical distance function at random points within the narrow band.
+template <typename Function>
+static void CheckField(const ChSignedDistanceField& field, Function exact, double tolerance) {
+    std::mt19937 rng(11);
+    ChAABB aabb = field.GetBoundingBox();
+    std::uniform_real_distribution<double> ux(aabb.min.x(), aabb.max.x());
+    std::uniform_real_distribution<double> uy(aabb.min.y(), aabb.max.y());
+    std::uniform_real_distribution<double> uz(aabb.min.z(), aabb.max.z());
+
+    // Points at which all nodes of the enclosing cell hold exact distances
+    double exact_band = field.GetBandWidth() - std::sqrt(3.0) * field.GetCellSize();
+    int num_tested = 0;
+    for (int k = 0; k < 20000; k++) {
+        ChVector3d p(ux(rng), uy(rng), uz(rng));
+        double d_exact = exact(p);
+        double dist;
+        ChVector3d grad;
+        bool in_band = field.Evaluate(p, dist, grad);
+        if (std::abs(d_exact) < exact_band) {
+            ASSERT_TRUE(in_band);
+            ASSERT_NEAR(dist, d_exact, tolerance);
+            num_tested++;
+        } else if (!in_band) {
+            // Outside the narrow band, the field holds the band width, with the sign of the exact distance
+            ASSERT_FLOAT_EQ(std::abs(dist), field.GetBandWidth());
+            ASSERT_EQ(dist > 0, d_exact > 0);
+            ASSERT_TRUE(grad == VNULL);
+        }
+    }
+    ASSERT_GT(num_tested, 1000);
+
+    // Points outside the grid
+    double dist;
+    ChVector3d grad;
+    ASSERT_FALSE(field.Evaluate(aabb.max + ChVector3d(1, 1, 1), dist, grad));
+    ASSERT_FLOAT_EQ(dist, field.GetBandWidth());
+}
+
+TEST(ChSignedDistanceField, box) {
+    double cell_size = 0.02;
+    ChSignedDistanceField field;
+    field.Build(CreateBoxMesh(box_hdims), cell_size, 4);
+    ASSERT_FALSE(field.IsEmpty());
+    ASSERT_GT(field.GetNumActiveBricks(), 0u);
+
+    // Nodal distances are exact and interpolation is exact where the distance function is linear (away from the box
+    // edges and corners); allow for the nonlinearity near edges and for the single precision storage.
+    CheckField(field, [](const ChVector3d& p) { return BoxDistance(p, box_hdims); }, 0.25 * cell_size);
+
+    // Interpolated gradient at points close to the faces
+    double dist;
+    ChVector3d grad;
+    ASSERT_TRUE(field.Evaluate(ChVector3d(0.1, 0.05, box_hdims.z() + 0.013), dist, grad));
+    ASSERT_NEAR(dist, 0.013, 1e-5);
+    ASSERT_NEAR((grad - ChVector3d(0, 0, 1)).Length(), 0, 1e-4);
+    ASSERT_TRUE(field.Evaluate(ChVector3d(-box_hdims.x() + 0.031, 0.02, -0.01), dist, grad));
+    ASSERT_NEAR(dist, -0.031, 1e-5);
+    ASSERT_NEAR((grad - ChVector3d(-1, 0, 0)).Length(), 0, 1e-4);
+}
+
+TEST(ChSignedDistanceField, sphere) {
+    double cell_size = 0.02;
+    int num_slices = 64;
+    ChSignedDistanceField field;
+    field.Build(CreateSphereMesh(sphere_radius, num_slices, num_slices / 2), cell_size, 4);
+
+    // Tolerance: mesh tessellation error plus interpolation of a curved distance function
+    double tessellation = sphere_radius * (1 - std::cos(CH_PI / num_slices));
+    CheckField(field, [](const ChVector3d& p) { return p.Length() - sphere_radius; }, tessellation + 0.1 * cell_size);
+
+    // The gradient points along the radial direction
+    ChVector3d dir = ChVector3d(1, 2, -0.5).GetNormalized();
+    double dist;
+    ChVector3d grad;
+    ASSERT_TRUE(field.Evaluate((sphere_radius + 0.02) * dir, dist, grad));
+    ASSERT_NEAR(dist, 0.02, tessellation + 0.1 * cell_size);
+    ASSERT_NEAR((grad.GetNormalized() - dir).Length(), 0, 0.05);
+}
+
+TEST(ChSignedDistanceField, cache) {
+    auto mesh = CreateBoxMesh(box_hdims);
+    std::string filename = "sdf_cache_test.dat";
+    std::remove(filename.c_str());
+
+    // The first call builds the field and writes the cache file; the second loads the field from the cache
+    auto field1 = ChSignedDistanceField::CreateFromMesh(mesh, 0.05, 3, filename);
+    auto field2 = ChSignedDistanceField::CreateFromMesh(mesh, 0.05, 3, filename);
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(field1->GetNumBricks(), field2->GetNumBricks());
+    ASSERT_EQ(field1->GetNumActiveBricks(), field2->GetNumActiveBricks());
+    ASSERT_EQ(field1->GetSurfacePoints().size(), field2->GetSurfacePoints().size());
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> u(-0.8, 0.8);
+    for (int k = 0; k < 1000; k++) {
+        ChVector3d p(u(rng), u(rng), u(rng));
+        ASSERT_EQ(field1->GetDistance(p), field2->GetDistance(p));
+    }
+}
+
+// Penetration depth between a fixed distance field shape and a sphere body, placed at the given location.
+// Return the minimum contact distance reported (or 1 if no contacts).
+static double ContactDistance(ChCollisionSystem::Type type,
+                              std::shared_ptr<ChSignedDistanceField> field,
+                              const ChVector3d& sphere_pos,
+                              double radius) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(type);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, 0));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto fixed = chrono_types::make_shared<ChBody>();
+    fixed->SetFixed(true);
+    fixed->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSDF>(mat, field));
+    fixed->EnableCollision(true);
+    sys.AddBody(fixed);
+
+    auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+    ball->SetPos(sphere_pos);
+    sys.AddBody(ball);
+
+    class DistanceCollector : public ChContactContainer::ReportContactCallback {
+      public:
+        virtual bool OnReportContact(const ChVector3d& pA,
+                                     const ChVector3d& pB,
+                                     const ChMatrix33<>& plane_coord,
+                                     const double& distance,
+                                     const double& eff_radius,
+                                     const ChVector3d& react_forces,
+                                     const ChVector3d& react_torques,
+                                     ChContactable* contactobjA,
+                                     ChContactable* contactobjB) override {
+            min_distance = std::min(min_distance, distance);
+            return true;
+        }
+        double min_distance = 1;
+    };
+
+    sys.DoStepDynamics(1e-9);
+    auto collector = chrono_types::make_shared<DistanceCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+
+    return collector->min_distance;
+}
+
+static void CheckContacts(ChCollisionSystem::Type type) {
+    double cell_size = 0.02;
+    double radius = 0.1;
+
+    auto box = chrono_types::make_shared<ChSignedDistanceField>();
+    box->Build(CreateBoxMesh(box_hdims), cell_size, 4);
+
+    // Sphere penetrating the top face, the side face, and separated from the box
+    EXPECT_NEAR(ContactDistance(type, box, ChVector3d(0.1, 0, box_hdims.z() + radius - 0.02), radius), -0.02, 2e-3);
+    EXPECT_NEAR(ContactDistance(type, box, ChVector3d(box_hdims.x() + radius - 0.03, 0.1, 0), radius), -0.03, 2e-3);
+    EXPECT_EQ(ContactDistance(type, box, ChVector3d(0, 0, box_hdims.z() + radius + 0.2), radius), 1);
+
+    int num_slices = 64;
+    auto sphere = chrono_types::make_shared<ChSignedDistanceField>();
+    sphere->Build(CreateSphereMesh(sphere_radius, num_slices, num_slices / 2), cell_size, 4);
+    double tessellation = sphere_radius * (1 - std::cos(CH_PI / num_slices));
+
+    // Sphere penetrating the sphere
+    ChVector3d dir = ChVector3d(1, -1, 2).GetNormalized();
+    EXPECT_NEAR(ContactDistance(type, sphere, (sphere_radius + radius - 0.025) * dir, radius), -0.025,
+                2e-3 + tessellation);
+}
+
+TEST(ChCollisionShapeSDF, contacts_bullet) {
+    CheckContacts(ChCollisionSystem::Type::BULLET);
+}
+
+#ifdef CHRONO_COLLISION
+TEST(ChCollisionShapeSDF, contacts_multicore) {
+    CheckContacts(ChCollisionSystem::Type::MULTICORE);
+}
+#endif
@@ -20,6 +20,8 @@
 
 #include "gtest/gtest.h"
 
+#include <cmath>
+#include <sstream>
 #include <typeinfo>
 
 #include "chrono/serialization/ChArchive.h"
@@ -575,3 +577,108 @@ TEST(ChArchiveJSON, ChVectorDynamicTest) {
     ASSERT_DOUBLE_EQ(myVect_before.y(), myVect.y());
     ASSERT_DOUBLE_EQ(myVect_before.z(), myVect.z());
 }
+
+// Binary archives which serialize all arrays element by element (no raw memory blocks)
+class ChArchiveOutBinaryPerElement : public ChArchiveOutBinary {
+  public:
+    ChArchiveOutBinaryPerElement(std::ostream& stream_out) : ChArchiveOutBinary(stream_out) {}
+    virtual bool out_array_raw(ChValue&, const void*, size_t, size_t) override { return false; }
+};
+
+class ChArchiveInBinaryPerElement : public ChArchiveInBinary {
+  public:
+    ChArchiveInBinaryPerElement(std::istream& stream_in) : ChArchiveInBinary(stream_in) {}
+    virtual bool in_array_raw(const std::string&, void*, size_t, size_t) override { return false; }
+};
+
+struct RawArrays {
+    std::vector<double> doubles;
+    std::vector<int> ints;
+    std::vector<ChVector3d> vectors;
+    std::vector<ChQuaterniond> quaternions;
+    ChMatrixDynamic<> matrix;
+    ChVectorDynamic<> vector;
+    ChMatrix33<> matrix33;
+};
+
+static RawArrays CreateRawArrays() {
+    RawArrays arrays;
+    for (int i = 0; i < 100; i++) {
+        arrays.doubles.push_back(std::sin(i) * 1e3);
+        arrays.ints.push_back(i * i - 50);
+        arrays.vectors.push_back(ChVector3d(i, -0.1 * i, std::cos(i)));
+    }
+    arrays.quaternions = {QUNIT, ChQuaterniond(0.5, 0.5, -0.5, 0.5), QuatFromAngleZ(0.3)};
+    arrays.matrix.resize(7, 5);
+    for (int i = 0; i < arrays.matrix.size(); i++)
+        arrays.matrix(i) = 1.0 / (i + 1);
+    arrays.vector = ChVectorDynamic<>::LinSpaced(9, -2, 2);
+    arrays.matrix33 = ChMatrix33<>(QuatFromAngleX(0.7));
+    return arrays;
+}
+
+template <class ArchiveOut>
+static std::string WriteRawArrays(RawArrays& arrays, bool use_versions, bool cluster_versions) {
+    std::ostringstream stream;
+    ArchiveOut archive_out(stream);
+    archive_out.SetUseVersions(use_versions);
+    archive_out.SetClusterClassVersions(cluster_versions);
+    archive_out << CHNVP(arrays.doubles, "doubles") << CHNVP(arrays.ints, "ints")
+                << CHNVP(arrays.vectors, "vectors") << CHNVP(arrays.quaternions, "quaternions")
+                << CHNVP(arrays.matrix, "matrix") << CHNVP(arrays.vector, "vector")
+                << CHNVP(arrays.matrix33, "matrix33");
+    return stream.str();
+}
+
+template <class ArchiveIn>
+static RawArrays ReadRawArrays(const std::string& data, bool use_versions, bool cluster_versions) {
+    std::istringstream stream(data);
+    ArchiveIn archive_in(stream);
+    archive_in.SetUseVersions(use_versions);
+    archive_in.SetClusterClassVersions(cluster_versions);
+    RawArrays arrays;
+    archive_in >> CHNVP(arrays.doubles, "doubles") >> CHNVP(arrays.ints, "ints") >> CHNVP(arrays.vectors, "vectors") >>
+        CHNVP(arrays.quaternions, "quaternions") >> CHNVP(arrays.matrix, "matrix") >> CHNVP(arrays.vector, "vector") >>
+        CHNVP(arrays.matrix33, "matrix33");
+    return arrays;
+}
+
+static void CheckRawArrays(const RawArrays& expected, const RawArrays& arrays) {
+    ASSERT_EQ(arrays.doubles, expected.doubles);
+    ASSERT_EQ(arrays.ints, expected.ints);
+    ASSERT_EQ(arrays.vectors, expected.vectors);
+    ASSERT_EQ(arrays.quaternions.size(), expected.quaternions.size());
+    for (size_t i = 0; i < expected.quaternions.size(); i++)
+        ASSERT_TRUE(arrays.quaternions[i] == expected.quaternions[i]);
+    ASSERT_EQ(arrays.matrix.rows(), expected.matrix.rows());
+    ASSERT_EQ(arrays.matrix.cols(), expected.matrix.cols());
+    ASSERT_TRUE(arrays.matrix == expected.matrix);
+    ASSERT_EQ(arrays.vector.size(), expected.vector.size());
+    ASSERT_TRUE(arrays.vector == expected.vector);
+    ASSERT_TRUE(arrays.matrix33 == expected.matrix33);
+}
+
+// Arrays written as raw memory blocks must be byte-identical to arrays written element by element, and archives
+// written either way must be readable either way, with and without (clustered) class versions.
+TEST(ChArchiveBinary, RawArrays) {
+    RawArrays arrays = CreateRawArrays();
+
+    for (bool use_versions : {true, false}) {
+        for (bool cluster_versions : {true, false}) {
+            SCOPED_TRACE("use_versions=" + std::to_string(use_versions) +
+                         " cluster_versions=" + std::to_string(cluster_versions));
+
+            auto raw = WriteRawArrays<ChArchiveOutBinary>(arrays, use_versions, cluster_versions);
+            auto per_element = WriteRawArrays<ChArchiveOutBinaryPerElement>(arrays, use_versions, cluster_versions);
+            ASSERT_EQ(raw, per_element);
+
+            CheckRawArrays(arrays, ReadRawArrays<ChArchiveInBinary>(raw, use_versions, cluster_versions));
+            CheckRawArrays(arrays, ReadRawArrays<ChArchiveInBinaryPerElement>(raw, use_versions, cluster_versions));
+            CheckRawArrays(arrays, ReadRawArrays<ChArchiveInBinary>(per_element, use_versions, cluster_versions));
+
+            // Writing the arrays read back gives the same bytes
+            auto arrays_in = ReadRawArrays<ChArchiveInBinary>(raw, use_versions, cluster_versions);
+            ASSERT_EQ(WriteRawArrays<ChArchiveOutBinary>(arrays_in, use_versions, cluster_versions), raw);
+        }
+    }
+}
@@ -0,0 +1,195 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for adaptive step size control (ChAdaptiveTimestepper).
+// A damped linear oscillator is integrated with the Euler linearized and Newmark timesteppers, with and without step
+// size control, and compared with the analytical solution; tighter tolerances must give smaller errors with more
+// steps. With (emulated) unilateral constraints, each call to Advance must take a single step.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/timestepper/ChTimestepper.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Damped oscillator M*x'' + R*x' + K*x = 0, with x(0) = 1 and x'(0) = 0
+class DampedOscillator : public ChIntegrableIIorder {
+  public:
+    DampedOscillator(bool unilateral = false) : unilateral(unilateral), T(0), x(1), v(0), a(0) {}
+
+    static constexpr double M = 1;
+    static constexpr double K = 30;
+    static constexpr double R = 2;
+
+    // Analytical solution (underdamped)
+    static double Position(double t) {
+        double wn = std::sqrt(K / M);
+        double zeta = R / (2 * std::sqrt(K * M));
+        double wd = wn * std::sqrt(1 - zeta * zeta);
+        return std::exp(-zeta * wn * t) * (std::cos(wd * t) + zeta * wn / wd * std::sin(wd * t));
+    }
+
+    virtual unsigned int GetNumCoordsPosLevel() override { return 1; }
+    virtual unsigned int GetNumCoordsVelLevel() override { return 1; }
+    virtual unsigned int GetNumConstraintsUnilateral() override { return unilateral ? 1 : 0; }
+
+    virtual void StateGather(ChState& y, ChStateDelta& dy, double& time) override {
+        y(0) = x;
+        dy(0) = v;
+        time = T;
+    }
+    virtual void StateScatter(const ChState& y, const ChStateDelta& dy, const double time, bool) override {
+        x = y(0);
+        v = dy(0);
+        T = time;
+    }
+    virtual void StateGatherAcceleration(ChStateDelta& acc) override { acc(0) = a; }
+    virtual void StateScatterAcceleration(const ChStateDelta& acc) override { a = acc(0); }
+
+    virtual bool StateSolveCorrection(ChStateDelta& Dv,
+                                      ChVectorDynamic<>& L,
+                                      const ChVectorDynamic<>& Rv,
+                                      const ChVectorDynamic<>& Qc,
+                                      const double c_a,
+                                      const double c_v,
+                                      const double c_x,
+                                      const ChState& y,
+                                      const ChStateDelta& dy,
+                                      const double time,
+                                      bool force_state_scatter,
+                                      bool full_update,
+                                      bool force_setup) override {
+        Dv(0) = Rv(0) / (c_a * M - c_v * R - c_x * K);
+        return true;
+    }
+
+    virtual void LoadResidual_F(ChVectorDynamic<>& Rv, const double c) override { Rv(0) += c * (-K * x - R * v); }
+    virtual void LoadResidual_Mv(ChVectorDynamic<>& Rv, const ChVectorDynamic<>& w, const double c) override {
+        Rv(0) += c * M * w(0);
+    }
+    virtual void LoadResidual_CqL(ChVectorDynamic<>&, const ChVectorDynamic<>&, const double) override {}
+    virtual void LoadConstraint_C(ChVectorDynamic<>&, const double, const bool, const double) override {}
+    virtual void LoadConstraint_Ct(ChVectorDynamic<>&, const double) override {}
+
+    bool unilateral;
+    double T, x, v, a;
+};
+
+static const double end_time = 3.0;
+
+// Integrate up to the end time with calls of the given size (or of the proposed size, with step size control).
+// Return the number of calls to Advance.
+template <class Stepper>
+static int Integrate(Stepper& stepper, double dt) {
+    int num_calls = 0;
+    while (stepper.GetTime() < end_time - 1e-12) {
+        double step = dt;
+        if (stepper.GetNextStepSize() > 0)
+            step = std::min(stepper.GetNextStepSize(), dt);
+        step = std::min(step, end_time - stepper.GetTime());
+        stepper.Advance(step);
+        num_calls++;
+    }
+    return num_calls;
+}
+
+struct AdaptiveResult {
+    double error;            // position error at the end time
+    unsigned int num_steps;  // number of accepted steps
+};
+
+template <class Stepper>
+static AdaptiveResult RunAdaptive(double rtol, double atol, double x_ref) {
+    DampedOscillator osc;
+    Stepper stepper(&osc);
+    stepper.SetStepControl(true);
+    stepper.SetStepTolerances(rtol, atol);
+    Integrate(stepper, 0.1);
+
+    EXPECT_DOUBLE_EQ(osc.T, end_time);
+    EXPECT_EQ(stepper.GetNumAcceptedSteps(), (unsigned int)stepper.GetStepSizeHistory().size());
+
+    // The accepted step sizes add up to the simulated time
+    double sum = 0;
+    for (auto h : stepper.GetStepSizeHistory())
+        sum += h;
+    EXPECT_NEAR(sum, end_time, 1e-9);
+
+    return {std::abs(osc.x - x_ref), stepper.GetNumAcceptedSteps()};
+}
+
+// Check the adaptive solutions for two tolerances against the reference position at the end time.
+template <class Stepper>
+static void CheckAdaptive(double rtol, double atol, double max_error, double x_ref) {
+    auto loose = RunAdaptive<Stepper>(rtol, atol, x_ref);
+    auto tight = RunAdaptive<Stepper>(rtol / 10, atol / 10, x_ref);
+
+    EXPECT_LT(loose.error, max_error);
+    EXPECT_LT(tight.error, loose.error);
+    EXPECT_GT(tight.num_steps, loose.num_steps);
+}
+
+TEST(ChAdaptiveTimestepper, euler_linearized) {
+    // The linearized Euler scheme does not converge to the analytical solution for velocity-dependent forces (the
+    // damping force is counted both at the beginning of the step and in the implicit term); use a solution with a
+    // small fixed step size as reference.
+    DampedOscillator osc;
+    ChTimestepperEulerImplicitLinearized stepper(&osc);
+    Integrate(stepper, 1e-5);
+
+    CheckAdaptive<ChTimestepperEulerImplicitLinearized>(1e-3, 1e-6, 1e-3, osc.x);
+}
+
+TEST(ChAdaptiveTimestepper, newmark) {
+    // The Newmark solution converges to the analytical one
+    DampedOscillator osc;
+    ChTimestepperNewmark stepper(&osc);
+    Integrate(stepper, 1e-4);
+    EXPECT_NEAR(osc.x, DampedOscillator::Position(end_time), 1e-4);
+
+    CheckAdaptive<ChTimestepperNewmark>(1e-3, 1e-6, 3e-3, DampedOscillator::Position(end_time));
+}
+
+TEST(ChAdaptiveTimestepper, unilateral) {
+    // With unilateral constraints, a call takes a single step, shortened if the initial attempt is rejected
+    DampedOscillator osc(true);
+    ChTimestepperEulerImplicitLinearized stepper(&osc);
+    stepper.SetStepControl(true);
+    stepper.SetStepTolerances(1e-3, 1e-6);
+
+    stepper.Advance(0.5);
+    EXPECT_EQ(stepper.GetNumAcceptedSteps(), 1u);
+    EXPECT_GT(stepper.GetNumRejectedSteps(), 0u);
+    EXPECT_LT(osc.T, 0.5);
+    EXPECT_DOUBLE_EQ(osc.T, stepper.GetStepSizeHistory()[0]);
+
+    // Each further call takes exactly one step
+    for (unsigned int i = 2; i <= 10; i++) {
+        stepper.Advance(0.5);
+        EXPECT_EQ(stepper.GetNumAcceptedSteps(), i);
+    }
+
+    // Without unilateral constraints, the same call reaches the requested time with several steps
+    DampedOscillator osc_free;
+    ChTimestepperEulerImplicitLinearized stepper_free(&osc_free);
+    stepper_free.SetStepControl(true);
+    stepper_free.SetStepTolerances(1e-3, 1e-6);
+    stepper_free.Advance(0.5);
+    EXPECT_DOUBLE_EQ(osc_free.T, 0.5);
+    EXPECT_GT(stepper_free.GetNumAcceptedSteps(), 1u);
+}
@@ -0,0 +1,197 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for cross-step Newton matrix reuse (ChImplicitIterativeTimestepper::SetNewtonMatrixReuse).
+// A chain of 20 unit masses connected by stiffening springs is integrated with the Euler implicit and HHT timesteppers,
+// with and without matrix reuse. The number of matrix rebuilds reported by the timestepper must match the number of
+// factorizations performed by the integrable, must drop with reuse, and the final states must agree.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Chain of N unit masses, fixed at the left end, with springs of force k*(d + 10*d^3) and dampers between neighbors,
+// and a slowly varying load on the last mass.
+class MassChain : public ChIntegrableIIorder {
+  public:
+    MassChain() : T(0), num_setups(0) {
+        x.setZero(N);
+        v.setZero(N);
+        a.setZero(N);
+    }
+
+    static constexpr int N = 20;
+    static constexpr double k = 1e4;
+    static constexpr double c = 5;
+
+    virtual unsigned int GetNumCoordsPosLevel() override { return N; }
+    virtual unsigned int GetNumCoordsVelLevel() override { return N; }
+
+    virtual void StateGather(ChState& y, ChStateDelta& dy, double& time) override {
+        y = x;
+        dy = v;
+        time = T;
+    }
+    virtual void StateScatter(const ChState& y, const ChStateDelta& dy, const double time, bool) override {
+        x = y;
+        v = dy;
+        T = time;
+    }
+    virtual void StateGatherAcceleration(ChStateDelta& acc) override { acc = a; }
+    virtual void StateScatterAcceleration(const ChStateDelta& acc) override { a = acc; }
+
+    virtual bool StateSolveCorrection(ChStateDelta& Dv,
+                                      ChVectorDynamic<>& L,
+                                      const ChVectorDynamic<>& R,
+                                      const ChVectorDynamic<>& Qc,
+                                      const double c_a,
+                                      const double c_v,
+                                      const double c_x,
+                                      const ChState& y,
+                                      const ChStateDelta& dy,
+                                      const double time,
+                                      bool force_state_scatter,
+                                      bool full_update,
+                                      bool call_setup) override {
+        if (call_setup) {
+            // Tangent stiffness and damping matrices (of the internal forces) at the current state
+            ChMatrixDynamic<> K = ChMatrixDynamic<>::Zero(N, N);
+            ChMatrixDynamic<> D = ChMatrixDynamic<>::Zero(N, N);
+            for (int i = 0; i < N; i++) {
+                double d = x(i) - (i > 0 ? x(i - 1) : 0);
+                double ks = k * (1 + 30 * d * d);
+                K(i, i) -= ks;
+                D(i, i) -= c;
+                if (i > 0) {
+                    K(i - 1, i - 1) -= ks;
+                    K(i, i - 1) += ks;
+                    K(i - 1, i) += ks;
+                    D(i - 1, i - 1) -= c;
+                    D(i, i - 1) += c;
+                    D(i - 1, i) += c;
+                }
+            }
+            ChMatrixDynamic<> G = c_a * ChMatrixDynamic<>::Identity(N, N) + c_v * D + c_x * K;
+            lu.compute(G);
+            num_setups++;
+        }
+        Dv = lu.solve(R);
+        return true;
+    }
+
+    virtual void LoadResidual_F(ChVectorDynamic<>& R, const double cf) override {
+        for (int i = 0; i < N; i++) {
+            double d = x(i) - (i > 0 ? x(i - 1) : 0);
+            double dv = v(i) - (i > 0 ? v(i - 1) : 0);
+            double f = k * (d + 10 * d * d * d) + c * dv;
+            R(i) -= cf * f;
+            if (i > 0)
+                R(i - 1) += cf * f;
+        }
+        R(N - 1) += cf * 3000 * std::sin(T);
+    }
+    virtual void LoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, const double cm) override {
+        R += cm * w;
+    }
+    virtual void LoadResidual_CqL(ChVectorDynamic<>&, const ChVectorDynamic<>&, const double) override {}
+    virtual void LoadConstraint_C(ChVectorDynamic<>&, const double, const bool, const double) override {}
+    virtual void LoadConstraint_Ct(ChVectorDynamic<>&, const double) override {}
+
+    double T;
+    ChVectorDynamic<> x, v, a;
+    Eigen::PartialPivLU<ChMatrixDynamic<>> lu;
+    unsigned int num_setups;  // number of factorizations of the Newton matrix
+};
+
+static const double step_size = 1e-2;
+static const double end_time = 10.0;
+
+struct ReuseResult {
+    ChVectorDynamic<> x;     // final positions
+    unsigned int rebuilds;   // matrix rebuilds reported by the timestepper
+    unsigned int reuses;     // steps started with a matrix from a previous step
+};
+
+template <class Stepper>
+static ReuseResult Integrate(bool reuse) {
+    MassChain chain;
+    Stepper stepper(&chain);
+    stepper.SetNewtonMatrixReuse(reuse);
+    stepper.SetMaxIters(20);
+    stepper.SetAbsTolerances(1e-8);
+
+    while (stepper.GetTime() < end_time - 1e-9)
+        stepper.Advance(step_size);
+
+    // Each rebuild corresponds to one factorization of the Newton matrix
+    EXPECT_EQ(stepper.GetNumMatrixRebuilds(), chain.num_setups);
+
+    return {chain.x, stepper.GetNumMatrixRebuilds(), stepper.GetNumMatrixReuses()};
+}
+
+template <class Stepper>
+static void CheckReuse() {
+    auto fresh = Integrate<Stepper>(false);
+    auto reused = Integrate<Stepper>(true);
+
+    // Without reuse, there are no reused matrices and at least one rebuild per step
+    unsigned int num_steps = (unsigned int)std::round(end_time / step_size);
+    EXPECT_EQ(fresh.reuses, 0u);
+    EXPECT_GE(fresh.rebuilds, num_steps);
+
+    // With reuse, most steps start with the matrix of a previous step
+    EXPECT_GT(reused.reuses, num_steps / 2);
+    EXPECT_LT(reused.rebuilds, fresh.rebuilds / 2);
+
+    // The final states agree
+    EXPECT_GT(fresh.x.cwiseAbs().maxCoeff(), 0.01);
+    EXPECT_LT((reused.x - fresh.x).cwiseAbs().maxCoeff(), 1e-6);
+}
+
+TEST(ChTimestepperMatrixReuse, euler_implicit) {
+    CheckReuse<ChTimestepperEulerImplicit>();
+}
+
+TEST(ChTimestepperMatrixReuse, hht) {
+    CheckReuse<ChTimestepperHHT>();
+}
+
+TEST(ChTimestepperMatrixReuse, step_size_change) {
+    MassChain chain;
+    ChTimestepperEulerImplicit stepper(&chain);
+    stepper.SetNewtonMatrixReuse(true);
+    stepper.SetAbsTolerances(1e-8);
+
+    stepper.Advance(step_size);
+    stepper.Advance(step_size);
+    EXPECT_EQ(stepper.GetNumMatrixRebuilds(), 1u);
+    EXPECT_EQ(stepper.GetNumMatrixReuses(), 1u);
+
+    // A change of the step size forces a rebuild at the beginning of the step
+    stepper.Advance(step_size / 2);
+    EXPECT_EQ(stepper.GetNumMatrixRebuilds(), 2u);
+    EXPECT_EQ(stepper.GetNumMatrixReuses(), 1u);
+
+    stepper.ResetMatrixStatistics();
+    EXPECT_EQ(stepper.GetNumMatrixRebuilds(), 0u);
+    EXPECT_EQ(stepper.GetNumMatrixReuses(), 0u);
+    EXPECT_EQ(chain.num_setups, 2u);
+}
@@ -0,0 +1,89 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the reuse of the assembly map and of the symbolic factorization in direct sparse solvers.
+// Two bodies move under gravity; one of them is attached to ground through a revolute joint. Halfway through the
+// simulation, the joint is replaced by a revolute joint attached to the other body. The number of variables,
+// constraints and matrix nonzeros does not change, but the location of the Jacobian blocks does. A solver with a
+// locked sparsity pattern and an assembly map must detect the change and produce the same results as a solver which
+// re-assembles the matrix from scratch at each step.
+//
+// =============================================================================
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+struct SwapResult {
+    ChVector3d pos1;                  // final position of first body
+    ChVector3d pos2;                  // final position of second body
+    unsigned int num_analysis_calls;  // number of symbolic analyses
+};
+
+static SwapResult SimulateSwap(bool use_map) {
+    ChSystemNSC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->LockSparsityPattern(use_map);
+    solver->UseAssemblyMap(use_map);
+    sys.SetSolver(solver);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto body1 = chrono_types::make_shared<ChBody>();
+    body1->SetPos(ChVector3d(1, 0, 0));
+    sys.AddBody(body1);
+
+    auto body2 = chrono_types::make_shared<ChBody>();
+    body2->SetPos(ChVector3d(0, 0, 1));
+    body2->SetMass(2);
+    sys.AddBody(body2);
+
+    auto joint1 = chrono_types::make_shared<ChLinkLockRevolute>();
+    joint1->Initialize(body1, ground, ChFrame<>(ChVector3d(0, 0, 0)));
+    sys.AddLink(joint1);
+
+    for (int i = 0; i < 50; i++)
+        sys.DoStepDynamics(1e-3);
+
+    // Replace the joint on the first body with a joint on the second body
+    sys.RemoveLink(joint1);
+    auto joint2 = chrono_types::make_shared<ChLinkLockRevolute>();
+    joint2->Initialize(body2, ground, ChFrame<>(body2->GetPos() + ChVector3d(1, 0, 0), QuatFromAngleY(CH_PI_2)));
+    sys.AddLink(joint2);
+
+    for (int i = 0; i < 50; i++)
+        sys.DoStepDynamics(1e-3);
+
+    return {body1->GetPos(), body2->GetPos(), solver->GetNumAnalysisCalls()};
+}
+
+TEST(ChDirectSolverLS, assembly_map_structure_change) {
+    auto ref = SimulateSwap(false);
+    auto map = SimulateSwap(true);
+
+    EXPECT_NEAR((ref.pos1 - map.pos1).Length(), 0, 1e-10);
+    EXPECT_NEAR((ref.pos2 - map.pos2).Length(), 0, 1e-10);
+
+    // The symbolic analysis is reused before the swap and repeated after the change of sparsity pattern
+    EXPECT_EQ(map.num_analysis_calls, 2);
+}
@@ -0,0 +1,137 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the contact cache used to warm start the NSC solver.
+// Contacts between two spheres are added to an NSC contact container over several collision detection passes,
+// without persistent reaction storage from the collision system. A contact must inherit the reactions of the
+// matching contact at the previous pass if its contact point moved by less than the (relative) match tolerance,
+// regardless of the order in which the two shapes are reported.
+//
+// =============================================================================
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class ContactCacheTest : public ::testing::Test {
+  protected:
+    void Create(double radius) {
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+        sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+        sys.SetGravitationalAcceleration(ChVector3d(0, 0, 0));
+
+        // Place the spheres at a distance larger than the collision envelope (no contacts from the collision system)
+        sphere1 = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+        sphere1->SetPos(ChVector3d(0, 0, 0));
+        sys.AddBody(sphere1);
+        sphere2 = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+        sphere2->SetPos(ChVector3d(0, 2.2 * radius, 0));
+        sys.AddBody(sphere2);
+
+        sys.Setup();
+        sys.Update();
+        sys.ComputeCollisions();
+
+        container = std::static_pointer_cast<ChContactContainerNSC>(sys.GetContactContainer());
+        this->radius = radius;
+    }
+
+    // Contact information, with the contact point on the first sphere moved along x by the given offset
+    ChCollisionInfo Contact(double offset, bool swap) {
+        auto model1 = sphere1->GetCollisionModel().get();
+        auto model2 = sphere2->GetCollisionModel().get();
+
+        ChCollisionInfo cinfo;
+        cinfo.modelA = model1;
+        cinfo.modelB = model2;
+        cinfo.shapeA = model1->GetShapeInstance(0).first.get();
+        cinfo.shapeB = model2->GetShapeInstance(0).first.get();
+        cinfo.vpA = ChVector3d(offset, radius, 0);
+        cinfo.vpB = ChVector3d(offset, 1.2 * radius, 0);
+        cinfo.vN = ChVector3d(0, 1, 0);
+        cinfo.distance = 0.2 * radius;
+        return swap ? ChCollisionInfo(cinfo, true) : cinfo;
+    }
+
+    // Perform a collision detection pass with the given contact and return the reactions the contact starts with
+    ChVector3d Pass(const ChCollisionInfo& cinfo) {
+        container->BeginAddContact();
+        container->AddContact(cinfo);
+        container->EndAddContact();
+        EXPECT_EQ(container->GetNumContacts(), 1);
+
+        ChVectorDynamic<> L(3);
+        container->IntStateGatherReactions(0, L);
+        return ChVector3d(L(0), L(1), L(2));
+    }
+
+    // Set the reactions of the current contact (as done after a solve)
+    void SetReactions(const ChVector3d& react) {
+        ChVectorDynamic<> L(3);
+        L << react.x(), react.y(), react.z();
+        container->IntStateScatterReactions(0, L);
+    }
+
+    ChSystemNSC sys;
+    std::shared_ptr<ChBody> sphere1;
+    std::shared_ptr<ChBody> sphere2;
+    std::shared_ptr<ChContactContainerNSC> container;
+    double radius;
+};
+
+TEST_F(ContactCacheTest, match) {
+    Create(0.5);
+
+    // New contact: no cached reactions
+    EXPECT_EQ(Pass(Contact(0, false)), ChVector3d(0, 0, 0));
+    EXPECT_EQ(container->GetNumWarmStartedContacts(), 0);
+    SetReactions(ChVector3d(5, 1, 2));
+
+    // Contact point moved within the tolerance: all reactions inherited
+    EXPECT_EQ(Pass(Contact(0.005, false)), ChVector3d(5, 1, 2));
+    EXPECT_EQ(container->GetNumWarmStartedContacts(), 1);
+    SetReactions(ChVector3d(6, 1, 2));
+
+    // Same contact, with the shapes reported in the opposite order: only the normal reaction is inherited
+    EXPECT_EQ(Pass(Contact(0.005, true)), ChVector3d(6, 0, 0));
+    EXPECT_EQ(container->GetNumWarmStartedContacts(), 1);
+    SetReactions(ChVector3d(7, 3, 4));
+
+    // Same order as at the previous pass: all reactions inherited
+    EXPECT_EQ(Pass(Contact(0.005, true)), ChVector3d(7, 3, 4));
+    EXPECT_EQ(container->GetNumWarmStartedContacts(), 1);
+
+    // Contact point moved beyond the tolerance: no cached reactions
+    EXPECT_EQ(Pass(Contact(0.1, true)), ChVector3d(0, 0, 0));
+    EXPECT_EQ(container->GetNumWarmStartedContacts(), 0);
+}
+
+TEST_F(ContactCacheTest, relative_tolerance) {
+    // The match tolerance scales with the size of the colliding objects
+    Create(50);
+
+    EXPECT_EQ(Pass(Contact(0, false)), ChVector3d(0, 0, 0));
+    SetReactions(ChVector3d(5, 1, 2));
+
+    EXPECT_EQ(Pass(Contact(0.5, false)), ChVector3d(5, 1, 2));
+    EXPECT_EQ(container->GetNumWarmStartedContacts(), 1);
+
+    EXPECT_EQ(Pass(Contact(10, false)), ChVector3d(0, 0, 0));
+    EXPECT_EQ(container->GetNumWarmStartedContacts(), 0);
+}
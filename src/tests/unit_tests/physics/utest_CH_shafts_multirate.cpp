@@ -0,0 +1,138 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for multirate integration with a shaft-coupled fast partition.
+// A wheel shaft (slow), connected to ground through a soft torsional spring-damper, is driven by an engine shaft
+// (fast) through a stiff torsional spring. The system is simulated monolithically with the fast step size and with
+// the engine subcycled in a separate system (ChShaftsMultiratePartition), and the results are compared. The sign of
+// the interface torque is checked against the torque exerted by the coupling spring on the wheel in the monolithic
+// model.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChShaftsMultiratePartition.h"
+#include "chrono/physics/ChShaftsTorsionSpring.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/timestepper/ChTimestepperMultirate.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const double slow_step = 1e-3;    // step size of the slow system
+static const int num_substeps = 10;      // fast substeps per slow step
+static const double end_time = 1.0;      // simulation length
+static const double wheel_load = -2.0;   // torque applied by the user on the wheel shaft
+static const double engine_load = 10.0;  // constant part of the engine torque
+
+static double EngineTorque(double time) {
+    return engine_load + 5 * std::sin(20 * time);
+}
+
+static std::shared_ptr<ChShaft> BuildWheel(ChSystem& sys) {
+    auto ground = chrono_types::make_shared<ChShaft>();
+    ground->SetFixed(true);
+    sys.AddShaft(ground);
+
+    auto wheel = chrono_types::make_shared<ChShaft>();
+    wheel->SetInertia(5);
+    wheel->SetAppliedLoad(wheel_load);
+    sys.AddShaft(wheel);
+
+    auto spring = chrono_types::make_shared<ChShaftsTorsionSpring>();
+    spring->Initialize(wheel, ground);
+    spring->SetTorsionalStiffness(50);
+    spring->SetTorsionalDamping(5);
+    sys.Add(spring);
+
+    return wheel;
+}
+
+static std::shared_ptr<ChShaftsTorsionSpring> BuildEngine(ChSystem& sys,
+                                                          std::shared_ptr<ChShaft> wheel,
+                                                          std::shared_ptr<ChShaft>& engine) {
+    engine = chrono_types::make_shared<ChShaft>();
+    engine->SetInertia(0.05);
+    sys.AddShaft(engine);
+
+    auto spring = chrono_types::make_shared<ChShaftsTorsionSpring>();
+    spring->Initialize(engine, wheel);
+    spring->SetTorsionalStiffness(2e4);
+    spring->SetTorsionalDamping(2);
+    sys.Add(spring);
+
+    return spring;
+}
+
+TEST(ChTimestepperMultirate, shafts) {
+    int num_steps = (int)std::round(end_time / slow_step);
+
+    // Monolithic simulation with the fast step size
+    ChSystemNSC mono;
+    mono.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    auto mono_wheel = BuildWheel(mono);
+    std::shared_ptr<ChShaft> mono_engine;
+    auto mono_spring = BuildEngine(mono, mono_wheel, mono_engine);
+
+    for (int i = 0; i < num_steps * num_substeps; i++) {
+        mono_engine->SetAppliedLoad(EngineTorque(mono.GetChTime()));
+        mono.DoStepDynamics(slow_step / num_substeps);
+    }
+
+    // Multirate simulation, with the engine subcycled in a separate system
+    ChSystemNSC slow;
+    auto fast = chrono_types::make_shared<ChSystemNSC>();
+    auto wheel = BuildWheel(slow);
+
+    auto proxy = chrono_types::make_shared<ChShaft>();
+    proxy->SetInertia(1);
+    fast->AddShaft(proxy);
+    std::shared_ptr<ChShaft> engine;
+    BuildEngine(*fast, proxy, engine);
+
+    auto partition = chrono_types::make_shared<ChShaftsMultiratePartition>(fast);
+    partition->AddShaftInterface(wheel, proxy);
+    auto slow_stepper = chrono_types::make_shared<ChTimestepperEulerImplicitLinearized>(&slow);
+    auto stepper = chrono_types::make_shared<ChTimestepperMultirate>(slow_stepper);
+    stepper->AddFastPartition(partition, num_substeps);
+    slow.SetTimestepper(stepper);
+
+    for (int i = 0; i < num_steps; i++) {
+        engine->SetAppliedLoad(EngineTorque(slow.GetChTime()));
+        slow.DoStepDynamics(slow_step);
+    }
+
+    EXPECT_NEAR(slow.GetChTime(), mono.GetChTime(), 1e-9);
+    EXPECT_NEAR(fast->GetChTime(), mono.GetChTime(), 1e-9);
+    EXPECT_EQ(stepper->GetNumFastSubsteps(), (unsigned int)(num_steps * num_substeps));
+
+    // The user load on the wheel shaft is not modified by the interface torque
+    EXPECT_EQ(wheel->GetAppliedLoad(), wheel_load);
+
+    // The interface torque has the sign and magnitude of the torque exerted by the coupling spring on the wheel
+    double mono_torque = mono_spring->GetReaction2();
+    double torque = partition->GetInterfaceTorque(0);
+    EXPECT_GT(mono_torque, 0);
+    EXPECT_GT(torque, 0);
+    EXPECT_NEAR(torque, mono_torque, 0.05 * std::abs(mono_torque));
+
+    // The subcycled motion matches the monolithic one
+    EXPECT_GT(mono_wheel->GetPos(), 0);
+    EXPECT_NEAR(wheel->GetPos(), mono_wheel->GetPos(), 0.02 * std::abs(mono_wheel->GetPos()));
+    EXPECT_NEAR(wheel->GetPosDt(), mono_wheel->GetPosDt(), 0.05);
+    EXPECT_NEAR(engine->GetPos(), mono_engine->GetPos(), 0.02 * std::abs(mono_engine->GetPos()));
+    EXPECT_NEAR(proxy->GetPos(), wheel->GetPos(), 1e-5);
+}
@@ -0,0 +1,107 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the packed constraint Jacobians used by the iterative VI solvers.
+// Columns of stacked spheres resting on a fixed box are simulated by each solver supporting packed Jacobians, with
+// and without packing. The packed and unpacked solutions must match, and the packed data must be released at the end
+// of each solve.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+struct StackResult {
+    std::vector<ChVector3d> pos;  // final sphere positions
+    std::vector<ChVector3d> vel;  // final sphere velocities
+    bool packed_available;        // packed data still available after the last step
+};
+
+static StackResult SimulateStacks(ChSolver::Type solver_type, bool packed) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.SetSolverType(solver_type);
+    sys.GetSystemDescriptor()->EnablePackedJacobians(packed);
+
+    auto solver = std::static_pointer_cast<ChIterativeSolverVI>(sys.GetSolver());
+    solver->SetMaxIterations(100);
+    solver->SetTolerance(0);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> spheres;
+    for (int ix = 0; ix < 2; ix++) {
+        for (int iy = 0; iy < 3; iy++) {
+            auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+            sphere->SetPos(ChVector3d(1.5 * ix, 0.5 + 1.0 * iy + 0.01 * ix, 0.1 * iy));
+            sys.AddBody(sphere);
+            spheres.push_back(sphere);
+        }
+    }
+
+    for (int i = 0; i < 20; i++)
+        sys.DoStepDynamics(1e-3);
+
+    StackResult result;
+    for (const auto& sphere : spheres) {
+        result.pos.push_back(sphere->GetPos());
+        result.vel.push_back(sphere->GetPosDt());
+    }
+    result.packed_available = sys.GetSystemDescriptor()->HasPackedJacobians();
+
+    return result;
+}
+
+static void CompareSolutions(ChSolver::Type solver_type) {
+    auto unpacked = SimulateStacks(solver_type, false);
+    auto packed = SimulateStacks(solver_type, true);
+
+    EXPECT_FALSE(packed.packed_available);
+
+    ASSERT_EQ(unpacked.pos.size(), packed.pos.size());
+    for (size_t i = 0; i < unpacked.pos.size(); i++) {
+        EXPECT_NEAR((unpacked.pos[i] - packed.pos[i]).Length(), 0, 1e-10);
+        EXPECT_NEAR((unpacked.vel[i] - packed.vel[i]).Length(), 0, 1e-8);
+    }
+}
+
+TEST(ChSystemDescriptor, packed_PSOR) {
+    CompareSolutions(ChSolver::Type::PSOR);
+}
+
+TEST(ChSystemDescriptor, packed_APGD) {
+    CompareSolutions(ChSolver::Type::APGD);
+}
+
+TEST(ChSystemDescriptor, packed_BARZILAIBORWEIN) {
+    CompareSolutions(ChSolver::Type::BARZILAIBORWEIN);
+}
+
+TEST(ChSystemDescriptor, packed_PMINRES) {
+    CompareSolutions(ChSolver::Type::PMINRES);
+}
@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the multithreaded PSOR solver (PSOR_PARALLEL).
+// Columns of stacked spheres resting on a fixed box are simulated with the serial PSOR solver and with PSOR_PARALLEL
+// using different numbers of threads. Both solvers must converge to the same contact solution (the stacks remain at
+// rest, with the contact forces balancing the weight) and the PSOR_PARALLEL results must not depend on the number of
+// threads.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChIterativeSolverVI.h"
+#include "chrono/solver/ChSolverPSORparallel.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const int num_columns = 3;  // number of sphere columns in each direction
+static const int num_layers = 4;   // number of spheres in each column
+static const double radius = 0.5;  // sphere radius
+static const double density = 1000;
+static const double step_size = 1e-3;
+static const int num_steps = 50;
+
+struct StackResult {
+    std::vector<ChVector3d> pos;  // final sphere positions
+    std::vector<ChVector3d> vel;  // final sphere velocities
+    double ground_force;          // downward contact force on the ground
+    double weight;                // total weight of the spheres
+    double error;                 // solver error at the last step
+};
+
+static StackResult SimulateStacks(ChSolver::Type solver_type, int num_threads) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.SetSolverType(solver_type);
+    sys.SetNumThreads(num_threads, 1, 1);
+
+    auto solver = std::static_pointer_cast<ChIterativeSolverVI>(sys.GetSolver());
+    solver->SetMaxIterations(300);
+    solver->SetTolerance(0);
+    solver->EnableWarmStart(true);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+    mat->SetRestitution(0);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> spheres;
+    double weight = 0;
+    for (int ix = 0; ix < num_columns; ix++) {
+        for (int iz = 0; iz < num_columns; iz++) {
+            for (int iy = 0; iy < num_layers; iy++) {
+                auto sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, density, false, true, mat);
+                sphere->SetPos(ChVector3d(3 * radius * ix, radius + 2 * radius * iy, 3 * radius * iz));
+                sys.AddBody(sphere);
+                spheres.push_back(sphere);
+                weight += sphere->GetMass() * 9.81;
+            }
+        }
+    }
+
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(step_size);
+
+    StackResult result;
+    for (const auto& sphere : spheres) {
+        result.pos.push_back(sphere->GetPos());
+        result.vel.push_back(sphere->GetPosDt());
+    }
+    result.ground_force = -sys.GetContactContainer()->GetContactableForce(ground.get()).y();
+    result.weight = weight;
+    result.error = solver->GetError();
+
+    return result;
+}
+
+TEST(ChSolverPSORparallel, convergence) {
+    auto serial = SimulateStacks(ChSolver::Type::PSOR, 1);
+    auto parallel = SimulateStacks(ChSolver::Type::PSOR_PARALLEL, 4);
+
+    // Both solvers converge to a state of rest, with contact forces balancing the weight
+    EXPECT_LT(serial.error, 1e-6);
+    EXPECT_LT(parallel.error, 1e-6);
+    EXPECT_NEAR(serial.ground_force, serial.weight, 1e-3 * serial.weight);
+    EXPECT_NEAR(parallel.ground_force, parallel.weight, 1e-3 * parallel.weight);
+
+    // Both solvers produce the same motion
+    ASSERT_EQ(serial.pos.size(), parallel.pos.size());
+    for (size_t i = 0; i < serial.pos.size(); i++) {
+        EXPECT_NEAR((serial.pos[i] - parallel.pos[i]).Length(), 0, 1e-6);
+        EXPECT_NEAR((serial.vel[i] - parallel.vel[i]).Length(), 0, 1e-4);
+        EXPECT_NEAR(parallel.vel[i].Length(), 0, 1e-2);
+    }
+}
+
+TEST(ChSolverPSORparallel, thread_independence) {
+    auto result1 = SimulateStacks(ChSolver::Type::PSOR_PARALLEL, 1);
+    auto result4 = SimulateStacks(ChSolver::Type::PSOR_PARALLEL, 4);
+
+    // The coloring, and therefore the sweep order, does not depend on the number of threads
+    ASSERT_EQ(result1.pos.size(), result4.pos.size());
+    for (size_t i = 0; i < result1.pos.size(); i++) {
+        EXPECT_EQ(result1.pos[i], result4.pos[i]);
+        EXPECT_EQ(result1.vel[i], result4.vel[i]);
+    }
+}
@@ -0,0 +1,167 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for binary state snapshots (ChSystem::SaveStateSnapshot and RestoreStateSnapshot).
+// A pendulum (revolute joint) and a box resting on the ground (contacts) are simulated, a snapshot is saved, and the
+// simulation is continued. After restoring the snapshot, the simulation is repeated and must reproduce the same
+// states. Invalid and mismatched snapshots must be rejected.
+//
+// =============================================================================
+
+#include <cstdio>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const double step_size = 1e-3;
+
+struct TestModel {
+    std::shared_ptr<ChBody> pendulum;
+    std::shared_ptr<ChBody> box;
+};
+
+static TestModel BuildModel(ChSystem& sys) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 0.2, 4, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, -0.1, 0));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    TestModel model;
+
+    model.pendulum = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, false, false);
+    model.pendulum->SetPos(ChVector3d(0.5, 2, 0));
+    sys.AddBody(model.pendulum);
+
+    auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+    joint->Initialize(ground, model.pendulum, ChFrame<>(ChVector3d(0, 2, 0)));
+    sys.AddLink(joint);
+
+    model.box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.4, 0.4, 1000, false, true, mat);
+    model.box->SetPos(ChVector3d(1.5, 0.21, 0));
+    model.box->SetPosDt(ChVector3d(0.5, 0, 0));
+    sys.AddBody(model.box);
+
+    return model;
+}
+
+static void Simulate(ChSystem& sys, int num_steps) {
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(step_size);
+}
+
+TEST(ChSystem, state_snapshot) {
+    ChSystemNSC sys;
+    auto model = BuildModel(sys);
+    Simulate(sys, 200);
+    ASSERT_GT(sys.GetNumContacts(), 0u);
+
+    std::vector<char> snapshot;
+    sys.SaveStateSnapshot(snapshot);
+    double time = sys.GetChTime();
+    auto pend_pos = model.pendulum->GetPos();
+    auto pend_rot = model.pendulum->GetRot();
+    auto pend_vel = model.pendulum->GetAngVelLocal();
+    auto box_pos = model.box->GetPos();
+    auto box_vel = model.box->GetPosDt();
+
+    Simulate(sys, 300);
+    auto pend_pos1 = model.pendulum->GetPos();
+    auto pend_vel1 = model.pendulum->GetPosDt();
+    auto box_pos1 = model.box->GetPos();
+    auto box_vel1 = model.box->GetPosDt();
+
+    // The restored state is that at the time of the snapshot
+    sys.RestoreStateSnapshot(snapshot);
+    EXPECT_EQ(sys.GetChTime(), time);
+    EXPECT_EQ(sys.GetStep(), step_size);
+    EXPECT_EQ(model.pendulum->GetPos(), pend_pos);
+    EXPECT_EQ(model.pendulum->GetRot(), pend_rot);
+    EXPECT_NEAR((model.pendulum->GetAngVelLocal() - pend_vel).Length(), 0, 1e-12);
+    EXPECT_EQ(model.box->GetPos(), box_pos);
+    EXPECT_NEAR((model.box->GetPosDt() - box_vel).Length(), 0, 1e-12);
+
+    // A snapshot of the restored state has the same layout
+    std::vector<char> snapshot2;
+    sys.SaveStateSnapshot(snapshot2);
+    ASSERT_EQ(snapshot2.size(), snapshot.size());
+
+    // Repeating the simulation reproduces the same motion. The persistent data of the collision system is not part of
+    // the snapshot, so contacts may be generated in a different order.
+    Simulate(sys, 300);
+    EXPECT_NEAR(sys.GetChTime(), time + 300 * step_size, 1e-12);
+    EXPECT_NEAR((model.pendulum->GetPos() - pend_pos1).Length(), 0, 1e-9);
+    EXPECT_NEAR((model.pendulum->GetPosDt() - pend_vel1).Length(), 0, 1e-9);
+    EXPECT_NEAR((model.box->GetPos() - box_pos1).Length(), 0, 1e-6);
+    EXPECT_NEAR((model.box->GetPosDt() - box_vel1).Length(), 0, 1e-5);
+}
+
+TEST(ChSystem, state_snapshot_copy) {
+    // A snapshot can be restored in an identical system constructed by the same code. The contacts of the second
+    // system at the time of the restore differ from those of the first, so the motion of the box is only close.
+    ChSystemNSC sys1;
+    auto model1 = BuildModel(sys1);
+    Simulate(sys1, 200);
+
+    std::string filename = "state_snapshot_test.dat";
+    ASSERT_TRUE(sys1.WriteStateSnapshot(filename));
+    Simulate(sys1, 100);
+
+    ChSystemNSC sys2;
+    auto model2 = BuildModel(sys2);
+    Simulate(sys2, 1);
+    ASSERT_TRUE(sys2.ReadStateSnapshot(filename));
+    std::remove(filename.c_str());
+    Simulate(sys2, 100);
+
+    EXPECT_NEAR(sys2.GetChTime(), sys1.GetChTime(), 1e-12);
+    EXPECT_NEAR((model2.pendulum->GetPos() - model1.pendulum->GetPos()).Length(), 0, 1e-9);
+    EXPECT_NEAR((model2.box->GetPos() - model1.box->GetPos()).Length(), 0, 1e-5);
+}
+
+TEST(ChSystem, state_snapshot_invalid) {
+    ChSystemNSC sys;
+    BuildModel(sys);
+    Simulate(sys, 10);
+
+    std::vector<char> snapshot;
+    sys.SaveStateSnapshot(snapshot);
+
+    // Truncated snapshot
+    std::vector<char> truncated(snapshot.begin(), snapshot.begin() + snapshot.size() / 2);
+    EXPECT_THROW(sys.RestoreStateSnapshot(truncated), std::runtime_error);
+
+    // Not a snapshot
+    std::vector<char> garbage(snapshot.size(), 'x');
+    EXPECT_THROW(sys.RestoreStateSnapshot(garbage), std::runtime_error);
+
+    // Snapshot of a different system
+    ChSystemNSC other;
+    auto body = chrono_types::make_shared<ChBody>();
+    other.AddBody(body);
+    EXPECT_THROW(other.RestoreStateSnapshot(snapshot), std::runtime_error);
+
+    ChSystemNSC empty;
+    std::vector<char> empty_snapshot;
+    empty.SaveStateSnapshot(empty_snapshot);
+    EXPECT_THROW(sys.RestoreStateSnapshot(empty_snapshot), std::runtime_error);
+}